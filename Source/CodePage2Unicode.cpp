@@ -26,6 +26,12 @@
 #include "Include/StdAfx.h"
 
 #include "Include/CodePage2Unicode.h"
+#include "Include/CodePageDecoder.h"
+#include "Include/CodePageRegistry.h"
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE2)
+#   include <immintrin.h>
+#endif
 
 using namespace std;
 
@@ -366,6 +372,114 @@ const char32_t CodePage2Unicode::m_arrISO_8859_7[128] = {
     0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF
    };*/
 
+/**
+ * EBCDIC code page IBM 037: EBCDIC US/Canada, all the 256 characters.<br />
+ * Suitable for writing in: Latin-1, Western Europe, English, etc. .<br />
+ * Script:	Latin<br />
+ * IANA/MIME: IBM037, cp037, ebcdic-cp-us<br />
+ * C/C++ locale options: <br />
+ * Win32 CP: 37
+ */
+const char32_t CodePage2Unicode::m_arrEBCDIC_CP037[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007,
+    0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A,
+    0x0020, 0x00A0, 0x00E2, 0x00E4, 0x00E0, 0x00E1, 0x00E3, 0x00E5, 0x00E7, 0x00F1, 0x00A2, 0x002E, 0x003C, 0x0028, 0x002B, 0x007C,
+    0x0026, 0x00E9, 0x00EA, 0x00EB, 0x00E8, 0x00ED, 0x00EE, 0x00EF, 0x00EC, 0x00DF, 0x0021, 0x0024, 0x002A, 0x0029, 0x003B, 0x00AC,
+    0x002D, 0x002F, 0x00C2, 0x00C4, 0x00C0, 0x00C1, 0x00C3, 0x00C5, 0x00C7, 0x00D1, 0x00A6, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F,
+    0x00F8, 0x00C9, 0x00CA, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x0060, 0x003A, 0x0023, 0x0040, 0x0027, 0x003D, 0x0022,
+    0x00D8, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x00AB, 0x00BB, 0x00F0, 0x00FD, 0x00FE, 0x00B1,
+    0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x00AA, 0x00BA, 0x00E6, 0x00B8, 0x00C6, 0x00A4,
+    0x00B5, 0x007E, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00A1, 0x00BF, 0x00D0, 0x00DD, 0x00DE, 0x00AE,
+    0x005E, 0x00A3, 0x00A5, 0x00B7, 0x00A9, 0x00A7, 0x00B6, 0x00BC, 0x00BD, 0x00BE, 0x005B, 0x005D, 0x00AF, 0x00A8, 0x00B4, 0x00D7,
+    0x007B, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x00F4, 0x00F6, 0x00F2, 0x00F3, 0x00F5,
+    0x007D, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B9, 0x00FB, 0x00FC, 0x00F9, 0x00FA, 0x00FF,
+    0x005C, 0x00F7, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00D4, 0x00D6, 0x00D2, 0x00D3, 0x00D5,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00DB, 0x00DC, 0x00D9, 0x00DA, 0x009F
+};
+
+/**
+ * EBCDIC code page IBM 500: EBCDIC International, all the 256 characters.<br />
+ * Suitable for writing in: Latin-1, Western Europe, etc. .<br />
+ * Script:	Latin<br />
+ * IANA/MIME: IBM500, cp500, ebcdic-cp-be, ebcdic-cp-ch<br />
+ * C/C++ locale options: <br />
+ * Win32 CP: 500
+ */
+const char32_t CodePage2Unicode::m_arrEBCDIC_CP500[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007,
+    0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A,
+    0x0020, 0x00A0, 0x00E2, 0x00E4, 0x00E0, 0x00E1, 0x00E3, 0x00E5, 0x00E7, 0x00F1, 0x005B, 0x002E, 0x003C, 0x0028, 0x002B, 0x0021,
+    0x0026, 0x00E9, 0x00EA, 0x00EB, 0x00E8, 0x00ED, 0x00EE, 0x00EF, 0x00EC, 0x00DF, 0x005D, 0x0024, 0x002A, 0x0029, 0x003B, 0x005E,
+    0x002D, 0x002F, 0x00C2, 0x00C4, 0x00C0, 0x00C1, 0x00C3, 0x00C5, 0x00C7, 0x00D1, 0x00A6, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F,
+    0x00F8, 0x00C9, 0x00CA, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x0060, 0x003A, 0x0023, 0x0040, 0x0027, 0x003D, 0x0022,
+    0x00D8, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x00AB, 0x00BB, 0x00F0, 0x00FD, 0x00FE, 0x00B1,
+    0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x00AA, 0x00BA, 0x00E6, 0x00B8, 0x00C6, 0x00A4,
+    0x00B5, 0x007E, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00A1, 0x00BF, 0x00D0, 0x00DD, 0x00DE, 0x00AE,
+    0x00A2, 0x00A3, 0x00A5, 0x00B7, 0x00A9, 0x00A7, 0x00B6, 0x00BC, 0x00BD, 0x00BE, 0x00AC, 0x007C, 0x00AF, 0x00A8, 0x00B4, 0x00D7,
+    0x007B, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x00F4, 0x00F6, 0x00F2, 0x00F3, 0x00F5,
+    0x007D, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B9, 0x00FB, 0x00FC, 0x00F9, 0x00FA, 0x00FF,
+    0x005C, 0x00F7, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00D4, 0x00D6, 0x00D2, 0x00D3, 0x00D5,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00DB, 0x00DC, 0x00D9, 0x00DA, 0x009F
+};
+
+/**
+ * EBCDIC code page IBM 875: EBCDIC Greek, all the 256 characters.<br />
+ * Suitable for writing in: Greek, English, etc. .<br />
+ * Script:	Greek<br />
+ * IANA/MIME: IBM875, cp875<br />
+ * C/C++ locale options: <br />
+ * Win32 CP: 875
+ */
+const char32_t CodePage2Unicode::m_arrEBCDIC_CP875[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007,
+    0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A,
+    0x0020, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x005B, 0x002E, 0x003C, 0x0028, 0x002B, 0x0021,
+    0x0026, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x03A3, 0x005D, 0x0024, 0x002A, 0x0029, 0x003B, 0x005E,
+    0x002D, 0x002F, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x007C, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F,
+    0x00A8, 0x0386, 0x0388, 0x0389, 0x00A0, 0x038A, 0x038C, 0x038E, 0x038F, 0x0060, 0x003A, 0x0023, 0x0040, 0x0027, 0x003D, 0x0022,
+    0x0385, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6,
+    0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC,
+    0x00B4, 0x007E, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3,
+    0x00A3, 0x03AC, 0x03AD, 0x03AE, 0x03CA, 0x03AF, 0x03CC, 0x03CD, 0x03CB, 0x03CE, 0x03C2, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8,
+    0x007B, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x03C9, 0x0390, 0x03B0, 0x2018, 0x2015,
+    0x007D, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B1, 0x00BD, 0xFFFD, 0x0387, 0x2019, 0x00A6,
+    0x005C, 0xFFFD, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00A7, 0xFFFD, 0xFFFD, 0x00AB, 0x00AC,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00A9, 0xFFFD, 0xFFFD, 0x00BB, 0x009F
+};
+
+/**
+ * EBCDIC code page IBM 1047: EBCDIC Open Systems Latin-1, all the 256 characters.<br />
+ * Suitable for writing in: Latin-1, Western Europe, etc. .<br />
+ * Script:	Latin<br />
+ * IANA/MIME: IBM1047, cp1047<br />
+ * C/C++ locale options: <br />
+ * Win32 CP: 1047 (20924 with €)
+ */
+const char32_t CodePage2Unicode::m_arrEBCDIC_CP1047[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007,
+    0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A,
+    0x0020, 0x00A0, 0x00E2, 0x00E4, 0x00E0, 0x00E1, 0x00E3, 0x00E5, 0x00E7, 0x00F1, 0x00A2, 0x002E, 0x003C, 0x0028, 0x002B, 0x007C,
+    0x0026, 0x00E9, 0x00EA, 0x00EB, 0x00E8, 0x00ED, 0x00EE, 0x00EF, 0x00EC, 0x00DF, 0x0021, 0x0024, 0x002A, 0x0029, 0x003B, 0x005E,
+    0x002D, 0x002F, 0x00C2, 0x00C4, 0x00C0, 0x00C1, 0x00C3, 0x00C5, 0x00C7, 0x00D1, 0x00A6, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F,
+    0x00F8, 0x00C9, 0x00CA, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x0060, 0x003A, 0x0023, 0x0040, 0x0027, 0x003D, 0x0022,
+    0x00D8, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x00AB, 0x00BB, 0x00F0, 0x00FD, 0x00FE, 0x00B1,
+    0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x00AA, 0x00BA, 0x00E6, 0x00B8, 0x00C6, 0x00A4,
+    0x00B5, 0x007E, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00A1, 0x00BF, 0x00D0, 0x005B, 0x00DE, 0x00AE,
+    0x00AC, 0x00A3, 0x00A5, 0x00B7, 0x00A9, 0x00A7, 0x00B6, 0x00BC, 0x00BD, 0x00BE, 0x00DD, 0x00A8, 0x00AF, 0x005D, 0x00B4, 0x00D7,
+    0x007B, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x00F4, 0x00F6, 0x00F2, 0x00F3, 0x00F5,
+    0x007D, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B9, 0x00FB, 0x00FC, 0x00F9, 0x00FA, 0x00FF,
+    0x005C, 0x00F7, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00D4, 0x00D6, 0x00D2, 0x00D3, 0x00D5,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00DB, 0x00DC, 0x00D9, 0x00DA, 0x009F
+};
+
 /**
  * Check if the given string is a valid UTF-8 sequence.
  *
@@ -374,9 +488,10 @@ const char32_t CodePage2Unicode::m_arrISO_8859_7[128] = {
  *      110xxxxx 10xxxxxx<br />
  *      1110xxxx 10xxxxxx 10xxxxxx<br />
  *      11110xxx 10xxxxxx 10xxxxxx 10xxxxxx<br />
- * The patterns below are not part of UTF-8, but were part of the first specification:<br />
- *      111110xx 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx<br />
- *      1111110x 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx<br />
+ * The overlong forms, the UTF-16 surrogates [U+D800; U+DFFF], the code points above U+10FFFF and
+ * the patterns of the first specification (5 and 6 bytes sequences) are rejected.<br />
+ * The string is checked in 16 or 32 bytes blocks with SIMD instructions when available, and the
+ * first error is located by the scalar validator.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
@@ -385,123 +500,421 @@ const char32_t CodePage2Unicode::m_arrISO_8859_7[128] = {
  * @param	unicodeFound	optional out parameter (defaults to NULL) that if not NULL,
  *                          the value 'true' means that at least one UTF-8 surrogate has found,
  *                          and 'false' that the string only contains ANSI ASCII values
+ * @param	errorOffset		optional out parameter (defaults to NULL) that if not NULL, receives the offset
+ *                          of the first invalid UTF-8 sequence, or the length of the string if it's valid
  * @return	'true' if it's a valid UTF-8 string, 'false' otherwise
  * @since	1.0
  */
-bool CodePage2Unicode::isUtf8(const char* utf8String, const size_t utf8Lenght, bool* unicodeFound)
+bool CodePage2Unicode::isUtf8(const char* utf8String, const size_t utf8Lenght, bool* unicodeFound, size_t* errorOffset)
 {
     // Validate parameters
     assert(utf8String != nullptr);
 
-    size_t i = 0;
-    size_t sequenceBytes = 0;
+    bool nonAsciiFound = false;
+    size_t offset = validateUtf8Blocks(utf8String, utf8Lenght, nonAsciiFound);
+    if(offset < utf8Lenght)
+    {
+        // Invalid block found (or no SIMD), locate the first error from the last sequence boundary
+        offset = validateUtf8(utf8String, utf8Lenght, offset);
+
+        // Search for non-ASCII characters up to the error
+        size_t end = min(offset + 1, utf8Lenght);
+        size_t i = getAsciiBlocksLength(utf8String, end);
+        while((i < end) && !(utf8String[i] & UTF8_NEXT))
+        {
+            ++i;
+        }
+        nonAsciiFound = (i < end);
+    }
 
     if(unicodeFound != nullptr)
     {
-        *unicodeFound = false;
+        *unicodeFound = nonAsciiFound;
     }
-
-    // Check first byte
-    while(i < utf8Lenght)
+    if(errorOffset != nullptr)
     {
-        unsigned char charUtf8 = static_cast<unsigned char>(utf8String[i]);
+        *errorOffset = offset;
+    }
+
+    return (offset == utf8Lenght);
+}
+
+/**
+ * Validates an UTF-8 string, one sequence at a time, following the well-formed UTF-8 byte
+ * sequences table of the Unicode Standard (no overlong forms, no surrogates, nothing above U+10FFFF).
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String	the UTF-8 code units to be validated
+ * @param	length		the number of UTF-8 code units
+ * @param	start		the offset of a sequence boundary where to start the validation
+ * @return	the offset of the first invalid UTF-8 sequence, or 'length' if the string is valid
+ * @since	1.0
+ */
+size_t CodePage2Unicode::validateUtf8(const char* utf8String, const size_t length, const size_t start)
+{
+    const unsigned char* pUtf8 = reinterpret_cast<const unsigned char*>(utf8String);
+    size_t i = start;
 
-        if(charUtf8 <= 0x7FU)
+    while(i < length)
+    {
+        unsigned char lead = pUtf8[i];
+        if(lead <= 0x7FU)
         {
-            // 7-bit Unicode code point (7-bit ASCII [U+00000000; U+0000007F]) => 1 byte
-            sequenceBytes = 0;
+            // 7-bit ASCII
+            ++i;
+            continue;
         }
-        else if((charUtf8 >= 0xC0U) && (charUtf8 <= 0xDFU))
+
+        // Number of next code units and range of the first one, by lead code unit
+        size_t sequenceBytes = 0;
+        unsigned char nextMin = 0x80U;
+        unsigned char nextMax = 0xBFU;
+        if((lead >= 0xC2U) && (lead <= 0xDFU))
         {
-            // 11-bit Unicode code point ([U+00000080; U+000007FF]) => 2 bytes
-            // Sequence 11000000 to 11011111
+            // [U+0080; U+07FF]
             sequenceBytes = 1;
-            if(unicodeFound != nullptr)
-            {
-                *unicodeFound = true;
-            }
         }
-        else if((charUtf8 >= 0xE0U) && (charUtf8 <= 0xEFU))
+        else if((lead >= 0xE0U) && (lead <= 0xEFU))
         {
-            // 16-bit Unicode code point ([U+00000800; U+00000FFFF]) => 3 bytes
-            // Sequence 11100000 to 11101111
+            // [U+0800; U+FFFF], without overlong forms and UTF-16 surrogates
             sequenceBytes = 2;
-            if(unicodeFound != nullptr)
+            if(lead == 0xE0U)
+            {
+                nextMin = 0xA0U;
+            }
+            else if(lead == 0xEDU)
             {
-                *unicodeFound = true;
+                nextMax = 0x9FU;
             }
         }
-        else if((charUtf8 >= 0xF0U) && (charUtf8 <= 0xF7U))
+        else if((lead >= 0xF0U) && (lead <= 0xF4U))
         {
-            // 21-bit Unicode code point ([U+00010000; U+0001FFFFF]) => 3 bytes
-            // Sequence 11110000 to 11110111
+            // [U+10000; U+10FFFF], without overlong forms
             sequenceBytes = 3;
-            if(unicodeFound != nullptr)
+            if(lead == 0xF0U)
             {
-                *unicodeFound = true;
+                nextMin = 0x90U;
             }
-        }
-        else if((charUtf8 >= 0xF8U) && (charUtf8 <= 0xFBU))
-        {
-            // 26-bit Unicode code point ([U+00010000; U+0001FFFFF]) => 4 bytes
-            // Sequence 11111000 to 11111011
-            sequenceBytes = 4;
-            if(unicodeFound != nullptr)
+            else if(lead == 0xF4U)
             {
-                *unicodeFound = true;
+                nextMax = 0x8FU;
             }
         }
-        else if((charUtf8 >= 0xFCU) && (charUtf8 <= 0xFDU))
+        else
         {
-            // 26-bit Unicode code point ([U+200000; U+3FFFFFF]) => 5 bytes
-            // Sequence 11111100 to 11111101
-            sequenceBytes = 5;
-            if(unicodeFound != nullptr)
-            {
-                *unicodeFound = true;
-            }
+            // Next code unit, overlong 2 bytes lead (0xC0, 0xC1) or invalid lead (> 0xF4)
+            return i;
+        }
 
-            // Invalid sequence
-            return false;
+        if(i + sequenceBytes >= length)
+        {
+            // Truncated sequence
+            return i;
+        }
+        if((pUtf8[i + 1] < nextMin) || (pUtf8[i + 1] > nextMax))
+        {
+            return i;
         }
-        else if((charUtf8 >= 0xFEU) && (charUtf8 <= 0xFDU))
+        for(size_t j = 2; j <= sequenceBytes; ++j)
         {
-            // 26-bit Unicode code point ([U+4000000; U+7FFFFFFF]) => 6 bytes
-            // Sequence 11111110 to 11111111
-            sequenceBytes = 6;
-            if(unicodeFound != nullptr)
+            if((pUtf8[i + j] & 0xC0U) != 0x80U)
             {
-                *unicodeFound = true;
+                return i;
             }
+        }
 
-            // Invalid sequence
-            return false;
+        i += sequenceBytes + 1;
+    }
+
+    return length;
+}
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSSE3)
+/* Error classes of the UTF-8 blocks validator, for a code unit and the one before it */
+// Lead followed by a non-next code unit
+#define UTF8_ERROR_TOO_SHORT        (1 << 0)
+// ASCII followed by a next code unit
+#define UTF8_ERROR_TOO_LONG         (1 << 1)
+// 0xE0 followed by [0x80; 0x9F]
+#define UTF8_ERROR_OVERLONG_3       (1 << 2)
+// 0xF4 followed by [0x90; 0xBF], or [0xF5; 0xFF] followed by a next code unit
+#define UTF8_ERROR_TOO_LARGE        (1 << 3)
+// 0xED followed by [0xA0; 0xBF]
+#define UTF8_ERROR_SURROGATE        (1 << 4)
+// 0xC0 or 0xC1 followed by a next code unit
+#define UTF8_ERROR_OVERLONG_2       (1 << 5)
+// [0xF5; 0xFF] followed by [0x80; 0x8F]
+#define UTF8_ERROR_TOO_LARGE_1000   (1 << 6)
+// 0xF0 followed by [0x80; 0x8F]
+#define UTF8_ERROR_OVERLONG_4       (1 << 6)
+// Next code unit followed by a next code unit (valid only inside 3 and 4 bytes sequences)
+#define UTF8_ERROR_TWO_NEXTS        (1 << 7)
+#define UTF8_ERROR_CARRY            (UTF8_ERROR_TOO_SHORT | UTF8_ERROR_TOO_LONG | UTF8_ERROR_TWO_NEXTS)
+
+/* Lookup tables of the error classes, by nibble */
+// By the high nibble of the previous code unit
+#define UTF8_ERROR_TABLE_LEAD_HIGH                                                                          \
+    UTF8_ERROR_TOO_LONG, UTF8_ERROR_TOO_LONG, UTF8_ERROR_TOO_LONG, UTF8_ERROR_TOO_LONG,                     \
+    UTF8_ERROR_TOO_LONG, UTF8_ERROR_TOO_LONG, UTF8_ERROR_TOO_LONG, UTF8_ERROR_TOO_LONG,                     \
+    UTF8_ERROR_TWO_NEXTS, UTF8_ERROR_TWO_NEXTS, UTF8_ERROR_TWO_NEXTS, UTF8_ERROR_TWO_NEXTS,                 \
+    UTF8_ERROR_TOO_SHORT | UTF8_ERROR_OVERLONG_2,                                                           \
+    UTF8_ERROR_TOO_SHORT,                                                                                   \
+    UTF8_ERROR_TOO_SHORT | UTF8_ERROR_OVERLONG_3 | UTF8_ERROR_SURROGATE,                                    \
+    UTF8_ERROR_TOO_SHORT | UTF8_ERROR_TOO_LARGE | UTF8_ERROR_TOO_LARGE_1000 | UTF8_ERROR_OVERLONG_4
+// By the low nibble of the previous code unit
+#define UTF8_ERROR_TABLE_LEAD_LOW                                                                           \
+    UTF8_ERROR_CARRY | UTF8_ERROR_OVERLONG_3 | UTF8_ERROR_OVERLONG_2 | UTF8_ERROR_OVERLONG_4,                \
+    UTF8_ERROR_CARRY | UTF8_ERROR_OVERLONG_2,                                                               \
+    UTF8_ERROR_CARRY,                                                                                       \
+    UTF8_ERROR_CARRY,                                                                                       \
+    UTF8_ERROR_CARRY | UTF8_ERROR_TOO_LARGE,                                                                \
+    UTF8_ERROR_CARRY | UTF8_ERROR_TOO_LARGE | UTF8_ERROR_TOO_LARGE_1000,                                    \
+    UTF8_ERROR_CARRY | UTF8_ERROR_TOO_LARGE | UTF8_ERROR_TOO_LARGE_1000,                                    \
+    UTF8_ERROR_CARRY | UTF8_ERROR_TOO_LARGE | UTF8_ERROR_TOO_LARGE_1000,                                    \
+    UTF8_ERROR_CARRY | UTF8_ERROR_TOO_LARGE | UTF8_ERROR_TOO_LARGE_1000,                                    \
+    UTF8_ERROR_CARRY | UTF8_ERROR_TOO_LARGE | UTF8_ERROR_TOO_LARGE_1000,                                    \
+    UTF8_ERROR_CARRY | UTF8_ERROR_TOO_LARGE | UTF8_ERROR_TOO_LARGE_1000,                                    \
+    UTF8_ERROR_CARRY | UTF8_ERROR_TOO_LARGE | UTF8_ERROR_TOO_LARGE_1000,                                    \
+    UTF8_ERROR_CARRY | UTF8_ERROR_TOO_LARGE | UTF8_ERROR_TOO_LARGE_1000,                                    \
+    UTF8_ERROR_CARRY | UTF8_ERROR_TOO_LARGE | UTF8_ERROR_TOO_LARGE_1000 | UTF8_ERROR_SURROGATE,             \
+    UTF8_ERROR_CARRY | UTF8_ERROR_TOO_LARGE | UTF8_ERROR_TOO_LARGE_1000,                                    \
+    UTF8_ERROR_CARRY | UTF8_ERROR_TOO_LARGE | UTF8_ERROR_TOO_LARGE_1000
+// By the high nibble of the current code unit
+#define UTF8_ERROR_TABLE_NEXT_HIGH                                                                          \
+    UTF8_ERROR_TOO_SHORT, UTF8_ERROR_TOO_SHORT, UTF8_ERROR_TOO_SHORT, UTF8_ERROR_TOO_SHORT,                 \
+    UTF8_ERROR_TOO_SHORT, UTF8_ERROR_TOO_SHORT, UTF8_ERROR_TOO_SHORT, UTF8_ERROR_TOO_SHORT,                 \
+    UTF8_ERROR_TOO_LONG | UTF8_ERROR_OVERLONG_2 | UTF8_ERROR_TWO_NEXTS | UTF8_ERROR_OVERLONG_3 |            \
+        UTF8_ERROR_TOO_LARGE_1000 | UTF8_ERROR_OVERLONG_4,                                                  \
+    UTF8_ERROR_TOO_LONG | UTF8_ERROR_OVERLONG_2 | UTF8_ERROR_TWO_NEXTS | UTF8_ERROR_OVERLONG_3 |            \
+        UTF8_ERROR_TOO_LARGE,                                                                               \
+    UTF8_ERROR_TOO_LONG | UTF8_ERROR_OVERLONG_2 | UTF8_ERROR_TWO_NEXTS | UTF8_ERROR_SURROGATE |             \
+        UTF8_ERROR_TOO_LARGE,                                                                               \
+    UTF8_ERROR_TOO_LONG | UTF8_ERROR_OVERLONG_2 | UTF8_ERROR_TWO_NEXTS | UTF8_ERROR_SURROGATE |             \
+        UTF8_ERROR_TOO_LARGE,                                                                               \
+    UTF8_ERROR_TOO_SHORT, UTF8_ERROR_TOO_SHORT, UTF8_ERROR_TOO_SHORT, UTF8_ERROR_TOO_SHORT
+#endif
+
+/**
+ * Validates the leading blocks of an UTF-8 string with SIMD instructions, classifying each code unit
+ * and the one before it by nibble with byte shuffle lookup tables (SSSE3 or AVX2), and stops at the
+ * first block with an error.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String		the UTF-8 code units to be validated
+ * @param	length			the number of UTF-8 code units
+ * @param	nonAsciiFound	receives 'true' if non-ASCII code units were found in the validated blocks
+ * @return	'length' if the string is valid, otherwise the offset of a sequence boundary at most 3 code
+ *          units before the block with the first error (0 without SIMD instructions)
+ * @since	1.0
+ */
+size_t CodePage2Unicode::validateUtf8Blocks(const char* utf8String, const size_t length, bool& nonAsciiFound)
+{
+    nonAsciiFound = false;
+
+    size_t i = 0;
+    bool valid = true;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    const __m256i vecTableLeadHigh = _mm256_setr_epi8(UTF8_ERROR_TABLE_LEAD_HIGH, UTF8_ERROR_TABLE_LEAD_HIGH);
+    const __m256i vecTableLeadLow = _mm256_setr_epi8(UTF8_ERROR_TABLE_LEAD_LOW, UTF8_ERROR_TABLE_LEAD_LOW);
+    const __m256i vecTableNextHigh = _mm256_setr_epi8(UTF8_ERROR_TABLE_NEXT_HIGH, UTF8_ERROR_TABLE_NEXT_HIGH);
+    const __m256i vecNibbleMask = _mm256_set1_epi8(0x0F);
+    // Code units that must be followed by at least 1, 2 or 3 next code units (incomplete at the block end)
+    const __m256i vecIncompleteMax = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        static_cast<char>(0xF0U - 1), static_cast<char>(0xE0U - 1), static_cast<char>(0xC0U - 1));
+    __m256i vecPrevious = _mm256_setzero_si256();
+    __m256i vecPreviousIncomplete = _mm256_setzero_si256();
+    __m256i vecNonAscii = _mm256_setzero_si256();
+
+    for(; i + 32 <= length; i += 32)
+    {
+        __m256i vecInput = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(utf8String + i));
+        __m256i vecError;
+        if(_mm256_movemask_epi8(vecInput) == 0)
+        {
+            // 7-bit ASCII block, only the previous block can be incomplete
+            vecError = vecPreviousIncomplete;
         }
         else
         {
-            // Invalid sequence
-            return false;
+            vecNonAscii = _mm256_or_si256(vecNonAscii, vecInput);
+
+            // The input shifted right by 1, 2 and 3 code units, with the end of the previous block
+            __m256i vecShifted = _mm256_permute2x128_si256(vecPrevious, vecInput, 0x21);
+            __m256i vecPrevious1 = _mm256_alignr_epi8(vecInput, vecShifted, 16 - 1);
+            __m256i vecPrevious2 = _mm256_alignr_epi8(vecInput, vecShifted, 16 - 2);
+            __m256i vecPrevious3 = _mm256_alignr_epi8(vecInput, vecShifted, 16 - 3);
+
+            // Errors of each pair of code units
+            __m256i vecLeadHigh = _mm256_shuffle_epi8(vecTableLeadHigh, _mm256_and_si256(_mm256_srli_epi16(vecPrevious1, 4), vecNibbleMask));
+            __m256i vecLeadLow = _mm256_shuffle_epi8(vecTableLeadLow, _mm256_and_si256(vecPrevious1, vecNibbleMask));
+            __m256i vecNextHigh = _mm256_shuffle_epi8(vecTableNextHigh, _mm256_and_si256(_mm256_srli_epi16(vecInput, 4), vecNibbleMask));
+            __m256i vecSpecialCases = _mm256_and_si256(_mm256_and_si256(vecLeadHigh, vecLeadLow), vecNextHigh);
+
+            // Next code units must follow 3 and 4 bytes leads 2 and 3 positions before
+            __m256i vecThirdByte = _mm256_subs_epu8(vecPrevious2, _mm256_set1_epi8(static_cast<char>(0xE0U - 0x80U)));
+            __m256i vecFourthByte = _mm256_subs_epu8(vecPrevious3, _mm256_set1_epi8(static_cast<char>(0xF0U - 0x80U)));
+            __m256i vecMustBeNext = _mm256_and_si256(_mm256_or_si256(vecThirdByte, vecFourthByte), _mm256_set1_epi8(static_cast<char>(0x80U)));
+
+            vecError = _mm256_xor_si256(vecMustBeNext, vecSpecialCases);
+            vecPreviousIncomplete = _mm256_subs_epu8(vecInput, vecIncompleteMax);
         }
 
-        // Next byte
-        ++i;
+        if(!_mm256_testz_si256(vecError, vecError))
+        {
+            valid = false;
+            break;
+        }
+        vecPrevious = vecInput;
+    }
 
-        // Check if the surrogate is valid
-        while((i < utf8Lenght) && (sequenceBytes > 0) &&
-              (charUtf8 >= 0x80U) && (charUtf8 <= 0xFFU))
+    if(valid && (i < length))
+    {
+        // Validate the last partial block padded with zeros (ASCII), so incomplete sequences are errors
+        char arrLast[32] = {
+            0
+        };
+        memcpy(arrLast, utf8String + i, length - i);
+
+        __m256i vecInput = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(arrLast));
+        vecNonAscii = _mm256_or_si256(vecNonAscii, vecInput);
+        __m256i vecShifted = _mm256_permute2x128_si256(vecPrevious, vecInput, 0x21);
+        __m256i vecPrevious1 = _mm256_alignr_epi8(vecInput, vecShifted, 16 - 1);
+        __m256i vecPrevious2 = _mm256_alignr_epi8(vecInput, vecShifted, 16 - 2);
+        __m256i vecPrevious3 = _mm256_alignr_epi8(vecInput, vecShifted, 16 - 3);
+        __m256i vecLeadHigh = _mm256_shuffle_epi8(vecTableLeadHigh, _mm256_and_si256(_mm256_srli_epi16(vecPrevious1, 4), vecNibbleMask));
+        __m256i vecLeadLow = _mm256_shuffle_epi8(vecTableLeadLow, _mm256_and_si256(vecPrevious1, vecNibbleMask));
+        __m256i vecNextHigh = _mm256_shuffle_epi8(vecTableNextHigh, _mm256_and_si256(_mm256_srli_epi16(vecInput, 4), vecNibbleMask));
+        __m256i vecSpecialCases = _mm256_and_si256(_mm256_and_si256(vecLeadHigh, vecLeadLow), vecNextHigh);
+        __m256i vecThirdByte = _mm256_subs_epu8(vecPrevious2, _mm256_set1_epi8(static_cast<char>(0xE0U - 0x80U)));
+        __m256i vecFourthByte = _mm256_subs_epu8(vecPrevious3, _mm256_set1_epi8(static_cast<char>(0xF0U - 0x80U)));
+        __m256i vecMustBeNext = _mm256_and_si256(_mm256_or_si256(vecThirdByte, vecFourthByte), _mm256_set1_epi8(static_cast<char>(0x80U)));
+        __m256i vecError = _mm256_xor_si256(vecMustBeNext, vecSpecialCases);
+        valid = (_mm256_testz_si256(vecError, vecError) != 0);
+        vecPreviousIncomplete = _mm256_setzero_si256();
+        if(valid)
         {
-            ++i;
-            --sequenceBytes;
+            i = length;
+        }
+    }
+
+    if(valid && !_mm256_testz_si256(vecPreviousIncomplete, vecPreviousIncomplete))
+    {
+        // The string ends with an incomplete sequence
+        valid = false;
+    }
+
+    nonAsciiFound = (_mm256_movemask_epi8(vecNonAscii) != 0);
+#elif (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSSE3)
+    const __m128i vecTableLeadHigh = _mm_setr_epi8(UTF8_ERROR_TABLE_LEAD_HIGH);
+    const __m128i vecTableLeadLow = _mm_setr_epi8(UTF8_ERROR_TABLE_LEAD_LOW);
+    const __m128i vecTableNextHigh = _mm_setr_epi8(UTF8_ERROR_TABLE_NEXT_HIGH);
+    const __m128i vecNibbleMask = _mm_set1_epi8(0x0F);
+    // Code units that must be followed by at least 1, 2 or 3 next code units (incomplete at the block end)
+    const __m128i vecIncompleteMax = _mm_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        static_cast<char>(0xF0U - 1), static_cast<char>(0xE0U - 1), static_cast<char>(0xC0U - 1));
+    __m128i vecPrevious = _mm_setzero_si128();
+    __m128i vecPreviousIncomplete = _mm_setzero_si128();
+    __m128i vecNonAscii = _mm_setzero_si128();
+    char arrLast[16] = {
+        0
+    };
+
+    while(valid && (i < length))
+    {
+        __m128i vecInput;
+        bool lastBlock = (i + 16 > length);
+        if(lastBlock)
+        {
+            // Pad the last partial block with zeros (ASCII), so incomplete sequences are errors
+            memcpy(arrLast, utf8String + i, length - i);
+            vecInput = _mm_loadu_si128(reinterpret_cast<const __m128i*>(arrLast));
+        }
+        else
+        {
+            vecInput = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8String + i));
         }
 
-        // Invalid sequence
-        if(sequenceBytes != 0)
+        __m128i vecError;
+        if(_mm_movemask_epi8(vecInput) == 0)
         {
-            return false;
+            // 7-bit ASCII block, only the previous block can be incomplete
+            vecError = vecPreviousIncomplete;
+            vecPreviousIncomplete = _mm_setzero_si128();
+        }
+        else
+        {
+            vecNonAscii = _mm_or_si128(vecNonAscii, vecInput);
+
+            // The input shifted right by 1, 2 and 3 code units, with the end of the previous block
+            __m128i vecPrevious1 = _mm_alignr_epi8(vecInput, vecPrevious, 16 - 1);
+            __m128i vecPrevious2 = _mm_alignr_epi8(vecInput, vecPrevious, 16 - 2);
+            __m128i vecPrevious3 = _mm_alignr_epi8(vecInput, vecPrevious, 16 - 3);
+
+            // Errors of each pair of code units
+            __m128i vecLeadHigh = _mm_shuffle_epi8(vecTableLeadHigh, _mm_and_si128(_mm_srli_epi16(vecPrevious1, 4), vecNibbleMask));
+            __m128i vecLeadLow = _mm_shuffle_epi8(vecTableLeadLow, _mm_and_si128(vecPrevious1, vecNibbleMask));
+            __m128i vecNextHigh = _mm_shuffle_epi8(vecTableNextHigh, _mm_and_si128(_mm_srli_epi16(vecInput, 4), vecNibbleMask));
+            __m128i vecSpecialCases = _mm_and_si128(_mm_and_si128(vecLeadHigh, vecLeadLow), vecNextHigh);
+
+            // Next code units must follow 3 and 4 bytes leads 2 and 3 positions before
+            __m128i vecThirdByte = _mm_subs_epu8(vecPrevious2, _mm_set1_epi8(static_cast<char>(0xE0U - 0x80U)));
+            __m128i vecFourthByte = _mm_subs_epu8(vecPrevious3, _mm_set1_epi8(static_cast<char>(0xF0U - 0x80U)));
+            __m128i vecMustBeNext = _mm_and_si128(_mm_or_si128(vecThirdByte, vecFourthByte), _mm_set1_epi8(static_cast<char>(0x80U)));
+
+            vecError = _mm_xor_si128(vecMustBeNext, vecSpecialCases);
+            vecPreviousIncomplete = _mm_subs_epu8(vecInput, vecIncompleteMax);
+        }
+
+        if(_mm_movemask_epi8(_mm_cmpeq_epi8(vecError, _mm_setzero_si128())) != 0xFFFF)
+        {
+            valid = false;
+        }
+        else
+        {
+            vecPrevious = vecInput;
+            i = lastBlock ? length : (i + 16);
         }
     }
 
-    return true;
+    if(valid && (_mm_movemask_epi8(_mm_cmpeq_epi8(vecPreviousIncomplete, _mm_setzero_si128())) != 0xFFFF))
+    {
+        // The string ends with an incomplete sequence
+        valid = false;
+    }
+
+    nonAsciiFound = (_mm_movemask_epi8(vecNonAscii) != 0);
+#else
+    valid = (length == 0);
+#endif
+
+    if(valid)
+    {
+        return length;
+    }
+
+    // Back to the start of the sequence that may continue into the invalid block
+    size_t start = i;
+    for(size_t j = 1; (j <= 3) && (j <= i); ++j)
+    {
+        unsigned char codeUnit = static_cast<unsigned char>(utf8String[i - j]);
+        if(codeUnit < 0x80U)
+        {
+            break;
+        }
+        if(codeUnit >= 0xC0U)
+        {
+            start = i - j;
+            break;
+        }
+    }
+
+    return start;
 }
 
 bool CodePage2Unicode::hasUtf7Bom(const string& str)
@@ -511,16 +924,20 @@ bool CodePage2Unicode::hasUtf7Bom(const string& str)
 
     bool bRet = true;
 
-    size_t iLen = (sizeof(BOM_UTF7) / sizeof(BOM_UTF7[0]));
+    // The UTF-7 BOM is "+/v" followed by the first base64 character with the next 2 bits of the
+    // text, one of '8', '9', '+' or '/'
+    size_t iLen = 4;
     if(str.length() >= iLen)
     {
-        for(size_t i = 0; i < iLen; ++i)
+        for(size_t i = 0; i < (iLen - 1); ++i)
         {
-            if(str.at(i) != BOM_UTF8[i])
+            if(str.at(i) != BOM_UTF7[i])
             {
                 return false;
             }
         }
+        char lastChar = str.at(iLen - 1);
+        bRet = ((lastChar == '8') || (lastChar == '9') || (lastChar == '+') || (lastChar == '/'));
     }
     else
     {
@@ -675,1146 +1092,6693 @@ string CodePage2Unicode::removeUtf8Bom(const string& str)
     return strRer;
 }
 
-
-CodePage CodePage2Unicode::getDefaultNarrowCodePage(void)
-{
-	CodePage retCP = CodePage::UNKNOWN;
-	string strLocale(locale().name());
-	if(strLocale.compare("") != 0)
-	{
-#if defined(_WIN32) || defined(_WIN64) || defined(_WIN32_WCE)
-		// Windows-1252, the default for latin based Windows OS
-#	if !defined(_CONSOLE)
-		retCP = static_cast<CodePage>(::GetOEMCP());
-#	else
-		retCP = static_cast<CodePage>(::GetACP());
-#	endif
-#else
-		// UTF-8
-		retCP = CodePage::UTF_8;
-#endif
-	}
-	else if((strLocale.compare("C") != 0) || (strLocale.compare("POSIX") != 0))
-	{
-		// US-ASCII
-		retCP = CodePage::US_ASCII;
-	}
-	else if((strLocale.find(".ISO-8859-15") != string::npos) || (strLocale.find(".28605") != string::npos))
-	{
-		// ISO-8859-15: ISO Latin 9; Western European + Finnish + French + € (same as ISO-8859-1, but with 8 replaced characters like the € insted of ¤)
-		retCP = CodePage::ISO_8859_15;
-	}
-	else if((strLocale.find(".ISO-8859-7") != string::npos) || (strLocale.find(".28597") != string::npos))
-	{
-		// ISO-8859-7: ISO Greek; Greek + €
-		retCP = CodePage::ISO_8859_7;
-	}
-	else if((strLocale.find(".ISO-8859-1") != string::npos) || (strLocale.find(".28591") != string::npos))
-	{
-		// ISO-8859-1: ISO Latin 1; ANSI Western European
-		retCP = CodePage::ISO_8859_1;
-	}
-	else if((strLocale.find(".x-mac-roman") != string::npos) || (strLocale.find(".MacRoman") != string::npos) || (strLocale.find(".Macintosh") != string::npos) || (strLocale.find(".10000") != string::npos))
-	{
-		// MacRoman: Macintosh Latin 1; Mac Western European
-		retCP = CodePage::MAC_ROMAN;
-	}
-	else if((strLocale.find(".x-mac-greek") != string::npos) || (strLocale.find(".MacGreek") != string::npos) || (strLocale.find(".10006") != string::npos))
-	{
-		// MacRoman: Macintosh Latin 1; Mac Western European
-		retCP = CodePage::MAC_GREEK;
-	}
-	else if((strLocale.find(".Windows-1252") != string::npos) || (strLocale.find(".CP1252") != string::npos) || (strLocale.find(".1252") != string::npos))
-	{
-		// Windows-1252: ANSI Latin 1 + €; Windows Western European (same as ISO-8859-1, but with more printing characters insted of control codes defined like the €)
-		retCP = CodePage::WINDOWS_1252;
-	}
-	else if((strLocale.find(".Windows-1253") != string::npos) || (strLocale.find(".CP1253") != string::npos) || (strLocale.find(".1253") != string::npos))
-	{
-		// Windows-1253: Greek + €
-		retCP = CodePage::WINDOWS_1252;
-	}
-	else if((strLocale.find(".US-ASCII") != string::npos) || (strLocale.find(".CP367") != string::npos) || (strLocale.find(".20127") != string::npos))
-	{
-		// IBM437: OEM USA; DOS USA
-		retCP = CodePage::US_ASCII;
-	}
-	else if((strLocale.find(".CP437") != string::npos) || (strLocale.find(".437") != string::npos))
-	{
-		// IBM437: OEM USA; DOS USA
-		retCP = CodePage::DOS_CP437;
-	}
-	else if((strLocale.find(".CP737") != string::npos) || (strLocale.find(".737") != string::npos))
-	{
-		// IBM737: OEM Greek; DOS Greek
-		retCP = CodePage::DOS_CP737;
-	}
-	else if((strLocale.find(".CP850") != string::npos) || (strLocale.find(".850") != string::npos))
-	{
-		// IBM850: OEM Multilingual Latin 1; DOS Western European
-		retCP = CodePage::DOS_CP850;
-	}
-	else if((strLocale.find(".CP851") != string::npos) || (strLocale.find(".851") != string::npos))
-	{
-		// IBM851: OEM Greek 1; DOS Greek 1
-		retCP = CodePage::DOS_CP851;
-	}
-	else if((strLocale.find(".CP858") != string::npos) || (strLocale.find(".858") != string::npos))
-	{
-		// IBM858: OEM Multilingual Latin 1  + €; DOS Western European + € (same as IBM850, but with € insted of ı)
-		retCP = CodePage::DOS_CP858;
-	}
-	else if((strLocale.find(".CP859") != string::npos) || (strLocale.find(".859") != string::npos))
-	{
-		// IBM859: OEM Latin 9  + €; DOS Western European + Finnish + French + €
-		retCP = CodePage::DOS_CP859;
-	}
-	else if((strLocale.find(".CP860") != string::npos) || (strLocale.find(".860") != string::npos))
-	{
-		// IBM860: OEM Portuguese; DOS Portuguese
-		retCP = CodePage::DOS_CP860;
-	}
-	else if((strLocale.find(".CP869") != string::npos) || (strLocale.find(".869") != string::npos))
-	{
-		// IBM869: OEM Greek 2; DOS Greek 2
-		retCP = CodePage::DOS_CP869;
-	}
-	else if((strLocale.find(".UTF-8") != string::npos) || (strLocale.find(".utf8") != string::npos) || (strLocale.find(".65001") != string::npos))
-	{
-		// UTF-8
-		retCP = CodePage::UTF_8;
-	}
-	
-	return retCP;
-}
-
 /**
- * Converts a 8-bit extended ASCII character from a given code page to the equivalent UTF-32 code point,
- * based on it's' code page and if control codes less or equal to 127 are to be converted.
+ * Detects the encoding of a byte buffer, checking the BOMs (Byte Order Markers) of all the Unicode
+ * encodings against its first bytes and, when there's none, validating the buffer as UTF-8 with
+ * SIMD instructions when available.<br />
+ * The BOM isn't copied nor removed, the payload is the view that starts at the header length.
+ * An UTF-7 BOM shares its last base64 character with the text, unless it's closed by a '-', so
+ * only the "+/v8-" form is counted in the header length.<br />
+ * The buffer may be the prefix of a longer stream, so an incomplete UTF-8 sequence at its end
+ * doesn't prevent the detection.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	narrowChar			the ASCII character [0; 255] to be converted
- * @param	codePage			the code page from CodePage enumeration that the narrow character belongs to
- * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
- *                              also converts ASCII control codes [0; 31, 127] to Unicode
- * @return	the equivalent UTF-32 code point
+ * @param	buffer	the bytes to be checked
+ * @param	length	the number of bytes
+ * @return	the detected code page, the BOM length and the byte order of the code units
  * @since	1.0
  */
-char32_t CodePage2Unicode::convertCharAscii_to_CharUtf32(const char narrowChar, const CodePage codePage, const bool convertAsciiControl)
+EncodingDetectionResult CodePage2Unicode::detectEncoding(const void* buffer, const size_t length)
 {
-    char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
-
     // Validate parameters
-#if defined(_DEBUG)
-    assert((code >= 0) && (code <= 255));
-#endif
+    assert((buffer != nullptr) || (length == 0));
 
-    // Standard ISO/ANSI ASCII
-    if(code <= 127)
+    const unsigned char* pBytes = static_cast<const unsigned char*>(buffer);
+    EncodingDetectionResult objResult = {CodePage::UNKNOWN, 0, false};
+
+    // The first byte tells which BOM may follow, the UTF-32 LE BOM starts with the UTF-16 LE BOM
+    if(length >= 2)
     {
-        if(convertAsciiControl)
+        switch(pBytes[0])
         {
-            if((codePage == CodePage::DOS_CP437) ||
-               (codePage == CodePage::DOS_CP737) ||
-               (codePage == CodePage::DOS_CP850) ||
-               (codePage == CodePage::DOS_CP858) ||
-               (codePage == CodePage::DOS_CP859) ||
-               (codePage == CodePage::DOS_CP860))
+        case 0xEFU:
+            if((length >= sizeof(BOM_UTF8)) && (memcmp(pBytes, BOM_UTF8, sizeof(BOM_UTF8)) == 0))
             {
-                // MS-DOS extensions
-                return convertDOS_ASCII_To_Unicode((char)code);
+                objResult.codePage = CodePage::UTF_8;
+                objResult.headerLength = sizeof(BOM_UTF8);
+                return objResult;
             }
-            else if((codePage == CodePage::MAC_ROMAN) ||
-                    (codePage == CodePage::MAC_GREEK))
+            break;
+        case 0xFFU:
+            if(pBytes[1] == 0xFEU)
             {
-                // MacOS extensions
-                return convertMac_ASCII_To_Unicode((char)code);
+                if((length >= 4) && (pBytes[2] == 0x00U) && (pBytes[3] == 0x00U))
+                {
+                    objResult.codePage = CodePage::UTF_32;
+                    objResult.headerLength = 4;
+                }
+                else
+                {
+                    objResult.codePage = CodePage::UTF_16;
+                    objResult.headerLength = 2;
+                }
+                return objResult;
             }
-        }
-        // else
-        return convertASCII_To_Unicode((char)code);
-    }
-    // else
-    // Extended ASCII
-    switch(codePage)
-    {
-		// US_ASCII, IBM367, cp367, 367 - Code page IBM 367, MS-DOS US-ASCII
-        case CodePage::US_ASCII:
-            return convertDOS_CP367_To_Unicode((char)code);
-            break;
-
-        // IBM437, cp437, 437 - Code page IBM 437, MS-DOS Latin US (English, Western Europe)
-        case CodePage::DOS_CP437:
-            return convertDOS_CP437_To_Unicode((char)code);
             break;
-
-        // IBM737, cp737, 737 - Code page IBM 737, MS-DOS Greek (Greek, English)
-        case CodePage::DOS_CP737:
-            return convertDOS_CP737_To_Unicode((char)code);
+        case 0xFEU:
+            if(pBytes[1] == 0xFFU)
+            {
+                objResult.codePage = CodePage::UTF_16;
+                objResult.headerLength = 2;
+                objResult.bigEndian = true;
+                return objResult;
+            }
             break;
-
-        // IBM850, cp850, 850 - Code page IBM 850, MS-DOS Latin-1/Multilingual (Latin-1, Western Europe)
-        case CodePage::DOS_CP850:
-            return convertDOS_CP850_To_Unicode((char)code);
+        case 0x00U:
+            if((length >= 4) && (pBytes[1] == 0x00U) && (pBytes[2] == 0xFEU) && (pBytes[3] == 0xFFU))
+            {
+                objResult.codePage = CodePage::UTF_32;
+                objResult.headerLength = 4;
+                objResult.bigEndian = true;
+                return objResult;
+            }
             break;
-
-        // IBM858, cp858@euro, 858 - Code page IBM 858, MS-DOS Latin-1/Multilingual with € (Latin-1, Western Europe, €)
-        case CodePage::DOS_CP858:
-            return convertDOS_CP858_To_Unicode((char)code);
+        case 0x2BU:
+            if((length >= 4) && (memcmp(pBytes, BOM_UTF7, 3) == 0)
+               && ((pBytes[3] == '8') || (pBytes[3] == '9') || (pBytes[3] == '+') || (pBytes[3] == '/')))
+            {
+                objResult.codePage = CodePage::UTF_7;
+                if((length >= sizeof(BOM_UTF7)) && (memcmp(pBytes, BOM_UTF7, sizeof(BOM_UTF7)) == 0))
+                {
+                    objResult.headerLength = sizeof(BOM_UTF7);
+                }
+                return objResult;
+            }
             break;
-
-        // IBM859, cp859@euro, 859 - Code page IBM 859, MS-DOS Latin-9 (Latin-9, Latin-1, Western Europe, €)
-        case CodePage::DOS_CP859:
-            return convertDOS_CP859_To_Unicode((char)code);
+        default:
             break;
+        }
+    }
 
-        // IBM860, cp860, 860 - Code page IBM 860, MS-DOS Portuguese (Portuguese, Western Europe)
-        case CodePage::DOS_CP860:
-            return convertDOS_CP860_To_Unicode((char)code);
-            break;
+    // No BOM, validate as UTF-8
+    const char* pChars = static_cast<const char*>(buffer);
+    bool nonAsciiFound = false;
+    size_t errorOffset = length;
+    if(!isUtf8(pChars, length, &nonAsciiFound, &errorOffset))
+    {
+        // Only an incomplete sequence at the end of the buffer is accepted, when it's completed to a
+        // valid sequence by the lowest or by the highest next code units
+        size_t tailLength = length - errorOffset;
+        size_t sequenceLength = getCodeUnitsForUtf8Leads(pChars[errorOffset]);
+        if((sequenceLength <= 1) || (tailLength >= sequenceLength))
+        {
+            return objResult;
+        }
+        char arrLowest[4];
+        char arrHighest[4];
+        memcpy(arrLowest, pChars + errorOffset, tailLength);
+        memcpy(arrHighest, pChars + errorOffset, tailLength);
+        for(size_t i = tailLength; i < sequenceLength; ++i)
+        {
+            arrLowest[i] = UTF8_NEXT;
+            arrHighest[i] = (char)0xBFU;
+        }
+        if((validateUtf8(arrLowest, sequenceLength, 0) != sequenceLength)
+           && (validateUtf8(arrHighest, sequenceLength, 0) != sequenceLength))
+        {
+            return objResult;
+        }
+        nonAsciiFound = true;
+    }
+    objResult.codePage = nonAsciiFound ? CodePage::UTF_8 : CodePage::US_ASCII;
 
-        // macintosh@euro, mac, MacRoman, 10000 - Code page Apple Macintosh, Mac OS Latin-1/Roman (Latin-1, Western Europe, €)
-        case CodePage::MAC_ROMAN:
-            return convertMac_Roman_To_Unicode((char)code);
-            break;
+    return objResult;
+}
 
-        // x-mac-greek, MacGreek, 10006 - Code page Apple Macintosh, Mac OS Greek (Greek, English)
-        case CodePage::MAC_GREEK:
-            return convertMac_Greek_To_Unicode((char)code);
-            break;
 
-        // windows-1252@euro, 1252 - Code page Microsoft Windows 1252, Windows Latin-1/Western Europe (Latin-1, Western Europe, €)
-        case CodePage::WINDOWS_1252:
-            return convertWindows_1252_To_Unicode((char)code);
-            break;
+/**
+ * The cached code page of the narrow character strings, resolved on first use.
+ */
+#if defined(__HAS_INCLUDE_ATOMIC)
+atomic<unsigned int> CodePage2Unicode::m_defaultNarrowCodePage(DEFAULT_CODEPAGE_UNRESOLVED);
+#else
+volatile unsigned int CodePage2Unicode::m_defaultNarrowCodePage = DEFAULT_CODEPAGE_UNRESOLVED;
+#endif
 
-        // windows-1253@euro, 1253 - Code page Microsoft Windows 1253, Windows Greek (Greek, English, €)
-        case CodePage::WINDOWS_1253:
-            return convertWindows_1253_To_Unicode((char)code);
-            break;
+// The known character set names, normalized (lowercase, without separators)
+const CodePage2Unicode::CharsetName CodePage2Unicode::m_arrCharsetNames[CHARSET_NAME_COUNT] = {
+    {"ansix3.41968", CodePage::US_ASCII}, {"ascii", CodePage::US_ASCII}, {"usascii", CodePage::US_ASCII},
+    {"646", CodePage::US_ASCII}, {"cp367", CodePage::US_ASCII}, {"ibm367", CodePage::US_ASCII}, {"20127", CodePage::US_ASCII},
+    {"cp437", CodePage::DOS_CP437}, {"ibm437", CodePage::DOS_CP437}, {"437", CodePage::DOS_CP437},
+    {"cp737", CodePage::DOS_CP737}, {"ibm737", CodePage::DOS_CP737}, {"737", CodePage::DOS_CP737},
+    {"cp850", CodePage::DOS_CP850}, {"ibm850", CodePage::DOS_CP850}, {"850", CodePage::DOS_CP850},
+    {"cp851", CodePage::DOS_CP851}, {"ibm851", CodePage::DOS_CP851}, {"851", CodePage::DOS_CP851},
+    {"cp858", CodePage::DOS_CP858}, {"ibm858", CodePage::DOS_CP858}, {"858", CodePage::DOS_CP858},
+    {"cp859", CodePage::DOS_CP859}, {"ibm859", CodePage::DOS_CP859}, {"859", CodePage::DOS_CP859},
+    {"cp860", CodePage::DOS_CP860}, {"ibm860", CodePage::DOS_CP860}, {"860", CodePage::DOS_CP860},
+    {"cp869", CodePage::DOS_CP869}, {"ibm869", CodePage::DOS_CP869}, {"869", CodePage::DOS_CP869},
+    {"macroman", CodePage::MAC_ROMAN}, {"xmacroman", CodePage::MAC_ROMAN}, {"macintosh", CodePage::MAC_ROMAN}, {"10000", CodePage::MAC_ROMAN},
+    {"macgreek", CodePage::MAC_GREEK}, {"xmacgreek", CodePage::MAC_GREEK}, {"10006", CodePage::MAC_GREEK},
+    {"windows1252", CodePage::WINDOWS_1252}, {"cp1252", CodePage::WINDOWS_1252}, {"1252", CodePage::WINDOWS_1252},
+    {"windows1253", CodePage::WINDOWS_1253}, {"cp1253", CodePage::WINDOWS_1253}, {"1253", CodePage::WINDOWS_1253},
+    {"shiftjis", CodePage::WINDOWS_932}, {"sjis", CodePage::WINDOWS_932}, {"windows31j", CodePage::WINDOWS_932}, {"mskanji", CodePage::WINDOWS_932},
+    {"cp932", CodePage::WINDOWS_932}, {"ms932", CodePage::WINDOWS_932}, {"932", CodePage::WINDOWS_932},
+    {"gbk", CodePage::WINDOWS_936}, {"gb2312", CodePage::WINDOWS_936}, {"euccn", CodePage::WINDOWS_936}, {"cp936", CodePage::WINDOWS_936},
+    {"ms936", CodePage::WINDOWS_936}, {"936", CodePage::WINDOWS_936},
+    {"euckr", CodePage::WINDOWS_949}, {"ksc56011987", CodePage::WINDOWS_949}, {"uhc", CodePage::WINDOWS_949}, {"cp949", CodePage::WINDOWS_949},
+    {"949", CodePage::WINDOWS_949},
+    {"big5", CodePage::WINDOWS_950}, {"cp950", CodePage::WINDOWS_950}, {"950", CodePage::WINDOWS_950},
+    {"iso88591", CodePage::ISO_8859_1}, {"latin1", CodePage::ISO_8859_1}, {"28591", CodePage::ISO_8859_1},
+    {"iso88597", CodePage::ISO_8859_7}, {"greek", CodePage::ISO_8859_7}, {"28597", CodePage::ISO_8859_7},
+    {"iso885915", CodePage::ISO_8859_15}, {"latin9", CodePage::ISO_8859_15}, {"28605", CodePage::ISO_8859_15},
+    {"ibm037", CodePage::EBCDIC_CP037}, {"cp037", CodePage::EBCDIC_CP037}, {"ebcdiccpus", CodePage::EBCDIC_CP037}, {"037", CodePage::EBCDIC_CP037},
+    {"ibm500", CodePage::EBCDIC_CP500}, {"cp500", CodePage::EBCDIC_CP500}, {"ebcdiccpbe", CodePage::EBCDIC_CP500}, {"ebcdiccpch", CodePage::EBCDIC_CP500},
+    {"500", CodePage::EBCDIC_CP500},
+    {"ibm875", CodePage::EBCDIC_CP875}, {"cp875", CodePage::EBCDIC_CP875}, {"875", CodePage::EBCDIC_CP875},
+    {"ibm1047", CodePage::EBCDIC_CP1047}, {"cp1047", CodePage::EBCDIC_CP1047}, {"1047", CodePage::EBCDIC_CP1047},
+    {"utf8", CodePage::UTF_8}, {"65001", CodePage::UTF_8}
+};
 
-        // ISO-8859-1, 28591 - Code page ISO 8859-1, ISO/IEC Latin-1 (Latin-1, Western Europe)
-        case CodePage::ISO_8859_1:
-            return convertISO_8859_1_To_Unicode((char)code);
-            break;
+/**
+ * Perfect hash table of the known character set names, with the index of the name in each slot.
+ * Built once, on first use.
+ */
+struct CodePage2Unicode::CharsetHashTable
+{
+    /**
+     * The index + 1 of the name of each slot in the known names, or 0 for the empty slots.
+     */
+    unsigned char m_arrSlots[CHARSET_HASH_TABLE_SIZE];
 
-        // ISO-8859-7@euro, 28597 - Code page ISO 8859-7, ISO/IEC Greek (Greek, English, €)
-        case CodePage::ISO_8859_7:
-            return convertISO_8859_7_To_Unicode((char)code);
-            break;
+    CharsetHashTable()
+    {
+        memset(m_arrSlots, 0, sizeof(m_arrSlots));
+        for(size_t i = 0; i < CHARSET_NAME_COUNT; ++i)
+        {
+            size_t slot = getCharsetNameSlot(m_arrCharsetNames[i].m_name);
 
-        // ISO-8859-15@euro, 28605 - Code page ISO 8859-15, ISO/IEC Latin-9 (Latin-9, Latin-1, Western Europe, €)
-        case CodePage::ISO_8859_15:
-            return convertISO_8859_15_To_Unicode((char)code);
-            break;
+            // Validate that the hash seed is still perfect for the known names
+#if defined(_DEBUG)
+            assert(m_arrSlots[slot] == 0);
+#endif
+            m_arrSlots[slot] = static_cast<unsigned char>(i + 1);
+        }
     }
-
-    return (char32_t)(L'\0');
-}
+};
 
 /**
- * Converts a 8-bit extended ASCII encoded string from a given code page to the equivalent UTF-32 encoded string,
- * based on it's code page and if control codes less or equal to 127 are to be converted.
+ * Gets the perfect hash table of the known character set names.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	narrowString		the ASCII encoded string to be converted
- * @param	codePage			the code page from CodePage enumeration that the ASCII string belongs to
- * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
- *                              also converts ASCII control codes [0; 31, 127] to Unicode
- * @return	the equivalent UTF-32 encoded string
+ * @return	the character set names hash table
  * @since	1.0
  */
-u32string CodePage2Unicode::convertStringAscii_to_StringUtf32(const string& narrowString, const CodePage codePage, const bool convertAsciiControl)
+const CodePage2Unicode::CharsetHashTable& CodePage2Unicode::getCharsetHashTable(void)
 {
-    u32string strRet;
+    // Built on first use, like the other tables, with a thread safe initialization only since Visual C++ 2015
+    static const CharsetHashTable objTable;
 
-    char32_t codeUnits[2] = {
-        0, 0
-    };
-    for(unsigned i = 0; i < narrowString.length(); i++)
-    {
-        codeUnits[0] = convertCharAscii_to_CharUtf32(narrowString.at(i), codePage, convertAsciiControl);
-
-        strRet.append(codeUnits);
-    }
-
-    return strRet;
+    return objTable;
 }
 
 /**
- * Converts an UTF-16 encoded string to the equivalent 2 bytes system wide character encoded string.
+ * Gets the slot of a normalized character set name in the perfect hash table.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	utf16String			the UTF-16 encoded string to be converted
- * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
- *                          invalid conversion, if 'false' replaces invalid character width the replacement character
- * @return	the equivalent 2 bytes system wide character encoded string
+ * @param	normalizedName	the null terminated normalized character set name
+ * @return	the slot of the name, in [0; CHARSET_HASH_TABLE_SIZE - 1]
  * @since	1.0
  */
-wstring CodePage2Unicode::convertStringUtf16_to_StringWide2(const u16string& utf16String, const bool strictConversion)
+size_t CodePage2Unicode::getCharsetNameSlot(const char* normalizedName)
 {
-#if defined(_DEBUG)
-        // wchar_t must be 16-bit
-        assert(isWideCharUtf16());
-#endif
-
-    wstring strRet;
-    wchar_t codeUnits[2] = {
-        0, 0
-    };
-    for(unsigned i = 0; i < utf16String.length(); i++)
+    // FNV-1a, the high byte is the best mixed
+    uint32_t hash = CHARSET_HASH_SEED;
+    for(const char* p = normalizedName; *p != '\0'; ++p)
     {
-        codeUnits[0] = static_cast<wchar_t>(utf16String.at(i));
-        strRet.append(codeUnits);
+        hash ^= static_cast<unsigned char>(*p);
+        hash *= 16777619U;
     }
 
-    return strRet;
+    return static_cast<size_t>(hash >> 24);
 }
 
 /**
- * Converts a 2 bytes system wide character encoded string to the equivalent UTF-16 encoded string.
+ * Gets the code page of a character set name, like the ones of the IANA registry, of 'nl_langinfo(CODESET)'
+ * or after the dot of a locale name ("UTF-8", "ISO-8859-15", "CP1252", "IBM850", "ANSI_X3.4-1968", "1252", ...).<br />
+ * The names are case insensitive, the '-', '_' and ' ' separators and the '@' modifiers are ignored.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	wideString			the 2 bytes system wide character encoded string to be converted
- * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
- *                          invalid conversion, if 'false' replaces invalid character width the replacement character
- * @return	the equivalent UTF-16 encoded string
+ * @param	charsetName	the null terminated character set name
+ * @return	the code page from CodePage enumeration, or 'UNKNOWN' if the character set isn't supported
  * @since	1.0
  */
-u16string CodePage2Unicode::convertStringWide2_to_StringUtf16(const wstring& wideString, const bool strictConversion)
+CodePage CodePage2Unicode::getCodePageFromCharsetName(const char* charsetName)
 {
-#if defined(_DEBUG)
-        // wchar_t must be 16-bit
-        assert(isWideCharUtf16());
-#endif
+    if(charsetName == nullptr)
+    {
+        return CodePage::UNKNOWN;
+    }
 
-    u16string strRet;
-    char16_t codeUnits[2] = {
-        0, 0
-    };
-    for(unsigned i = 0; i < wideString.length(); i++)
+    // Normalize the name in place, "ISO-8859-15" and "iso885915@euro" are both "iso885915"
+    char arrName[CHARSET_NAME_MAXIMUM_LENGTH + 1];
+    size_t length = 0;
+    for(const char* p = charsetName; (*p != '\0') && (*p != '@'); ++p)
     {
-        codeUnits[0] = static_cast<char16_t>(wideString.at(i));
-        strRet.append(codeUnits);
+        char c = *p;
+        if((c == '-') || (c == '_') || (c == ' '))
+        {
+            continue;
+        }
+        if(length == CHARSET_NAME_MAXIMUM_LENGTH)
+        {
+            // Longer than all the known names
+            return CodePage::UNKNOWN;
+        }
+        arrName[length++] = ((c >= 'A') && (c <= 'Z')) ? static_cast<char>(c - 'A' + 'a') : c;
     }
+    arrName[length] = '\0';
 
-    return strRet;
+    size_t index = getCharsetHashTable().m_arrSlots[getCharsetNameSlot(arrName)];
+    if((index != 0) && (strcmp(m_arrCharsetNames[index - 1].m_name, arrName) == 0))
+    {
+        return m_arrCharsetNames[index - 1].m_codePage;
+    }
+
+    return CodePage::UNKNOWN;
 }
 
 /**
- * Converts an UTF-16 encoded string to the equivalent 4 bytes system wide character encoded string.
+ * Gets the code page of the narrow character strings, from the character set of the current locale.<br />
+ * The code page is resolved on first use and cached, so later calls are a single atomic load, until
+ * it's refreshed with 'refreshDefaultNarrowCodePage' after the locale is changed.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	utf16String			the UTF-16 encoded string to be converted
- * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
- *                          invalid conversion, if 'false' replaces invalid character width the replacement character
- * @return	the equivalent 4 bytes system wide character encoded string
+ * @return	the code page from CodePage enumeration of the narrow character strings, or 'UNKNOWN' if
+ *          the locale character set isn't supported
  * @since	1.0
  */
-wstring CodePage2Unicode::convertStringUtf16_to_StringWide4(const u16string& utf16String, const bool strictConversion)
+CodePage CodePage2Unicode::getDefaultNarrowCodePage(void)
 {
-#if defined(_DEBUG)
-        // wchar_t must be 32-bit
-        assert(isWideCharUtf32());
+#if defined(__HAS_INCLUDE_ATOMIC)
+    unsigned int codePage = m_defaultNarrowCodePage.load(memory_order_acquire);
+#else
+    unsigned int codePage = m_defaultNarrowCodePage;
 #endif
-
-    wstring strRet;
-    u32string strRetT = convertStringUtf16_to_StringUtf32(utf16String, strictConversion);
-    wchar_t codeUnits[2] = {
-        0, 0
-    };
-    for(unsigned i = 0; i < strRetT.length(); i++)
+    if(codePage == DEFAULT_CODEPAGE_UNRESOLVED)
     {
-        codeUnits[0] = static_cast<wchar_t>(strRetT.at(i));
-        strRet.append(codeUnits);
+        // First use, concurrent resolutions store the same code page
+        return refreshDefaultNarrowCodePage();
     }
 
-    return strRet;
+    return static_cast<CodePage>(codePage);
 }
 
 /**
- * Converts a 4 bytes system wide character encoded string to the equivalent UTF-16 encoded string.
+ * Resolves again the code page of the narrow character strings, after the locale was changed with
+ * 'setlocale', and caches it.<br />
+ * On POSIX systems the code page is resolved from 'nl_langinfo(CODESET)', and on Windows from the
+ * C runtime locale name, or from the Windows ANSI or OEM (console programs) code page for the "C" locale.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	wideString			the 4 bytes system wide character encoded string to be converted
- * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
- *                          invalid conversion, if 'false' replaces invalid character width the replacement character
- * @return	the equivalent UTF-16 encoded string
+ * @return	the code page from CodePage enumeration of the narrow character strings, or 'UNKNOWN' if
+ *          the locale character set isn't supported
  * @since	1.0
  */
-u16string CodePage2Unicode::convertStringWide4_to_StringUtf16(const wstring& wideString, const bool strictConversion)
+CodePage CodePage2Unicode::refreshDefaultNarrowCodePage(void)
 {
-#if defined(_DEBUG)
-        // wchar_t must be 32-bit
-        assert(isWideCharUtf32());
+    CodePage codePage = resolveDefaultNarrowCodePage();
+#if defined(__HAS_INCLUDE_ATOMIC)
+    m_defaultNarrowCodePage.store(static_cast<unsigned int>(codePage), memory_order_release);
+#else
+    m_defaultNarrowCodePage = static_cast<unsigned int>(codePage);
 #endif
 
-    u32string strRetT = convertStringWide4_to_StringUtf32(wideString, strictConversion);
-    u16string strRet = convertStringUtf32_to_StringUtf16(strRetT, strictConversion);
-
-    return strRet;
+    return codePage;
 }
 
 /**
- * Converts an UTF-32 encoded string to the equivalent 2 bytes system wide character encoded string.
+ * Resolves the code page of the narrow character strings from the current locale.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	utf32String			the UTF-32 encoded string to be converted
- * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
- *                          invalid conversion, if 'false' replaces invalid character width the replacement character
- * @return	the equivalent 2 bytes system wide character encoded string
+ * @return	the code page from CodePage enumeration of the narrow character strings
  * @since	1.0
  */
-wstring CodePage2Unicode::convertStringUtf32_to_StringWide2(const u32string& utf32String, const bool strictConversion)
+CodePage CodePage2Unicode::resolveDefaultNarrowCodePage(void)
 {
-#if defined(_DEBUG)
-        // wchar_t must be 16-bit
-        assert(isWideCharUtf16());
-#endif
-
-    wstring strRet;
-    u16string strRetT = convertStringUtf32_to_StringUtf16(utf32String, strictConversion);
-    wchar_t codeUnits[2] = {
-        0, 0
-    };
-    for(unsigned i = 0; i < strRetT.length(); i++)
+#if defined(__HAS_INCLUDE_LANGINFO_H)
+    // The character set of the LC_CTYPE category ("ANSI_X3.4-1968" or "US-ASCII" for the "C" locale)
+    return getCodePageFromCharsetName(nl_langinfo(CODESET));
+#else
+    // The character set follows the dot of the locale name ("language_territory.charset@modifier")
+    const char* pLocale = setlocale(LC_CTYPE, nullptr);
+    const char* pDot = (pLocale != nullptr) ? strrchr(pLocale, '.') : nullptr;
+    if(pDot != nullptr)
     {
-        codeUnits[0] = static_cast<wchar_t>(strRetT.at(i));
-        strRet.append(codeUnits);
+        return getCodePageFromCharsetName(pDot + 1);
     }
-
-    return strRet;
+#	if defined(__HAS_INCLUDE_WINDOWS)
+    // The "C" locale uses the OEM code page on the console and the ANSI code page otherwise
+#		if defined(_CONSOLE)
+    return static_cast<CodePage>(::GetOEMCP());
+#		else
+    return static_cast<CodePage>(::GetACP());
+#		endif
+#	else
+    // The "C" and "POSIX" locales
+    return CodePage::US_ASCII;
+#	endif
+#endif
 }
 
+// The code pages of the flattened decoding tables, in table index order
+const CodePage CodePage2Unicode::m_arrTableCodePages[CODEPAGE_TABLE_COUNT] = {
+    CodePage::UNKNOWN, CodePage::US_ASCII,
+    CodePage::DOS_CP437, CodePage::DOS_CP737, CodePage::DOS_CP850, CodePage::DOS_CP858, CodePage::DOS_CP859, CodePage::DOS_CP860,
+    CodePage::MAC_ROMAN, CodePage::MAC_GREEK,
+    CodePage::WINDOWS_1252, CodePage::WINDOWS_1253,
+    CodePage::ISO_8859_1, CodePage::ISO_8859_7, CodePage::ISO_8859_15,
+    CodePage::EBCDIC_CP037, CodePage::EBCDIC_CP500, CodePage::EBCDIC_CP875, CodePage::EBCDIC_CP1047
+};
+
 /**
- * Converts an 2 bytes system wide character encoded string to the equivalent  encoded string.
- *
- * @author	Jos&eacute; Caetano Silva
- * @version	%I%, %G%
- * @param	wideString			the 2 bytes system wide character encoded string to be converted
- * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
- *                              invalid conversion, if 'false' replaces invalid character width the replacement character
- * @return	the equivalent UTF-32 string
- * @since	1.0
+ * Flattened 8-bit code page decoding tables, with the 7-bit ASCII and the extended ASCII
+ * halves already resolved, so the decoding of a character is a single indexed load.
+ * Built once, on first use.
  */
-u32string CodePage2Unicode::convertStringWide2_to_StringUtf32(const wstring& wideString, const bool strictConversion)
+struct CodePage2Unicode::CodePageTables
 {
+    /**
+     * Decoding tables, by code page table index and by ASCII control codes conversion
+     * (0 for the plain tables and 1 for the tables with the control codes converted).
+     */
+    char32_t m_arrTables[CODEPAGE_TABLE_COUNT][2][CODEPAGE_TABLE_SIZE];
+
+    /**
+     * If the 7-bit ASCII half of the decoding tables is the identity, so 7-bit ASCII blocks can be
+     * zero-extended without table loads.
+     */
+    bool m_arrAsciiIdentity[CODEPAGE_TABLE_COUNT][2];
+
+    /**
+     * UTF-16 decoding tables, by code page table index and by ASCII control codes conversion
+     * (all the 8-bit code pages map to the BMP, so each character is a single UTF-16 code unit).
+     */
+    char16_t m_arrUtf16Tables[CODEPAGE_TABLE_COUNT][2][CODEPAGE_TABLE_SIZE];
+
+    /**
+     * UTF-8 decoding tables, by code page table index and by ASCII control codes conversion,
+     * holding the 1 to 3 bytes UTF-8 sequence of each character, with it's length in the last byte.
+     */
+    unsigned char m_arrUtf8Tables[CODEPAGE_TABLE_COUNT][2][CODEPAGE_TABLE_SIZE][4];
+
+    /**
+     * Nibble classification tables of the extended ASCII characters that aren't the Latin-1 character of
+     * the same value, by code page table index: a character is one of them if the entry of it's high nibble
+     * (first 16 bytes) and the entry of it's low nibble (last 16 bytes) have a common bit.
+     */
+    unsigned char m_arrLatin1Patches[CODEPAGE_TABLE_COUNT][32];
+
+    CodePageTables()
+    {
+        for(size_t i = 0; i < CODEPAGE_TABLE_COUNT; ++i)
+        {
+            // Validate the table order
 #if defined(_DEBUG)
-        // wchar_t must be 16-bit
-        assert(isWideCharUtf16());
+            assert(getCodePageTableIndex(m_arrTableCodePages[i]) == i);
 #endif
 
-    u16string strRetT = convertStringWide2_to_StringUtf16(wideString, strictConversion);
-    u32string strRet = convertStringUtf16_to_StringUtf32(strRetT, strictConversion);
+            for(size_t code = 0; code < CODEPAGE_TABLE_SIZE; ++code)
+            {
+                m_arrTables[i][0][code] = decodeCharAscii((char)code, m_arrTableCodePages[i], false);
+                m_arrTables[i][1][code] = decodeCharAscii((char)code, m_arrTableCodePages[i], true);
+            }
 
-    return strRet;
-}
+            for(size_t variant = 0; variant < 2; ++variant)
+            {
+                m_arrAsciiIdentity[i][variant] = true;
+                for(size_t code = 0; code < 128; ++code)
+                {
+                    if(m_arrTables[i][variant][code] != (char32_t)code)
+                    {
+                        m_arrAsciiIdentity[i][variant] = false;
+                        break;
+                    }
+                }
 
-/**
- * Converts an UTF-32 encoded string to the equivalent 4 bytes system wide character encoded string.
- *
- * @author	Jos&eacute; Caetano Silva
- * @version	%I%, %G%
- * @param	utf32String			the UTF-32 encoded string to be converted
- * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
- *                          invalid conversion, if 'false' replaces invalid character width the replacement character
- * @return	the equivalent 4 bytes system wide character encoded string
- * @since	1.0
- */
-wstring CodePage2Unicode::convertStringUtf32_to_StringWide4(const u32string& utf32String, const bool strictConversion)
-{
+                for(size_t code = 0; code < CODEPAGE_TABLE_SIZE; ++code)
+                {
+                    char32_t charUtf32 = m_arrTables[i][variant][code];
 #if defined(_DEBUG)
-        // wchar_t must be 32-bit
-        assert(isWideCharUtf32());
+                    assert(charUtf32 <= UNICODE_MAXIMUM_BMP);
 #endif
+                    m_arrUtf16Tables[i][variant][code] = static_cast<char16_t>(charUtf32);
 
-    wstring strRet;
-    wchar_t codeUnits[2] = {
-        0, 0
-    };
-    for(unsigned i = 0; i < utf32String.length(); i++)
-    {
-        codeUnits[0] = static_cast<wchar_t>(utf32String.at(i));
-        strRet.append(codeUnits);
-    }
+                    unsigned char* pSequence = m_arrUtf8Tables[i][variant][code];
+                    memset(pSequence, 0, 4);
+                    if(charUtf32 < 0x80)
+                    {
+                        pSequence[0] = static_cast<unsigned char>(charUtf32);
+                        pSequence[3] = 1;
+                    }
+                    else if(charUtf32 < 0x800)
+                    {
+                        pSequence[0] = static_cast<unsigned char>(UTF8_LEAD_BYTES2 | (charUtf32 >> UTF8_HALF_SHIFT));
+                        pSequence[1] = static_cast<unsigned char>(UTF8_NEXT | (charUtf32 & UTF8_NEXT_MASK));
+                        pSequence[3] = 2;
+                    }
+                    else
+                    {
+                        pSequence[0] = static_cast<unsigned char>(UTF8_LEAD_BYTES3 | (charUtf32 >> (2 * UTF8_HALF_SHIFT)));
+                        pSequence[1] = static_cast<unsigned char>(UTF8_NEXT | ((charUtf32 >> UTF8_HALF_SHIFT) & UTF8_NEXT_MASK));
+                        pSequence[2] = static_cast<unsigned char>(UTF8_NEXT | (charUtf32 & UTF8_NEXT_MASK));
+                        pSequence[3] = 3;
+                    }
+                }
+            }
 
-    return strRet;
-}
+            // One bit for each high nibble of the extended ASCII characters
+            unsigned char* pPatches = m_arrLatin1Patches[i];
+            memset(pPatches, 0, 32);
+            for(size_t code = 128; code < CODEPAGE_TABLE_SIZE; ++code)
+            {
+                unsigned char bit = static_cast<unsigned char>(1U << ((code >> 4) - 8));
+                pPatches[code >> 4] = bit;
+                if(m_arrTables[i][0][code] != (char32_t)code)
+                {
+                    pPatches[16 + (code & 0x0F)] |= bit;
+                }
+            }
+        }
+    }
+};
 
 /**
- * Converts an 4 bytes system wide character encoded string to the equivalent  encoded string.
+ * Gets the flattened 8-bit code page decoding tables.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	wideString			the 4 bytes system wide character encoded string to be converted
- * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
- *                              invalid conversion, if 'false' replaces invalid character width the replacement character
- * @return	the equivalent UTF-32 string
+ * @return	the flattened decoding tables
  * @since	1.0
  */
-u32string CodePage2Unicode::convertStringWide4_to_StringUtf32(const wstring& wideString, const bool strictConversion)
+const CodePage2Unicode::CodePageTables& CodePage2Unicode::getCodePageTables(void)
 {
-#if defined(_DEBUG)
-        // wchar_t must be 32-bit
-        assert(isWideCharUtf32());
-#endif
-
-    u32string strRet;
-    char32_t codeUnits[2] = {
-        0, 0
-    };
-    for(unsigned i = 0; i < wideString.length(); i++)
-    {
-        codeUnits[0] = static_cast<char32_t>(wideString.at(i));
-        strRet.append(codeUnits);
-    }
+    static const CodePageTables objTables;
 
-    return strRet;
+    return objTables;
 }
 
 /**
- * Converts an system narrow character encoded string to the equivalent system wide character encoded string.
+ * Gets the index of the flattened decoding table of a given code page.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	narrowString		the system narrow character encoded string to be converted
- * @return	the equivalent system wide character string
+ * @param	codePage	the code page from CodePage enumeration
+ * @return	the index of the code page table, or 0 if the code page doesn't have a map
  * @since	1.0
  */
-wstring CodePage2Unicode::convertStringNarrow_to_StringWide(const string& narrowString)
+size_t CodePage2Unicode::getCodePageTableIndex(const CodePage codePage)
 {
-    wstring wideString;
-    size_t requiredSize = 0;
-    wchar_t* cstrUnicode = nullptr;
-    size_t nRet = 0;
+    switch(codePage)
+    {
+        case CodePage::US_ASCII:
+            return 1;
 
-#if defined(_WIN32) || defined(_WIN64) || defined(_WIN32_WCE) || defined(__CYGWIN__)
-        // Microsoft Windows
-        requiredSize = (size_t)::MultiByteToWideChar(CP_ACP, MB_PRECOMPOSED, narrowString.c_str(), -1, nullptr, 0);
-#else
-        // ANSI C/C++
-        requiredSize = ::mbstowcs(nullptr, narrowString.c_str(), 0);
-#endif
+        case CodePage::DOS_CP437:
+            return 2;
 
-    if(requiredSize > 0)
+        case CodePage::DOS_CP737:
+            return 3;
+
+        case CodePage::DOS_CP850:
+            return 4;
+
+        case CodePage::DOS_CP858:
+            return 5;
+
+        case CodePage::DOS_CP859:
+            return 6;
+
+        case CodePage::DOS_CP860:
+            return 7;
+
+        case CodePage::MAC_ROMAN:
+            return 8;
+
+        case CodePage::MAC_GREEK:
+            return 9;
+
+        case CodePage::WINDOWS_1252:
+            return 10;
+
+        case CodePage::WINDOWS_1253:
+            return 11;
+
+        case CodePage::ISO_8859_1:
+            return 12;
+
+        case CodePage::ISO_8859_7:
+            return 13;
+
+        case CodePage::ISO_8859_15:
+            return 14;
+
+        case CodePage::EBCDIC_CP037:
+            return 15;
+
+        case CodePage::EBCDIC_CP500:
+            return 16;
+
+        case CodePage::EBCDIC_CP875:
+            return 17;
+
+        case CodePage::EBCDIC_CP1047:
+            return 18;
+
+        default:
+            // Code page without a map
+            return 0;
+    }
+}
+
+/**
+ * Gets the flattened 256-entry decoding table of a given 8-bit code page, that maps every byte
+ * value directly to the equivalent UTF-32 code point.<br />
+ * Code pages without a map are decoded as 7-bit ASCII, with the extended ASCII characters
+ * [128; 255] mapped to the Unicode replacement character.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	codePage			the code page from CodePage enumeration
+ * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+ *                              also converts ASCII control codes [0; 31, 127] to Unicode
+ * @return	the 256-entry decoding table of the code page
+ * @since	1.0
+ */
+const char32_t* CodePage2Unicode::getCodePageTable(const CodePage codePage, const bool convertAsciiControl)
+{
+    return getCodePageTables().m_arrTables[getCodePageTableIndex(codePage)][convertAsciiControl ? 1 : 0];
+}
+
+// The code pages of the statistical code page detection, by preference order of the candidates with the same score
+const CodePage CodePage2Unicode::m_arrDetectionCodePages[DETECTION_CODEPAGE_COUNT] = {
+    CodePage::WINDOWS_1252, CodePage::ISO_8859_15, CodePage::ISO_8859_1,
+    CodePage::DOS_CP437, CodePage::DOS_CP850, CodePage::DOS_CP860, CodePage::MAC_ROMAN,
+    CodePage::WINDOWS_1253, CodePage::ISO_8859_7, CodePage::DOS_CP737, CodePage::MAC_GREEK
+};
+
+/**
+ * Letter frequency and box drawing range models of the detected code pages, with the weight of
+ * each extended ASCII character. Built once, on first use, from the flattened decoding tables.
+ */
+struct CodePage2Unicode::CodePageModels
+{
+    /**
+     * Weights of the extended ASCII characters [128; 255], by detection code page index.
+     */
+    int m_arrWeights[DETECTION_CODEPAGE_COUNT][128];
+
+    /**
+     * If the code page is for the Greek script (most of its letters are Greek), by detection code page index.
+     */
+    bool m_arrGreekScript[DETECTION_CODEPAGE_COUNT];
+
+    /**
+     * If the extended ASCII characters [128; 255] are letters of the code page script, by detection code page index.
+     */
+    bool m_arrLetters[DETECTION_CODEPAGE_COUNT][128];
+
+    CodePageModels()
     {
-        cstrUnicode = (wchar_t*)::malloc((requiredSize + 1) * sizeof(wchar_t));
-        if(cstrUnicode != nullptr)
+        for(size_t i = 0; i < DETECTION_CODEPAGE_COUNT; ++i)
         {
-            cstrUnicode[requiredSize] = L'\0';
-#if defined(_WIN32) || defined(_WIN64) || defined(_WIN32_WCE) || defined(__CYGWIN__)
-                // Microsoft Windows
-                nRet = (size_t)::MultiByteToWideChar(CP_ACP, MB_PRECOMPOSED, narrowString.c_str(), -1, cstrUnicode, (int)requiredSize);
-#else
-                // ANSI C/C++
-                nRet = ::mbstowcs(cstrUnicode, narrowString.c_str(), requiredSize);
-#endif
+            const char32_t* pTable = getCodePageTable(m_arrDetectionCodePages[i]);
 
-            if((nRet == 0) || (nRet == static_cast<size_t>(-1)) || (nRet > requiredSize))
+            // The script of the code page is the one of most of its letters
+            size_t latinLetters = 0;
+            size_t greekLetters = 0;
+            for(size_t code = 128; code < CODEPAGE_TABLE_SIZE; ++code)
             {
-                // Error converting string
-                ::free((void*)cstrUnicode);
-                cstrUnicode = nullptr;
+                greekLetters += isDetectionLetter(pTable[code], true) ? 1 : 0;
+                latinLetters += isDetectionLetter(pTable[code], false) ? 1 : 0;
+            }
+
+            m_arrGreekScript[i] = (greekLetters > latinLetters);
+            for(size_t code = 128; code < CODEPAGE_TABLE_SIZE; ++code)
+            {
+                m_arrWeights[i][code - 128] = getDetectionWeight(pTable[code], m_arrGreekScript[i]);
+                m_arrLetters[i][code - 128] = isDetectionLetter(pTable[code], m_arrGreekScript[i]);
             }
         }
-        else
+    }
+};
+
+/**
+ * Gets the models of the detected code pages.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @return	the code page models
+ * @since	1.0
+ */
+const CodePage2Unicode::CodePageModels& CodePage2Unicode::getCodePageModels(void)
+{
+    static const CodePageModels objModels;
+
+    return objModels;
+}
+
+/**
+ * Gets the weight of a character in the model of a code page: the frequent lowercase letters of
+ * the code page script weight the most, followed by the other letters, the box drawing characters
+ * and the common punctuation, while the control codes and unmapped characters are penalized.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	codePoint	the decoded extended ASCII character
+ * @param	greekScript	'true' if the code page is for the Greek script, 'false' for the Latin script
+ * @return	the weight of the character, from -2 to 1 times 'DETECTION_MAXIMUM_WEIGHT'
+ * @since	1.0
+ */
+int CodePage2Unicode::getDetectionWeight(const char32_t codePoint, const bool greekScript)
+{
+    // The most frequent accented letters of the Western European languages
+    static const char32_t arrFrequentLatin[] = {
+        0x00DF, 0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E7, 0x00E8, 0x00E9,
+        0x00EA, 0x00ED, 0x00F1, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00FA, 0x00FC
+    };
+    // The common punctuation and symbols out of the 7-bit ASCII
+    static const char32_t arrCommonSymbols[] = {
+        0x00A0, 0x00A1, 0x00A3, 0x00A7, 0x00A9, 0x00AA, 0x00AB, 0x00AE, 0x00B0, 0x00B7, 0x00BA, 0x00BB, 0x00BF,
+        0x2013, 0x2014, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2026, 0x20AC
+    };
+
+    if((codePoint < 0x00A0U) || (codePoint == UNICODE_REPLACEMENT_CHARACTER))
+    {
+        // Control code or unmapped character
+        return -2 * DETECTION_MAXIMUM_WEIGHT;
+    }
+
+    if(isDetectionLetter(codePoint, greekScript))
+    {
+        if(greekScript)
         {
-            // Error allocating memory
-            cstrUnicode = nullptr;
+            // All the lowercase Greek letters are frequent, the text is mostly out of the 7-bit ASCII
+            return ((codePoint >= 0x03ACU) || (codePoint == 0x0390U)) ? DETECTION_MAXIMUM_WEIGHT : (DETECTION_MAXIMUM_WEIGHT / 4);
+        }
+        for(size_t i = 0; i < (sizeof(arrFrequentLatin) / sizeof(arrFrequentLatin[0])); ++i)
+        {
+            if(codePoint == arrFrequentLatin[i])
+            {
+                return DETECTION_MAXIMUM_WEIGHT;
+            }
         }
+        return ((codePoint >= 0x00DFU) && (codePoint <= 0x00FFU)) ? (DETECTION_MAXIMUM_WEIGHT / 2) : (DETECTION_MAXIMUM_WEIGHT / 4);
     }
-    else
+
+    if((codePoint >= 0x2500U) && (codePoint <= 0x259FU))
     {
-        // Error, can't convert
-        cstrUnicode = nullptr;
+        // Box drawing and block elements, used by the text mode user interfaces of the DOS code pages
+        return (DETECTION_MAXIMUM_WEIGHT * 3) / 8;
     }
 
-    if(cstrUnicode == nullptr)
+    for(size_t i = 0; i < (sizeof(arrCommonSymbols) / sizeof(arrCommonSymbols[0])); ++i)
     {
-        throw logic_error("Can't convert narrow string to wide string");
+        if(codePoint == arrCommonSymbols[i])
+        {
+            return DETECTION_MAXIMUM_WEIGHT / 4;
+        }
     }
-    else
+
+    // Letters of other scripts, mathematical symbols and seldom used characters
+    return 0;
+}
+
+/**
+ * Checks if a character is a letter of the Greek script (in the Greek and Coptic block) or of the
+ * Latin script (in the Latin-1 Supplement and Latin Extended blocks).
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	codePoint	the character to be tested
+ * @param	greekScript	'true' to test for a Greek letter, 'false' to test for a Latin letter
+ * @return	'true' if the character is a letter of the script, 'false' otherwise
+ * @since	1.0
+ */
+bool CodePage2Unicode::isDetectionLetter(const char32_t codePoint, const bool greekScript)
+{
+    if(greekScript)
     {
-        wideString = wstring(cstrUnicode);
-        ::free(cstrUnicode);
-        cstrUnicode = nullptr;
+        return (codePoint >= 0x0386U) && (codePoint <= 0x03CEU) && (codePoint != 0x0387U)
+               && (codePoint != 0x038BU) && (codePoint != 0x038DU) && (codePoint != 0x03A2U);
     }
 
-    return wideString;
+    return (codePoint >= 0x00C0U) && (codePoint <= 0x024FU) && (codePoint != 0x00D7U) && (codePoint != 0x00F7U);
 }
 
 /**
- * Converts an system wide character encoded string to the equivalent system narrow character encoded string.
+ * Adds the occurrences of each extended ASCII character [128; 255] of a buffer to a histogram, and
+ * the number of 7-bit ASCII letters, that are the same in all the code pages. The letters are counted
+ * with SIMD instructions when available, and the extended ASCII characters are counted into 4
+ * interleaved tables, so repeated characters don't serialize the increments.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	wideString		the system wide character encoded string to be converted
- * @return	the equivalent system narrow character string
+ * @param	buffer			the bytes to be counted
+ * @param	length			the number of bytes
+ * @param	histogram		the 128 counters of the extended ASCII characters to be incremented
+ * @param	asciiLetters	the counter of the 7-bit ASCII letters to be incremented
  * @since	1.0
  */
-string CodePage2Unicode::convertStringWide_to_StringNarrow(const wstring& wideString)
+void CodePage2Unicode::countCharacters(const char* buffer, const size_t length, size_t* histogram, size_t& asciiLetters)
 {
-    string narrowString;
-    size_t requiredSize = 0;
-    char* cstrASCII = nullptr;
-    size_t nRet = 0;
+    // Validate parameters
+    assert((buffer != nullptr) || (length == 0));
+    assert(histogram != nullptr);
 
-#if defined(_WIN32) || defined(_WIN64) || defined(_WIN32_WCE) || defined(__CYGWIN__)
-        // Microsoft Windows
-        requiredSize = (size_t)::WideCharToMultiByte(CP_ACP, WC_COMPOSITECHECK | WC_SEPCHARS | WC_NO_BEST_FIT_CHARS, wideString.c_str(), -1, nullptr, 0, nullptr, nullptr);
-#else
-        // ANSI C/C++
-        requiredSize = ::wcstombs(nullptr, wideString.c_str(), 0);
-#endif
+    // The 7-bit ASCII characters add 0 to the counter of the same character + 128
+    size_t arrCounts[4][128];
+    memset(arrCounts, 0, sizeof(arrCounts));
+    const unsigned char* pBytes = reinterpret_cast<const unsigned char*>(buffer);
+    size_t i = 0;
 
-    if(requiredSize > 0)
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    // 32 bytes blocks, the letters are counted by each byte lane (up to 255 blocks) and then summed
+    const __m256i vecCaseBit = _mm256_set1_epi8(0x20);
+    const __m256i vecBeforeA = _mm256_set1_epi8('a' - 1);
+    const __m256i vecAfterZ = _mm256_set1_epi8('z' + 1);
+    while(i + 32 <= length)
     {
-        cstrASCII = (char*)::malloc((requiredSize + 1) * sizeof(char));
-        if(cstrASCII != nullptr)
+        __m256i vecLetters = _mm256_setzero_si256();
+        size_t end = min(i + (255 * 32), length - (length - i) % 32);
+        for(; i < end; i += 32)
         {
-            cstrASCII[requiredSize] = '\0';
-#if defined(_WIN32) || defined(_WIN64) || defined(_WIN32_WCE) || defined(__CYGWIN__)
-                // Microsoft Windows
-                nRet = (size_t)::WideCharToMultiByte(CP_ACP, WC_COMPOSITECHECK | WC_SEPCHARS | WC_NO_BEST_FIT_CHARS, wideString.c_str(), -1, cstrASCII, (int)requiredSize, nullptr, nullptr);
-#else
-                // ANSI C/C++
-                nRet = ::wcstombs(cstrASCII, wideString.c_str(), requiredSize);
-#endif
-
-            if((nRet == 0) || (nRet == static_cast<size_t>(-1)) || (nRet > requiredSize))
+            __m256i vecBytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pBytes + i));
+            __m256i vecLower = _mm256_or_si256(vecBytes, vecCaseBit);
+            vecLetters = _mm256_sub_epi8(vecLetters, _mm256_and_si256(_mm256_cmpgt_epi8(vecLower, vecBeforeA),
+                                                                      _mm256_cmpgt_epi8(vecAfterZ, vecLower)));
+            if(_mm256_movemask_epi8(vecBytes) != 0)
             {
-                // Error converting string
-                ::free((void*)cstrASCII);
-                cstrASCII = nullptr;
+                for(size_t j = i; j < i + 32; j += 4)
+                {
+                    arrCounts[0][pBytes[j] & 0x7FU] += (pBytes[j] >> 7);
+                    arrCounts[1][pBytes[j + 1] & 0x7FU] += (pBytes[j + 1] >> 7);
+                    arrCounts[2][pBytes[j + 2] & 0x7FU] += (pBytes[j + 2] >> 7);
+                    arrCounts[3][pBytes[j + 3] & 0x7FU] += (pBytes[j + 3] >> 7);
+                }
             }
         }
-        else
+        __m256i vecSums = _mm256_sad_epu8(vecLetters, _mm256_setzero_si256());
+        __m128i vecSum = _mm_add_epi64(_mm256_castsi256_si128(vecSums), _mm256_extracti128_si256(vecSums, 1));
+        asciiLetters += static_cast<size_t>(_mm_cvtsi128_si32(vecSum) + _mm_cvtsi128_si32(_mm_srli_si128(vecSum, 8)));
+    }
+#elif (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE2)
+    // 16 bytes blocks, the letters are counted by each byte lane (up to 255 blocks) and then summed
+    const __m128i vecCaseBit = _mm_set1_epi8(0x20);
+    const __m128i vecBeforeA = _mm_set1_epi8('a' - 1);
+    const __m128i vecAfterZ = _mm_set1_epi8('z' + 1);
+    while(i + 16 <= length)
+    {
+        __m128i vecLetters = _mm_setzero_si128();
+        size_t end = min(i + (255 * 16), length - (length - i) % 16);
+        for(; i < end; i += 16)
         {
-            // Error allocating memory
-            cstrASCII = nullptr;
+            __m128i vecBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pBytes + i));
+            __m128i vecLower = _mm_or_si128(vecBytes, vecCaseBit);
+            vecLetters = _mm_sub_epi8(vecLetters, _mm_and_si128(_mm_cmpgt_epi8(vecLower, vecBeforeA),
+                                                                _mm_cmplt_epi8(vecLower, vecAfterZ)));
+            if(_mm_movemask_epi8(vecBytes) != 0)
+            {
+                for(size_t j = i; j < i + 16; j += 4)
+                {
+                    arrCounts[0][pBytes[j] & 0x7FU] += (pBytes[j] >> 7);
+                    arrCounts[1][pBytes[j + 1] & 0x7FU] += (pBytes[j + 1] >> 7);
+                    arrCounts[2][pBytes[j + 2] & 0x7FU] += (pBytes[j + 2] >> 7);
+                    arrCounts[3][pBytes[j + 3] & 0x7FU] += (pBytes[j + 3] >> 7);
+                }
+            }
         }
+        __m128i vecSums = _mm_sad_epu8(vecLetters, _mm_setzero_si128());
+        asciiLetters += static_cast<size_t>(_mm_cvtsi128_si32(vecSums) + _mm_cvtsi128_si32(_mm_srli_si128(vecSums, 8)));
     }
-    else
+#endif
+    for(; i < length; ++i)
     {
-        // Error, can't convert
-        cstrASCII = nullptr;
+        unsigned char code = pBytes[i];
+        arrCounts[i & 3][code & 0x7FU] += (code >> 7);
+        if(static_cast<unsigned char>((code | 0x20U) - 'a') < 26)
+        {
+            ++asciiLetters;
+        }
     }
 
-    if(cstrASCII == nullptr)
+    for(size_t code = 0; code < 128; ++code)
     {
-        throw logic_error("Can't convert wide string to narrow string");
+        histogram[code] += arrCounts[0][code] + arrCounts[1][code] + arrCounts[2][code] + arrCounts[3][code];
+    }
+}
+
+/**
+ * Detects the 8-bit code page of a buffer without BOM that isn't valid UTF-8, scoring the histogram
+ * of its extended ASCII characters against the letter frequency and box drawing range models of
+ * the DOS, Macintosh, Windows and ISO/IEC Latin 1 and Greek code pages.<br />
+ * Large inputs are sampled in evenly spaced blocks instead of fully scanned.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	buffer	the bytes to be checked
+ * @param	length	the number of bytes
+ * @return	the candidate code pages, from the best to the worst fit, or only 'US_ASCII' (with
+ *          confidence 1.0) if the buffer doesn't have extended ASCII characters
+ * @since	1.0
+ */
+vector<CodePageCandidate> CodePage2Unicode::detectCodePage(const void* buffer, const size_t length)
+{
+    // Validate parameters
+    assert((buffer != nullptr) || (length == 0));
+
+    const char* pBytes = static_cast<const char*>(buffer);
+    size_t arrHistogram[128] = {
+        0
+    };
+
+    size_t asciiLetters = 0;
+
+    if(length <= (DETECTION_SAMPLE_SIZE * DETECTION_SAMPLE_COUNT))
+    {
+        countCharacters(pBytes, length, arrHistogram, asciiLetters);
     }
     else
     {
-        narrowString = string(cstrASCII);
-        ::free(cstrASCII);
-        cstrASCII = nullptr;
+        // Evenly spaced samples, from the start to the end of the input
+        size_t stride = (length - DETECTION_SAMPLE_SIZE) / (DETECTION_SAMPLE_COUNT - 1);
+        for(size_t i = 0; i < DETECTION_SAMPLE_COUNT; ++i)
+        {
+            countCharacters(pBytes + (i * stride), DETECTION_SAMPLE_SIZE, arrHistogram, asciiLetters);
+        }
+    }
+
+    size_t extendedCount = 0;
+    for(size_t code = 0; code < 128; ++code)
+    {
+        extendedCount += arrHistogram[code];
+    }
+
+    vector<CodePageCandidate> vecCandidates;
+    if(extendedCount == 0)
+    {
+        CodePageCandidate objCandidate = {CodePage::US_ASCII, 1.0};
+        vecCandidates.push_back(objCandidate);
+        return vecCandidates;
+    }
+
+    const CodePageModels& objModels = getCodePageModels();
+    vecCandidates.reserve(DETECTION_CODEPAGE_COUNT);
+    for(size_t i = 0; i < DETECTION_CODEPAGE_COUNT; ++i)
+    {
+        long long score = 0;
+        size_t extendedLetters = 0;
+        for(size_t code = 0; code < 128; ++code)
+        {
+            score += static_cast<long long>(arrHistogram[code]) * objModels.m_arrWeights[i][code];
+            extendedLetters += objModels.m_arrLetters[i][code] ? arrHistogram[code] : 0;
+        }
+
+        // The Latin script text is mostly 7-bit ASCII letters, while the Greek script text is mostly
+        // extended ASCII letters, so each script model only fits a range of the extended letters ratio
+        double letterRatio = (extendedLetters > 0) ? (static_cast<double>(extendedLetters) / static_cast<double>(extendedLetters + asciiLetters)) : 0.0;
+        double scriptFit = objModels.m_arrGreekScript[i] ? min(max((letterRatio - 0.1) / 0.3, 0.0), 1.0)
+                                                         : min(max((0.5 - letterRatio) / 0.3, 0.0), 1.0);
+        CodePageCandidate objCandidate = {
+            m_arrDetectionCodePages[i],
+            (score > 0) ? ((scriptFit * score) / (static_cast<double>(extendedCount) * DETECTION_MAXIMUM_WEIGHT)) : 0.0
+        };
+
+        // Ranked insertion, after the candidates with the same confidence (in preference order)
+        vector<CodePageCandidate>::iterator it = vecCandidates.begin();
+        while((it != vecCandidates.end()) && (it->confidence >= objCandidate.confidence))
+        {
+            ++it;
+        }
+        vecCandidates.insert(it, objCandidate);
+    }
+
+    return vecCandidates;
+}
+
+/**
+ * Reverse lookup tables of the 8-bit code pages, organized as a two-level page table over the BMP.
+ * The leaf 0 is shared by all the empty pages and all the leaves store 0 for the unmapped code points,
+ * since only U+0000 is mapped to 0x00.
+ * Built once, on first use.
+ */
+struct CodePage2Unicode::CodePageEncodingTables
+{
+    /**
+     * First level, by code page table index and by the high byte of the BMP code point,
+     * holding the index of the leaf.
+     */
+    unsigned char m_arrRoots[CODEPAGE_TABLE_COUNT][CODEPAGE_TABLE_SIZE];
+
+    /**
+     * Second level, the leaves of 256 entries, by the low byte of the BMP code point,
+     * holding the ASCII character.
+     */
+    vector<unsigned char> m_vecLeaves;
+
+    CodePageEncodingTables() : m_vecLeaves(CODEPAGE_TABLE_SIZE, 0)
+    {
+        memset(m_arrRoots, 0, sizeof(m_arrRoots));
+
+        for(size_t i = 0; i < CODEPAGE_TABLE_COUNT; ++i)
+        {
+            // Map the characters first, so they take priority over the control code glyphs
+            for(size_t glyphs = 0; glyphs < 2; ++glyphs)
+            {
+                const char32_t* pTable = getCodePageTable(m_arrTableCodePages[i], glyphs != 0);
+                for(size_t code = 0; code < CODEPAGE_TABLE_SIZE; ++code)
+                {
+                    char32_t charUtf32 = pTable[code];
+                    if((charUtf32 == (char32_t)0) ||
+                       (charUtf32 == (char32_t)UNICODE_REPLACEMENT_CHARACTER) ||
+                       (charUtf32 > UNICODE_MAXIMUM_BMP))
+                    {
+                        // U+0000 is implicit and undefined characters aren't mapped back
+                        continue;
+                    }
+
+                    size_t leaf = m_arrRoots[i][charUtf32 >> 8];
+                    if(leaf == 0)
+                    {
+                        // Allocate a new leaf
+                        leaf = m_vecLeaves.size() / CODEPAGE_TABLE_SIZE;
+#if defined(_DEBUG)
+                        assert(leaf < CODEPAGE_TABLE_SIZE);
+#endif
+                        m_vecLeaves.resize(m_vecLeaves.size() + CODEPAGE_TABLE_SIZE, 0);
+                        m_arrRoots[i][charUtf32 >> 8] = (unsigned char)leaf;
+                    }
+
+                    // On duplicates keep the first (lowest) character
+                    unsigned char& entry = m_vecLeaves[(leaf << 8) | (charUtf32 & 0xFF)];
+                    if(entry == 0)
+                    {
+                        entry = (unsigned char)code;
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * Looks up the ASCII character of an UTF-32 code point in a code page table.
+     *
+     * @param	tableIndex	the index of the code page table
+     * @param	charUtf32	the UTF-32 code point
+     * @param	narrowChar	receives the ASCII character, if the code point is mapped
+     * @return	'true' if the code point is mapped, 'false' otherwise
+     */
+    inline bool lookup(const size_t tableIndex, const char32_t charUtf32, char& narrowChar) const
+    {
+        if(charUtf32 > UNICODE_MAXIMUM_BMP)
+        {
+            return false;
+        }
+
+        unsigned char code = m_vecLeaves[((size_t)m_arrRoots[tableIndex][charUtf32 >> 8] << 8) | (charUtf32 & 0xFF)];
+        if((code == 0) && (charUtf32 != (char32_t)0))
+        {
+            return false;
+        }
+
+        narrowChar = (char)code;
+        return true;
+    }
+};
+
+/**
+ * Gets the reverse lookup tables of the 8-bit code pages.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @return	the reverse lookup tables
+ * @since	1.0
+ */
+const CodePage2Unicode::CodePageEncodingTables& CodePage2Unicode::getCodePageEncodingTables(void)
+{
+    static const CodePageEncodingTables objTables;
+
+    return objTables;
+}
+
+/**
+ * Byte to byte translation tables between the 8-bit code pages, composed from the flattened decoding
+ * table of the source code page and the reverse lookup table of the target code page, with the
+ * characters that the target code page can't represent flagged as lossy.
+ * Built once, on first use.
+ */
+struct CodePage2Unicode::CodePageTranslationTables
+{
+    /**
+     * Translation tables, by source and by target code page table index (the lossy characters are
+     * translated to 0xFF, so they are never taken for 7-bit ASCII characters).
+     */
+    unsigned char m_arrTables[CODEPAGE_TABLE_COUNT][CODEPAGE_TABLE_COUNT][CODEPAGE_TABLE_SIZE];
+
+    /**
+     * Bitmaps of the lossy characters, by source and by target code page table index.
+     */
+    uint32_t m_arrLossy[CODEPAGE_TABLE_COUNT][CODEPAGE_TABLE_COUNT][CODEPAGE_TABLE_SIZE / 32];
+
+    /**
+     * If every character is translated, by source and by target code page table index.
+     */
+    bool m_arrLossless[CODEPAGE_TABLE_COUNT][CODEPAGE_TABLE_COUNT];
+
+    CodePageTranslationTables()
+    {
+        memset(m_arrLossy, 0, sizeof(m_arrLossy));
+
+        const CodePageEncodingTables& objEncodingTables = getCodePageEncodingTables();
+        for(size_t from = 0; from < CODEPAGE_TABLE_COUNT; ++from)
+        {
+            const char32_t* pTable = getCodePageTable(m_arrTableCodePages[from], false);
+            for(size_t to = 0; to < CODEPAGE_TABLE_COUNT; ++to)
+            {
+                m_arrLossless[from][to] = true;
+                for(size_t code = 0; code < CODEPAGE_TABLE_SIZE; ++code)
+                {
+                    char narrowChar = 0;
+                    if(objEncodingTables.lookup(to, pTable[code], narrowChar))
+                    {
+                        m_arrTables[from][to][code] = static_cast<unsigned char>(narrowChar);
+                    }
+                    else
+                    {
+                        m_arrTables[from][to][code] = 0xFF;
+                        m_arrLossy[from][to][code >> 5] |= (uint32_t)1 << (code & 31);
+                        m_arrLossless[from][to] = false;
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * Checks if a character of the source code page can't be represented in the target code page.
+     *
+     * @param	from	the index of the source code page table
+     * @param	to		the index of the target code page table
+     * @param	code	the character of the source code page [0; 255]
+     * @return	'true' if the character can't be translated, 'false' otherwise
+     */
+    inline bool isLossy(const size_t from, const size_t to, const unsigned char code) const
+    {
+        return ((m_arrLossy[from][to][code >> 5] >> (code & 31)) & 1) != 0;
+    }
+};
+
+/**
+ * Gets the translation tables between the 8-bit code pages.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @return	the translation tables
+ * @since	1.0
+ */
+const CodePage2Unicode::CodePageTranslationTables& CodePage2Unicode::getCodePageTranslationTables(void)
+{
+    static const CodePageTranslationTables objTables;
+
+    return objTables;
+}
+
+/**
+ * Zero-extends the leading 7-bit ASCII blocks of a narrow string straight to UTF-32, using
+ * SIMD instructions when available, and stops at the first block with a non-ASCII character.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString	the narrow characters to be converted
+ * @param	length			the number of narrow characters
+ * @param	utf32String		receives the UTF-32 code points, must have room for 'length' code points
+ * @return	the number of characters converted, a multiple of ASCII_BLOCK_SIZE
+ * @since	1.0
+ */
+size_t CodePage2Unicode::convertAsciiBlocks_to_Utf32(const char* narrowString, const size_t length, char32_t* utf32String)
+{
+    size_t i = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    // 64 bytes blocks, with a single movemask for two 32 bytes vectors
+    for(; i + 64 <= length; i += 64)
+    {
+        __m256i vecLow = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(narrowString + i));
+        __m256i vecHigh = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(narrowString + i + 32));
+        if(_mm256_movemask_epi8(_mm256_or_si256(vecLow, vecHigh)) != 0)
+        {
+            // Non-ASCII character found, continue with the 16 bytes blocks
+            break;
+        }
+
+        for(size_t j = 0; j < 64; j += 8)
+        {
+            __m128i vecBytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(narrowString + i + j));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(utf32String + i + j), _mm256_cvtepu8_epi32(vecBytes));
+        }
+    }
+#endif
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE2)
+    // 16 bytes blocks
+    const __m128i vecZero = _mm_setzero_si128();
+    for(; i + 16 <= length; i += 16)
+    {
+        __m128i vecBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(narrowString + i));
+        if(_mm_movemask_epi8(vecBytes) != 0)
+        {
+            // Non-ASCII character found
+            break;
+        }
+
+        __m128i vecWordsLow = _mm_unpacklo_epi8(vecBytes, vecZero);
+        __m128i vecWordsHigh = _mm_unpackhi_epi8(vecBytes, vecZero);
+        __m128i* pUtf32 = reinterpret_cast<__m128i*>(utf32String + i);
+        _mm_storeu_si128(pUtf32, _mm_unpacklo_epi16(vecWordsLow, vecZero));
+        _mm_storeu_si128(pUtf32 + 1, _mm_unpackhi_epi16(vecWordsLow, vecZero));
+        _mm_storeu_si128(pUtf32 + 2, _mm_unpacklo_epi16(vecWordsHigh, vecZero));
+        _mm_storeu_si128(pUtf32 + 3, _mm_unpackhi_epi16(vecWordsHigh, vecZero));
+    }
+#else
+    // 8 bytes blocks, tested as a 64-bit word
+    for(; i + 8 <= length; i += 8)
+    {
+        uint64_t word = 0;
+        memcpy(&word, narrowString + i, sizeof(word));
+        if((word & 0x8080808080808080ULL) != 0)
+        {
+            // Non-ASCII character found
+            break;
+        }
+
+        for(size_t j = 0; j < 8; ++j)
+        {
+            utf32String[i + j] = static_cast<char32_t>(narrowString[i + j]);
+        }
+    }
+#endif
+
+    return i;
+}
+
+/**
+ * Gets the length of the leading 7-bit ASCII blocks of a narrow string, using SIMD instructions
+ * when available.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString	the narrow characters to be checked
+ * @param	length			the number of narrow characters
+ * @return	the number of leading characters in 7-bit ASCII blocks, a multiple of ASCII_BLOCK_SIZE
+ * @since	1.0
+ */
+size_t CodePage2Unicode::getAsciiBlocksLength(const char* narrowString, const size_t length)
+{
+    size_t i = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    // 64 bytes blocks, with a single movemask for two 32 bytes vectors
+    for(; i + 64 <= length; i += 64)
+    {
+        __m256i vecLow = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(narrowString + i));
+        __m256i vecHigh = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(narrowString + i + 32));
+        if(_mm256_movemask_epi8(_mm256_or_si256(vecLow, vecHigh)) != 0)
+        {
+            // Non-ASCII character found, continue with the 16 bytes blocks
+            break;
+        }
+    }
+#endif
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE2)
+    // 16 bytes blocks
+    for(; i + 16 <= length; i += 16)
+    {
+        __m128i vecBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(narrowString + i));
+        if(_mm_movemask_epi8(vecBytes) != 0)
+        {
+            // Non-ASCII character found
+            break;
+        }
+    }
+#else
+    // 8 bytes blocks, tested as a 64-bit word
+    for(; i + 8 <= length; i += 8)
+    {
+        uint64_t word = 0;
+        memcpy(&word, narrowString + i, sizeof(word));
+        if((word & 0x8080808080808080ULL) != 0)
+        {
+            // Non-ASCII character found
+            break;
+        }
+    }
+#endif
+
+    return i;
+}
+
+/**
+ * Zero-extends the leading 7-bit ASCII blocks of a narrow string straight to UTF-16, using
+ * SIMD instructions when available, and stops at the first block with a non-ASCII character.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString	the narrow characters to be converted
+ * @param	length			the number of narrow characters
+ * @param	utf16String		receives the UTF-16 code units, must have room for 'length' code units
+ * @return	the number of characters converted, a multiple of ASCII_BLOCK_SIZE
+ * @since	1.0
+ */
+size_t CodePage2Unicode::convertAsciiBlocks_to_Utf16(const char* narrowString, const size_t length, char16_t* utf16String)
+{
+    size_t i = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    // 64 bytes blocks, with a single movemask for two 32 bytes vectors
+    for(; i + 64 <= length; i += 64)
+    {
+        __m256i vecLow = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(narrowString + i));
+        __m256i vecHigh = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(narrowString + i + 32));
+        if(_mm256_movemask_epi8(_mm256_or_si256(vecLow, vecHigh)) != 0)
+        {
+            // Non-ASCII character found, continue with the 16 bytes blocks
+            break;
+        }
+
+        for(size_t j = 0; j < 64; j += 16)
+        {
+            __m128i vecBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(narrowString + i + j));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(utf16String + i + j), _mm256_cvtepu8_epi16(vecBytes));
+        }
+    }
+#endif
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE2)
+    // 16 bytes blocks
+    const __m128i vecZero = _mm_setzero_si128();
+    for(; i + 16 <= length; i += 16)
+    {
+        __m128i vecBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(narrowString + i));
+        if(_mm_movemask_epi8(vecBytes) != 0)
+        {
+            // Non-ASCII character found
+            break;
+        }
+
+        __m128i* pUtf16 = reinterpret_cast<__m128i*>(utf16String + i);
+        _mm_storeu_si128(pUtf16, _mm_unpacklo_epi8(vecBytes, vecZero));
+        _mm_storeu_si128(pUtf16 + 1, _mm_unpackhi_epi8(vecBytes, vecZero));
+    }
+#else
+    // 8 bytes blocks, tested as a 64-bit word
+    for(; i + 8 <= length; i += 8)
+    {
+        uint64_t word = 0;
+        memcpy(&word, narrowString + i, sizeof(word));
+        if((word & 0x8080808080808080ULL) != 0)
+        {
+            // Non-ASCII character found
+            break;
+        }
+
+        for(size_t j = 0; j < 8; ++j)
+        {
+            utf16String[i + j] = static_cast<char16_t>(narrowString[i + j]);
+        }
+    }
+#endif
+
+    return i;
+}
+
+/**
+ * Translates a narrow string byte by byte through a 256-entry table, using SIMD instructions when
+ * available (AVX2): the table is split in 16 rows of 16 bytes, looked up with byte shuffles, otherwise byte by byte.<br />
+ * Each row is shuffled with the bytes moved down by 16 for each row before it, saturated so only the
+ * bytes of the row keep the high bit of the shuffle index clear, and the other ones are zeroed.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	source			the bytes to be translated
+ * @param	length			the number of bytes
+ * @param	table			the 256-entry translation table
+ * @param	destination		receives the translated bytes, can be the source itself
+ * @since	1.0
+ */
+void CodePage2Unicode::translateBytes(const char* source, const size_t length, const unsigned char* table, char* destination)
+{
+    size_t i = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    __m256i arrRows[16];
+    for(size_t row = 0; row < 16; ++row)
+    {
+        arrRows[row] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table + 16 * row)));
+    }
+    const __m256i vecRowStep = _mm256_set1_epi8(0x10);
+    const __m256i vecRowBias = _mm256_set1_epi8(0x70);
+    // 4 independent vectors for each pass over the rows, so the shuffles of each row overlap
+    for(; i + 128 <= length; i += 128)
+    {
+        __m256i vecIndexes0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+        __m256i vecIndexes1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i + 32));
+        __m256i vecIndexes2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i + 64));
+        __m256i vecIndexes3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i + 96));
+        __m256i vecBytes0 = _mm256_setzero_si256();
+        __m256i vecBytes1 = _mm256_setzero_si256();
+        __m256i vecBytes2 = _mm256_setzero_si256();
+        __m256i vecBytes3 = _mm256_setzero_si256();
+        for(size_t row = 0; row < 16; ++row)
+        {
+            vecBytes0 = _mm256_or_si256(vecBytes0, _mm256_shuffle_epi8(arrRows[row], _mm256_adds_epu8(vecIndexes0, vecRowBias)));
+            vecBytes1 = _mm256_or_si256(vecBytes1, _mm256_shuffle_epi8(arrRows[row], _mm256_adds_epu8(vecIndexes1, vecRowBias)));
+            vecBytes2 = _mm256_or_si256(vecBytes2, _mm256_shuffle_epi8(arrRows[row], _mm256_adds_epu8(vecIndexes2, vecRowBias)));
+            vecBytes3 = _mm256_or_si256(vecBytes3, _mm256_shuffle_epi8(arrRows[row], _mm256_adds_epu8(vecIndexes3, vecRowBias)));
+            vecIndexes0 = _mm256_sub_epi8(vecIndexes0, vecRowStep);
+            vecIndexes1 = _mm256_sub_epi8(vecIndexes1, vecRowStep);
+            vecIndexes2 = _mm256_sub_epi8(vecIndexes2, vecRowStep);
+            vecIndexes3 = _mm256_sub_epi8(vecIndexes3, vecRowStep);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), vecBytes0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i + 32), vecBytes1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i + 64), vecBytes2);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i + 96), vecBytes3);
+    }
+#endif
+
+    for(; i < length; ++i)
+    {
+        destination[i] = static_cast<char>(table[static_cast<unsigned char>(source[i])]);
+    }
+}
+
+/**
+ * Translates the leading blocks of a narrow string through a 256-entry table, using SIMD instructions
+ * when available (AVX2), and stops at the first block translated to a non-ASCII character.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	source			the bytes to be translated
+ * @param	length			the number of bytes
+ * @param	table			the 256-entry translation table
+ * @param	destination		receives the translated 7-bit ASCII characters, must have room for 'length' bytes
+ * @return	the number of bytes translated, a multiple of ASCII_BLOCK_SIZE
+ * @since	1.0
+ */
+size_t CodePage2Unicode::translateAsciiBlocks(const char* source, const size_t length, const unsigned char* table, char* destination)
+{
+    size_t i = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    __m256i arrRows[16];
+    for(size_t row = 0; row < 16; ++row)
+    {
+        arrRows[row] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table + 16 * row)));
+    }
+    const __m256i vecRowStep = _mm256_set1_epi8(0x10);
+    const __m256i vecRowBias = _mm256_set1_epi8(0x70);
+    // 2 independent vectors for each pass over the rows, both stored only when they are 7-bit ASCII
+    for(; i + 64 <= length; i += 64)
+    {
+        __m256i vecIndexes0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+        __m256i vecIndexes1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i + 32));
+        __m256i vecBytes0 = _mm256_setzero_si256();
+        __m256i vecBytes1 = _mm256_setzero_si256();
+        for(size_t row = 0; row < 16; ++row)
+        {
+            vecBytes0 = _mm256_or_si256(vecBytes0, _mm256_shuffle_epi8(arrRows[row], _mm256_adds_epu8(vecIndexes0, vecRowBias)));
+            vecBytes1 = _mm256_or_si256(vecBytes1, _mm256_shuffle_epi8(arrRows[row], _mm256_adds_epu8(vecIndexes1, vecRowBias)));
+            vecIndexes0 = _mm256_sub_epi8(vecIndexes0, vecRowStep);
+            vecIndexes1 = _mm256_sub_epi8(vecIndexes1, vecRowStep);
+        }
+        if(_mm256_movemask_epi8(_mm256_or_si256(vecBytes0, vecBytes1)) != 0)
+        {
+            // Non-ASCII character found, the scalar blocks below find where
+            break;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), vecBytes0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i + 32), vecBytes1);
+    }
+#endif
+
+    // The AVX2 leftovers, or all the blocks without AVX2
+    for(; i + ASCII_BLOCK_SIZE <= length; i += ASCII_BLOCK_SIZE)
+    {
+        // The block is translated before it's checked, the destination has room for it
+        unsigned char bytes = 0;
+        for(size_t j = i; j < i + ASCII_BLOCK_SIZE; ++j)
+        {
+            unsigned char byte = table[static_cast<unsigned char>(source[j])];
+            destination[j] = static_cast<char>(byte);
+            bytes |= byte;
+        }
+        if((bytes & 0x80) != 0)
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+/**
+ * Narrows the leading 7-bit ASCII blocks of an UTF-16 string straight to UTF-8, using SIMD
+ * instructions when available, and stops at the first block with a non-ASCII character.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String		the UTF-16 code units to be converted
+ * @param	length			the number of UTF-16 code units
+ * @param	utf8String		receives the UTF-8 code units, must have room for 'length' code units
+ * @return	the number of code units converted, a multiple of 16
+ * @since	1.0
+ */
+size_t CodePage2Unicode::convertUtf16AsciiBlocks_to_Utf8(const char16_t* utf16String, const size_t length, char* utf8String)
+{
+    size_t i = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE2)
+    const __m128i vecZero = _mm_setzero_si128();
+    const __m128i vecNonAscii = _mm_set1_epi16(static_cast<short>(0xFF80));
+    for(; i + 16 <= length; i += 16)
+    {
+        __m128i vecLow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf16String + i));
+        __m128i vecHigh = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf16String + i + 8));
+        __m128i vecAscii = _mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(vecLow, vecHigh), vecNonAscii), vecZero);
+        if(_mm_movemask_epi8(vecAscii) != 0xFFFF)
+        {
+            // Non-ASCII character found
+            break;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(utf8String + i), _mm_packus_epi16(vecLow, vecHigh));
+    }
+#else
+    // No blocks are narrowed without SSE2, the scalar encoder converts the whole string
+    (void)utf16String;
+    (void)length;
+    (void)utf8String;
+#endif
+
+    return i;
+}
+
+/**
+ * Splits the leading blocks of an UTF-16 string with only 2 bytes UTF-8 characters [U+0080; U+07FF]
+ * (Latin, Greek, Cyrillic, Hebrew, Arabic, ...) straight to UTF-8, using SIMD instructions when
+ * available, and stops at the first block with other characters.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String		the UTF-16 code units to be converted
+ * @param	length			the number of UTF-16 code units
+ * @param	utf8String		receives the UTF-8 code units, must have room for twice 'length' code units
+ * @return	the number of UTF-16 code units converted, a multiple of 8
+ * @since	1.0
+ */
+size_t CodePage2Unicode::convertUtf16TwoBytesBlocks_to_Utf8(const char16_t* utf16String, const size_t length, char* utf8String)
+{
+    size_t i = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE2)
+    const __m128i vecZero = _mm_setzero_si128();
+    const __m128i vecNonAscii = _mm_set1_epi16(static_cast<short>(0xFF80));
+    const __m128i vecNonTwoBytes = _mm_set1_epi16(static_cast<short>(0xF800));
+    const __m128i vecLead = _mm_set1_epi16(static_cast<short>(0x00C0));
+    const __m128i vecNext = _mm_set1_epi16(static_cast<short>(0x0080));
+    const __m128i vecNextMask = _mm_set1_epi16(static_cast<short>(0x003F));
+    for(; i + 8 <= length; i += 8)
+    {
+        __m128i vecUtf16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf16String + i));
+        __m128i vecAscii = _mm_cmpeq_epi16(_mm_and_si128(vecUtf16, vecNonAscii), vecZero);
+        __m128i vecTwoBytes = _mm_cmpeq_epi16(_mm_and_si128(vecUtf16, vecNonTwoBytes), vecZero);
+        if(_mm_movemask_epi8(_mm_andnot_si128(vecAscii, vecTwoBytes)) != 0xFFFF)
+        {
+            // Other character found
+            break;
+        }
+
+        // Lead byte (110xxxxx) in the low byte and next byte (10xxxxxx) in the high byte of each word
+        __m128i vecLeads = _mm_or_si128(_mm_srli_epi16(vecUtf16, UTF8_HALF_SHIFT), vecLead);
+        __m128i vecNexts = _mm_slli_epi16(_mm_or_si128(_mm_and_si128(vecUtf16, vecNextMask), vecNext), 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(utf8String + 2 * i), _mm_or_si128(vecLeads, vecNexts));
+    }
+#else
+    // No blocks are split without SSE2, the scalar encoder converts the whole string
+    (void)utf16String;
+    (void)length;
+    (void)utf8String;
+#endif
+
+    return i;
+}
+
+/**
+ * Joins the leading blocks of an UTF-8 string with only 2 bytes sequences, starting at a sequence
+ * boundary, straight to UTF-16, using SIMD instructions when available, and stops at the first
+ * block with other sequences. Overlong sequences are left to the scalar decoder.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String		the UTF-8 code units to be converted
+ * @param	length			the number of UTF-8 code units
+ * @param	utf16String		receives the UTF-16 code units, must have room for half 'length' code units
+ * @return	the number of UTF-8 code units converted, a multiple of 16
+ * @since	1.0
+ */
+size_t CodePage2Unicode::convertUtf8TwoBytesBlocks_to_Utf16(const char* utf8String, const size_t length, char16_t* utf16String)
+{
+    size_t i = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE2)
+    const __m128i vecZero = _mm_setzero_si128();
+    const __m128i vecSequenceMask = _mm_set1_epi16(static_cast<short>(0xC0E0));
+    const __m128i vecSequence = _mm_set1_epi16(static_cast<short>(0x80C0));
+    const __m128i vecOverlongMask = _mm_set1_epi16(static_cast<short>(0x001E));
+    const __m128i vecLeadMask = _mm_set1_epi16(static_cast<short>(0x001F));
+    const __m128i vecNextMask = _mm_set1_epi16(static_cast<short>(0x003F));
+    for(; i + 16 <= length; i += 16)
+    {
+        // Lead byte (110xxxxx) in the low byte and next byte (10xxxxxx) in the high byte of each word
+        __m128i vecUtf8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8String + i));
+        __m128i vecTwoBytes = _mm_cmpeq_epi16(_mm_and_si128(vecUtf8, vecSequenceMask), vecSequence);
+        __m128i vecOverlong = _mm_cmpeq_epi16(_mm_and_si128(vecUtf8, vecOverlongMask), vecZero);
+        if(_mm_movemask_epi8(_mm_andnot_si128(vecOverlong, vecTwoBytes)) != 0xFFFF)
+        {
+            // Other sequence found
+            break;
+        }
+
+        __m128i vecLeads = _mm_slli_epi16(_mm_and_si128(vecUtf8, vecLeadMask), UTF8_HALF_SHIFT);
+        __m128i vecNexts = _mm_and_si128(_mm_srli_epi16(vecUtf8, 8), vecNextMask);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(utf16String + i / 2), _mm_or_si128(vecLeads, vecNexts));
+    }
+#else
+    // No blocks are joined without SSE2, the scalar decoder converts the whole string
+    (void)utf8String;
+    (void)length;
+    (void)utf16String;
+#endif
+
+    return i;
+}
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSSE3)
+/**
+ * Lookup tables to pack the 8 lanes of a vector to Latin-1 or UTF-8: the expansion tables keep the low byte
+ * of each 16-bit lane and the high byte of the lanes with a 2 bytes UTF-8 sequence, by the mask of those lanes,
+ * and the narrowing tables keep the bytes of the 8 low lanes, by the mask of the bytes to keep.
+ */
+struct CodePage2Unicode::Latin1PackTables
+{
+    unsigned char m_arrExpandShuffles[256][16];
+    unsigned char m_arrExpandLengths[256];
+    unsigned char m_arrNarrowShuffles[256][16];
+    unsigned char m_arrNarrowLengths[256];
+
+    Latin1PackTables()
+    {
+        for(unsigned int mask = 0; mask < 256; ++mask)
+        {
+            unsigned int count = 0;
+            for(unsigned int lane = 0; lane < 8; ++lane)
+            {
+                m_arrExpandShuffles[mask][count++] = static_cast<unsigned char>(2 * lane);
+                if(mask & (1U << lane))
+                {
+                    m_arrExpandShuffles[mask][count++] = static_cast<unsigned char>(2 * lane + 1);
+                }
+            }
+            m_arrExpandLengths[mask] = static_cast<unsigned char>(count);
+            for(; count < 16; ++count)
+            {
+                // Zero the unused bytes
+                m_arrExpandShuffles[mask][count] = 0x80U;
+            }
+
+            count = 0;
+            for(unsigned int lane = 0; lane < 8; ++lane)
+            {
+                if(mask & (1U << lane))
+                {
+                    m_arrNarrowShuffles[mask][count++] = static_cast<unsigned char>(lane);
+                }
+            }
+            m_arrNarrowLengths[mask] = static_cast<unsigned char>(count);
+            for(; count < 16; ++count)
+            {
+                // Zero the unused bytes
+                m_arrNarrowShuffles[mask][count] = 0x80U;
+            }
+        }
+    }
+};
+
+/**
+ * Gets the Latin-1 packing lookup tables, built on the first call.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @return	the Latin-1 packing lookup tables
+ * @since	1.0
+ */
+const CodePage2Unicode::Latin1PackTables& CodePage2Unicode::getLatin1PackTables()
+{
+    static const Latin1PackTables objTables;
+
+    return objTables;
+}
+#endif
+
+/**
+ * Expands the leading blocks of a Latin-1 based string straight to UTF-8, using SIMD instructions when
+ * available (SSSE3), and stops at the first block with a character of the code page that isn't the Latin-1
+ * character of the same value, or when the room left for the UTF-8 code units is too small for a block.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	latin1String	the Latin-1 based characters to be converted
+ * @param	length			the number of characters
+ * @param	utf8String		receives the UTF-8 code units
+ * @param	utf8Room		the room for UTF-8 code units
+ * @param	patches			the nibble classification tables of the characters that aren't Latin-1
+ * @param	utf8Length		receives the number of UTF-8 code units
+ * @return	the number of characters converted
+ * @since	1.0
+ */
+size_t CodePage2Unicode::convertLatin1Blocks_to_Utf8(const char* latin1String, const size_t length, char* utf8String, const size_t utf8Room,
+                                                     const unsigned char* patches, size_t& utf8Length)
+{
+    size_t i = 0;
+    size_t count = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSSE3)
+    const Latin1PackTables& objTables = getLatin1PackTables();
+    const __m128i vecZero = _mm_setzero_si128();
+    const __m128i vecNibbleMask = _mm_set1_epi8(0x0F);
+    const __m128i vecPatchesHigh = _mm_loadu_si128(reinterpret_cast<const __m128i*>(patches));
+    const __m128i vecPatchesLow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(patches + 16));
+    const __m128i vecAsciiMax = _mm_set1_epi16(0x7F);
+    const __m128i vecSequence = _mm_set1_epi16(static_cast<short>(0x80C0));
+    const __m128i vecNextMask = _mm_set1_epi16(static_cast<short>(0x003F));
+    // Each block gives at most 32 code units
+    for(; (i + 16 <= length) && (count + 32 <= utf8Room); i += 16)
+    {
+        __m128i vecBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(latin1String + i));
+        unsigned int nonAscii = static_cast<unsigned int>(_mm_movemask_epi8(vecBytes));
+        if(nonAscii == 0)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(utf8String + count), vecBytes);
+            count += 16;
+            continue;
+        }
+
+        __m128i vecPatched = _mm_and_si128(_mm_shuffle_epi8(vecPatchesHigh, _mm_and_si128(_mm_srli_epi16(vecBytes, 4), vecNibbleMask)),
+                                           _mm_shuffle_epi8(vecPatchesLow, _mm_and_si128(vecBytes, vecNibbleMask)));
+        if(_mm_movemask_epi8(_mm_cmpeq_epi8(vecPatched, vecZero)) != 0xFFFF)
+        {
+            // Character of the code page found
+            break;
+        }
+
+        for(size_t half = 0; half < 2; ++half)
+        {
+            // Lead byte (110000xx) in the low byte and next byte (10xxxxxx) in the high byte of each word
+            __m128i vecChars = (half == 0) ? _mm_unpacklo_epi8(vecBytes, vecZero) : _mm_unpackhi_epi8(vecBytes, vecZero);
+            __m128i vecSequences = _mm_or_si128(_mm_or_si128(_mm_srli_epi16(vecChars, UTF8_HALF_SHIFT),
+                                                             _mm_slli_epi16(_mm_and_si128(vecChars, vecNextMask), 8)), vecSequence);
+            __m128i vecTwoBytes = _mm_cmpgt_epi16(vecChars, vecAsciiMax);
+            vecSequences = _mm_or_si128(_mm_and_si128(vecTwoBytes, vecSequences), _mm_andnot_si128(vecTwoBytes, vecChars));
+
+            unsigned int mask = (nonAscii >> (8 * half)) & 0xFF;
+            __m128i vecShuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(objTables.m_arrExpandShuffles[mask]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(utf8String + count), _mm_shuffle_epi8(vecSequences, vecShuffle));
+            count += objTables.m_arrExpandLengths[mask];
+        }
+    }
+#else
+    // Copy the 7-bit ASCII blocks only, the nibble classification tables are for the SIMD byte shuffles
+    (void)patches;
+    i = getAsciiBlocksLength(latin1String, min(length, utf8Room));
+    memcpy(utf8String, latin1String, i);
+    count = i;
+#endif
+
+    utf8Length = count;
+
+    return i;
+}
+
+/**
+ * Narrows the leading blocks of an UTF-8 string with only 7-bit ASCII and Latin-1 characters, starting
+ * at a sequence boundary, to a Latin-1 based string, using SIMD instructions when available (SSSE3), and
+ * stops at the first block with other sequences or with a character that the code page has elsewhere, or
+ * when the room left for the characters is too small for a block. A lead code unit at the end of a block
+ * is left to the next block.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String		the UTF-8 code units to be converted
+ * @param	length			the number of UTF-8 code units
+ * @param	latin1String	receives the Latin-1 based characters
+ * @param	latin1Room		the room for characters
+ * @param	patches			the nibble classification tables of the characters that aren't Latin-1
+ * @param	latin1Length	receives the number of characters
+ * @return	the number of UTF-8 code units converted
+ * @since	1.0
+ */
+size_t CodePage2Unicode::convertUtf8Blocks_to_Latin1(const char* utf8String, const size_t length, char* latin1String, const size_t latin1Room,
+                                                     const unsigned char* patches, size_t& latin1Length)
+{
+    size_t i = 0;
+    size_t count = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSSE3)
+    const Latin1PackTables& objTables = getLatin1PackTables();
+    const __m128i vecZero = _mm_setzero_si128();
+    const __m128i vecNibbleMask = _mm_set1_epi8(0x0F);
+    const __m128i vecPatchesHigh = _mm_loadu_si128(reinterpret_cast<const __m128i*>(patches));
+    const __m128i vecPatchesLow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(patches + 16));
+    const __m128i vecLeadMask = _mm_set1_epi8(static_cast<char>(0xFE));
+    const __m128i vecLead = _mm_set1_epi8(static_cast<char>(0xC2));
+    const __m128i vecNextTagMask = _mm_set1_epi8(static_cast<char>(0xC0));
+    const __m128i vecNext = _mm_set1_epi8(static_cast<char>(UTF8_NEXT));
+    const __m128i vecLeadBitsMask = _mm_set1_epi8(0x03);
+    const __m128i vecNextMask = _mm_set1_epi8(0x3F);
+    // Each block gives at most 16 characters
+    while((i + 16 <= length) && (count + 16 <= latin1Room))
+    {
+        __m128i vecUtf8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8String + i));
+        unsigned int nonAscii = static_cast<unsigned int>(_mm_movemask_epi8(vecUtf8));
+        if(nonAscii == 0)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(latin1String + count), vecUtf8);
+            i += 16;
+            count += 16;
+            continue;
+        }
+
+        // Only the 2 bytes sequences of U+0080 to U+00FF: leads 0xC2 or 0xC3, each one followed by a next code unit
+        __m128i vecLeads = _mm_cmpeq_epi8(_mm_and_si128(vecUtf8, vecLeadMask), vecLead);
+        unsigned int leads = static_cast<unsigned int>(_mm_movemask_epi8(vecLeads));
+        unsigned int nexts = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(vecUtf8, vecNextTagMask), vecNext)));
+        size_t blockSize = 16;
+        if((leads & 0x8000U) != 0)
+        {
+            // The sequence of the last lead is left to the next block
+            blockSize = 15;
+            leads &= 0x7FFFU;
+            nonAscii &= 0x7FFFU;
+        }
+        if(((leads | nexts) != nonAscii) || (nexts != (leads << 1)))
+        {
+            // Other sequence found
+            break;
+        }
+
+        // The character of each sequence at it's lead: the 2 low bits of the lead and the 6 low bits of the next code unit
+        __m128i vecChars = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(vecUtf8, vecLeadBitsMask), UTF8_HALF_SHIFT),
+                                        _mm_and_si128(_mm_srli_si128(vecUtf8, 1), vecNextMask));
+        vecChars = _mm_or_si128(_mm_and_si128(vecLeads, vecChars), _mm_andnot_si128(vecLeads, vecUtf8));
+
+        unsigned int keep = ~nexts & ((1U << blockSize) - 1);
+        __m128i vecPatched = _mm_and_si128(_mm_shuffle_epi8(vecPatchesHigh, _mm_and_si128(_mm_srli_epi16(vecChars, 4), vecNibbleMask)),
+                                           _mm_shuffle_epi8(vecPatchesLow, _mm_and_si128(vecChars, vecNibbleMask)));
+        if((~static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(vecPatched, vecZero))) & keep) != 0)
+        {
+            // Character that the code page has elsewhere found
+            break;
+        }
+
+        unsigned int maskLow = keep & 0xFF;
+        unsigned int maskHigh = keep >> 8;
+        __m128i vecShuffleLow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(objTables.m_arrNarrowShuffles[maskLow]));
+        __m128i vecShuffleHigh = _mm_loadu_si128(reinterpret_cast<const __m128i*>(objTables.m_arrNarrowShuffles[maskHigh]));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(latin1String + count), _mm_shuffle_epi8(vecChars, vecShuffleLow));
+        count += objTables.m_arrNarrowLengths[maskLow];
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(latin1String + count), _mm_shuffle_epi8(_mm_srli_si128(vecChars, 8), vecShuffleHigh));
+        count += objTables.m_arrNarrowLengths[maskHigh];
+        i += blockSize;
+    }
+#else
+    // Copy the 7-bit ASCII blocks only, the nibble classification tables are for the SIMD byte shuffles
+    (void)patches;
+    i = getAsciiBlocksLength(utf8String, min(length, latin1Room));
+    memcpy(latin1String, utf8String, i);
+    count = i;
+#endif
+
+    latin1Length = count;
+
+    return i;
+}
+
+/**
+ * Zero-extends the leading blocks of a Latin-1 based string straight to UTF-16, using SIMD instructions
+ * when available (SSSE3 or AVX2), and stops at the first block with a character of the code page that
+ * isn't the Latin-1 character of the same value.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	latin1String	the Latin-1 based characters to be converted
+ * @param	length			the number of characters
+ * @param	utf16String		receives the UTF-16 code units, must have room for 'length' code units
+ * @param	patches			the nibble classification tables of the characters that aren't Latin-1
+ * @return	the number of characters converted, a multiple of 16
+ * @since	1.0
+ */
+size_t CodePage2Unicode::convertLatin1Blocks_to_Utf16(const char* latin1String, const size_t length, char16_t* utf16String,
+                                                      const unsigned char* patches)
+{
+    size_t i = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    const __m256i vecNibbleMask256 = _mm256_set1_epi8(0x0F);
+    const __m256i vecPatchesHigh256 = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(patches)));
+    const __m256i vecPatchesLow256 = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(patches + 16)));
+    for(; i + 32 <= length; i += 32)
+    {
+        __m256i vecBytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(latin1String + i));
+        __m256i vecPatched = _mm256_and_si256(_mm256_shuffle_epi8(vecPatchesHigh256, _mm256_and_si256(_mm256_srli_epi16(vecBytes, 4), vecNibbleMask256)),
+                                              _mm256_shuffle_epi8(vecPatchesLow256, _mm256_and_si256(vecBytes, vecNibbleMask256)));
+        if(!_mm256_testz_si256(vecPatched, vecPatched))
+        {
+            // Character of the code page found
+            break;
+        }
+
+        __m256i* pUtf16 = reinterpret_cast<__m256i*>(utf16String + i);
+        _mm256_storeu_si256(pUtf16, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(vecBytes)));
+        _mm256_storeu_si256(pUtf16 + 1, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(vecBytes, 1)));
+    }
+#endif
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSSE3)
+    // The AVX2 leftovers, or all the blocks with SSSE3
+    const __m128i vecZero = _mm_setzero_si128();
+    const __m128i vecNibbleMask = _mm_set1_epi8(0x0F);
+    const __m128i vecPatchesHigh = _mm_loadu_si128(reinterpret_cast<const __m128i*>(patches));
+    const __m128i vecPatchesLow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(patches + 16));
+    for(; i + 16 <= length; i += 16)
+    {
+        __m128i vecBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(latin1String + i));
+        __m128i vecPatched = _mm_and_si128(_mm_shuffle_epi8(vecPatchesHigh, _mm_and_si128(_mm_srli_epi16(vecBytes, 4), vecNibbleMask)),
+                                           _mm_shuffle_epi8(vecPatchesLow, _mm_and_si128(vecBytes, vecNibbleMask)));
+        if(_mm_movemask_epi8(_mm_cmpeq_epi8(vecPatched, vecZero)) != 0xFFFF)
+        {
+            // Character of the code page found
+            break;
+        }
+
+        __m128i* pUtf16 = reinterpret_cast<__m128i*>(utf16String + i);
+        _mm_storeu_si128(pUtf16, _mm_unpacklo_epi8(vecBytes, vecZero));
+        _mm_storeu_si128(pUtf16 + 1, _mm_unpackhi_epi8(vecBytes, vecZero));
+    }
+#else
+    // Zero-extend the 7-bit ASCII blocks only, the nibble classification tables are for the SIMD byte shuffles
+    (void)patches;
+    i = convertAsciiBlocks_to_Utf16(latin1String, length, utf16String);
+#endif
+
+    return i;
+}
+
+/**
+ * Narrows the leading blocks of an UTF-16 string with only 7-bit ASCII and Latin-1 characters straight to
+ * a Latin-1 based string, using SIMD instructions when available (SSSE3 or AVX2), and stops at the first
+ * block with other characters or with a character that the code page has elsewhere.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String		the UTF-16 code units to be converted
+ * @param	length			the number of UTF-16 code units
+ * @param	latin1String	receives the Latin-1 based characters, must have room for 'length' characters
+ * @param	patches			the nibble classification tables of the characters that aren't Latin-1
+ * @return	the number of code units converted, a multiple of 16
+ * @since	1.0
+ */
+size_t CodePage2Unicode::convertUtf16Blocks_to_Latin1(const char16_t* utf16String, const size_t length, char* latin1String,
+                                                      const unsigned char* patches)
+{
+    size_t i = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    const __m256i vecNonLatin1_256 = _mm256_set1_epi16(static_cast<short>(0xFF00));
+    const __m256i vecNibbleMask256 = _mm256_set1_epi8(0x0F);
+    const __m256i vecPatchesHigh256 = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(patches)));
+    const __m256i vecPatchesLow256 = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(patches + 16)));
+    for(; i + 32 <= length; i += 32)
+    {
+        __m256i vecLow = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(utf16String + i));
+        __m256i vecHigh = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(utf16String + i + 16));
+        if(!_mm256_testz_si256(_mm256_or_si256(vecLow, vecHigh), vecNonLatin1_256))
+        {
+            // Character above U+00FF found
+            break;
+        }
+
+        // The packing is done in each 128-bit lane, so the quadwords are put back in order
+        __m256i vecBytes = _mm256_permute4x64_epi64(_mm256_packus_epi16(vecLow, vecHigh), 0xD8);
+        __m256i vecPatched = _mm256_and_si256(_mm256_shuffle_epi8(vecPatchesHigh256, _mm256_and_si256(_mm256_srli_epi16(vecBytes, 4), vecNibbleMask256)),
+                                              _mm256_shuffle_epi8(vecPatchesLow256, _mm256_and_si256(vecBytes, vecNibbleMask256)));
+        if(!_mm256_testz_si256(vecPatched, vecPatched))
+        {
+            // Character that the code page has elsewhere found
+            break;
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(latin1String + i), vecBytes);
+    }
+#endif
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSSE3)
+    // The AVX2 leftovers, or all the blocks with SSSE3
+    const __m128i vecZero = _mm_setzero_si128();
+    const __m128i vecNonLatin1 = _mm_set1_epi16(static_cast<short>(0xFF00));
+    const __m128i vecNibbleMask = _mm_set1_epi8(0x0F);
+    const __m128i vecPatchesHigh = _mm_loadu_si128(reinterpret_cast<const __m128i*>(patches));
+    const __m128i vecPatchesLow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(patches + 16));
+    for(; i + 16 <= length; i += 16)
+    {
+        __m128i vecLow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf16String + i));
+        __m128i vecHigh = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf16String + i + 8));
+        __m128i vecLatin1 = _mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(vecLow, vecHigh), vecNonLatin1), vecZero);
+        if(_mm_movemask_epi8(vecLatin1) != 0xFFFF)
+        {
+            // Character above U+00FF found
+            break;
+        }
+
+        __m128i vecBytes = _mm_packus_epi16(vecLow, vecHigh);
+        __m128i vecPatched = _mm_and_si128(_mm_shuffle_epi8(vecPatchesHigh, _mm_and_si128(_mm_srli_epi16(vecBytes, 4), vecNibbleMask)),
+                                           _mm_shuffle_epi8(vecPatchesLow, _mm_and_si128(vecBytes, vecNibbleMask)));
+        if(_mm_movemask_epi8(_mm_cmpeq_epi8(vecPatched, vecZero)) != 0xFFFF)
+        {
+            // Character that the code page has elsewhere found
+            break;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(latin1String + i), vecBytes);
+    }
+#else
+    // Narrow the 7-bit ASCII blocks only, the nibble classification tables are for the SIMD byte shuffles
+    (void)patches;
+    i = convertUtf16AsciiBlocks_to_Utf8(utf16String, length, latin1String);
+#endif
+
+    return i;
+}
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE4_1)
+/**
+ * Lookup tables to left-pack the 8 UTF-16 lanes of a vector, by the mask of the lanes to keep.
+ */
+struct CodePage2Unicode::LeftPackTables
+{
+    unsigned char m_arrShuffles[256][16];
+    unsigned char m_arrCounts[256];
+
+    LeftPackTables()
+    {
+        for(unsigned int mask = 0; mask < 256; ++mask)
+        {
+            unsigned int count = 0;
+            for(unsigned int lane = 0; lane < 8; ++lane)
+            {
+                if(mask & (1U << lane))
+                {
+                    m_arrShuffles[mask][2 * count] = static_cast<unsigned char>(2 * lane);
+                    m_arrShuffles[mask][2 * count + 1] = static_cast<unsigned char>(2 * lane + 1);
+                    ++count;
+                }
+            }
+            for(unsigned int j = 2 * count; j < 16; ++j)
+            {
+                // Zero the unused lanes
+                m_arrShuffles[mask][j] = 0x80U;
+            }
+            m_arrCounts[mask] = static_cast<unsigned char>(count);
+        }
+    }
+};
+
+/**
+ * Gets the left-pack lookup tables, built on the first call.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @return	the left-pack lookup tables
+ * @since	1.0
+ */
+const CodePage2Unicode::LeftPackTables& CodePage2Unicode::getLeftPackTables()
+{
+    static const LeftPackTables objTables;
+
+    return objTables;
+}
+
+/**
+ * Classifies the code units of an UTF-8 block and gets the leads of the complete sequences.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	nonAscii	the mask of the code units with the high bit set
+ * @param	nexts		the mask of the next code units (10xxxxxx)
+ * @param	leads3		the mask of the 3 bytes sequences leads (1110xxxx)
+ * @param	leads4		the mask of the 4 (or more) bytes sequences leads (1111xxxx)
+ * @param	blockSize	the number of code units of the block
+ * @param	leads		receives the mask of the leads of the complete sequences
+ * @return	the number of code units of the complete sequences, or 0 if the block has 4 bytes
+ *          sequences or isn't well structured
+ * @since	1.0
+ */
+size_t CodePage2Unicode::getUtf8BlockLeads(const uint64_t nonAscii, const uint64_t nexts, const uint64_t leads3, const uint64_t leads4, const size_t blockSize, uint64_t& leads)
+{
+    if(leads4 != 0)
+    {
+        return 0;
+    }
+
+    // Each lead must be followed by exactly the right number of next code units
+    uint64_t leads2 = nonAscii & ~nexts & ~leads3;
+    uint64_t expectedNexts = (leads2 << 1) | (leads3 << 1) | (leads3 << 2);
+    uint64_t blockMask = (static_cast<uint64_t>(1) << blockSize) - 1;
+    if((expectedNexts & blockMask) != nexts)
+    {
+        return 0;
+    }
+
+    // The last sequence may continue into the next block
+    size_t consumed = blockSize;
+    if((expectedNexts & ~blockMask) != 0)
+    {
+        consumed = blockSize - 1;
+        while(!((leads2 | leads3) & (static_cast<uint64_t>(1) << consumed)))
+        {
+            --consumed;
+        }
+    }
+
+    leads = ~nexts & ((static_cast<uint64_t>(1) << consumed) - 1);
+
+    return consumed;
+}
+#endif
+
+/**
+ * Decodes the leading blocks of an UTF-8 string with only 1, 2 and 3 bytes sequences, starting at
+ * a sequence boundary, to UTF-32, using SIMD instructions when available, and stops at the first
+ * block with 4 bytes or ill-formed sequences, or with Unicode non-characters.
+ * Each block is classified by code unit, each code unit is decoded in a 16-bit lane as if it was a
+ * sequence lead, and the code points of the real leads are left-packed with byte shuffles and
+ * zero-extended to UTF-32. The results are the same of the scalar decoder.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String		the UTF-8 code units to be converted
+ * @param	length			the number of UTF-8 code units
+ * @param	utf32String		receives the UTF-32 code points, must have room for 'length' code points
+ * @param	utf32Length		receives the number of UTF-32 code points
+ * @return	the number of UTF-8 code units converted
+ * @since	1.0
+ */
+size_t CodePage2Unicode::convertUtf8Blocks_to_Utf32(const char* utf8String, const size_t length, char32_t* utf32String, size_t& utf32Length)
+{
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE4_1)
+    const LeftPackTables& objTables = getLeftPackTables();
+    size_t i = 0;
+    size_t count = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    const __m256i vecNextsMask = _mm256_set1_epi8(static_cast<char>(0xC0U));
+    const __m256i vecNexts = _mm256_set1_epi8(static_cast<char>(0x80U));
+    const __m256i vecLeadsMask = _mm256_set1_epi8(static_cast<char>(0xF0U));
+    const __m256i vecLeads3 = _mm256_set1_epi8(static_cast<char>(0xE0U));
+    const __m256i vecLeadNonCharacter = _mm256_set1_epi8(static_cast<char>(0xEFU));
+    const __m256i vecLeadOverlongMask = _mm256_set1_epi8(static_cast<char>(0xFEU));
+    const __m256i vecLeadOverlong = _mm256_set1_epi8(static_cast<char>(0xC0U));
+    const __m256i vecLeadE0 = _mm256_set1_epi8(static_cast<char>(0xE0U));
+    const __m256i vecLeadED = _mm256_set1_epi8(static_cast<char>(0xEDU));
+
+    // Decodes 16 code units, each one as if it was a sequence lead, with the 2 code units that follow them
+    auto decodeUtf8Lanes = [](const __m128i vecBytes0, const __m128i vecBytes1, const __m128i vecBytes2) -> __m256i
+    {
+        const __m256i vecNextMask = _mm256_set1_epi16(0x3F);
+        __m256i vecLead = _mm256_cvtepu8_epi16(vecBytes0);
+        __m256i vecNext1 = _mm256_and_si256(_mm256_cvtepu8_epi16(vecBytes1), vecNextMask);
+        __m256i vecNext2 = _mm256_and_si256(_mm256_cvtepu8_epi16(vecBytes2), vecNextMask);
+
+        __m256i vecTwoBytes = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(vecLead, _mm256_set1_epi16(0x1F)), 6), vecNext1);
+        __m256i vecThreeBytes = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(vecLead, 12), _mm256_slli_epi16(vecNext1, 6)), vecNext2);
+        __m256i vecCodePoints = _mm256_blendv_epi8(vecThreeBytes, vecTwoBytes, _mm256_cmpgt_epi16(_mm256_set1_epi16(0xE0), vecLead));
+
+        return _mm256_blendv_epi8(vecCodePoints, vecLead, _mm256_cmpgt_epi16(_mm256_set1_epi16(0x80), vecLead));
+    };
+
+    // Gets the mask of the lanes with non-characters [U+FDD0; U+FDEF], U+FFFE and U+FFFF
+    auto getNonCharacters = [](const __m256i vecCodePoints) -> uint64_t
+    {
+        __m256i vecOffset = _mm256_sub_epi16(vecCodePoints, _mm256_set1_epi16(static_cast<short>(0xFDD0)));
+        __m256i vecBad = _mm256_or_si256(_mm256_cmpeq_epi16(_mm256_min_epu16(vecOffset, _mm256_set1_epi16(0x1F)), vecOffset),
+                                         _mm256_cmpeq_epi16(_mm256_max_epu16(vecCodePoints, _mm256_set1_epi16(static_cast<short>(0xFFFE))), vecCodePoints));
+        __m256i vecPacked = _mm256_permute4x64_epi64(_mm256_packs_epi16(vecBad, vecBad), 0xD8);
+
+        return static_cast<uint16_t>(_mm256_movemask_epi8(vecPacked));
+    };
+
+    for(; i + 32 <= length; )
+    {
+        __m256i vecUtf8 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(utf8String + i));
+        uint64_t nonAscii = static_cast<uint32_t>(_mm256_movemask_epi8(vecUtf8));
+        if(nonAscii == 0)
+        {
+            // 7-bit ASCII block
+            for(size_t j = 0; j < 32; j += 8)
+            {
+                __m128i vecBytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(utf8String + i + j));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(utf32String + count + j), _mm256_cvtepu8_epi32(vecBytes));
+            }
+            i += 32;
+            count += 32;
+            continue;
+        }
+
+        __m256i vecMasked = _mm256_and_si256(vecUtf8, vecLeadsMask);
+        uint64_t nexts = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(vecUtf8, vecNextsMask), vecNexts)));
+        uint64_t leads3 = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(vecMasked, vecLeads3)));
+        uint64_t leads4 = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(vecMasked, vecLeadsMask)));
+        uint64_t leads = 0;
+        size_t consumed = getUtf8BlockLeads(nonAscii, nexts, leads3, leads4, 32, leads);
+        if(consumed == 0)
+        {
+            // 4 bytes or invalid sequences found
+            break;
+        }
+
+        // Overlong forms (0xC0 and 0xC1 leads, 0xE0 followed by [0x80; 0x9F]) and UTF-16 surrogates (0xED followed by [0xA0; 0xBF])
+        uint64_t leadsOverlong = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(vecUtf8, vecLeadOverlongMask), vecLeadOverlong)));
+        uint64_t leadsE0 = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(vecUtf8, vecLeadE0)));
+        uint64_t leadsED = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(vecUtf8, vecLeadED)));
+        uint64_t nextsHigh = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_slli_epi16(vecUtf8, 2))) >> 1;
+        if(((leadsOverlong | (leadsE0 & ~nextsHigh) | (leadsED & nextsHigh)) & leads) != 0)
+        {
+            // Ill-formed sequences found
+            break;
+        }
+
+        // The block and the 2 code units that follow each one
+        __m128i vecLow = _mm256_castsi256_si128(vecUtf8);
+        __m128i vecHigh = _mm256_extracti128_si256(vecUtf8, 1);
+        __m256i vecCodePointsLow = decodeUtf8Lanes(vecLow, _mm_alignr_epi8(vecHigh, vecLow, 1), _mm_alignr_epi8(vecHigh, vecLow, 2));
+        __m256i vecCodePointsHigh = decodeUtf8Lanes(vecHigh, _mm_srli_si128(vecHigh, 1), _mm_srli_si128(vecHigh, 2));
+
+        uint64_t leadsNonCharacter = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(vecUtf8, vecLeadNonCharacter))) & leads;
+        if((leadsNonCharacter != 0) &&
+           (((getNonCharacters(vecCodePointsLow) | (getNonCharacters(vecCodePointsHigh) << 16)) & leadsNonCharacter) != 0))
+        {
+            // Unicode non-characters found
+            break;
+        }
+
+        const __m256i arrCodePoints[2] = {
+            vecCodePointsLow, vecCodePointsHigh
+        };
+        for(size_t j = 0; j < 2; ++j)
+        {
+            unsigned int maskLow = static_cast<unsigned int>((leads >> (16 * j)) & 0xFF);
+            unsigned int maskHigh = static_cast<unsigned int>((leads >> (16 * j + 8)) & 0xFF);
+            __m256i vecShuffle = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(objTables.m_arrShuffles[maskLow]))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(objTables.m_arrShuffles[maskHigh])), 1);
+            __m256i vecPacked = _mm256_shuffle_epi8(arrCodePoints[j], vecShuffle);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(utf32String + count), _mm256_cvtepu16_epi32(_mm256_castsi256_si128(vecPacked)));
+            count += objTables.m_arrCounts[maskLow];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(utf32String + count), _mm256_cvtepu16_epi32(_mm256_extracti128_si256(vecPacked, 1)));
+            count += objTables.m_arrCounts[maskHigh];
+        }
+        i += consumed;
+    }
+#else
+    const __m128i vecZero = _mm_setzero_si128();
+    const __m128i vecNextsMask = _mm_set1_epi8(static_cast<char>(0xC0U));
+    const __m128i vecNexts = _mm_set1_epi8(static_cast<char>(0x80U));
+    const __m128i vecLeadsMask = _mm_set1_epi8(static_cast<char>(0xF0U));
+    const __m128i vecLeads3 = _mm_set1_epi8(static_cast<char>(0xE0U));
+    const __m128i vecLeadNonCharacter = _mm_set1_epi8(static_cast<char>(0xEFU));
+    const __m128i vecLeadOverlongMask = _mm_set1_epi8(static_cast<char>(0xFEU));
+    const __m128i vecLeadOverlong = _mm_set1_epi8(static_cast<char>(0xC0U));
+    const __m128i vecLeadE0 = _mm_set1_epi8(static_cast<char>(0xE0U));
+    const __m128i vecLeadED = _mm_set1_epi8(static_cast<char>(0xEDU));
+
+    // Decodes 8 code units, each one as if it was a sequence lead, with the 2 code units that follow them
+    auto decodeUtf8Lanes = [](const __m128i vecLead, const __m128i vecBytes1, const __m128i vecBytes2) -> __m128i
+    {
+        const __m128i vecNextMask = _mm_set1_epi16(0x3F);
+        __m128i vecNext1 = _mm_and_si128(vecBytes1, vecNextMask);
+        __m128i vecNext2 = _mm_and_si128(vecBytes2, vecNextMask);
+
+        __m128i vecTwoBytes = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(vecLead, _mm_set1_epi16(0x1F)), 6), vecNext1);
+        __m128i vecThreeBytes = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(vecLead, 12), _mm_slli_epi16(vecNext1, 6)), vecNext2);
+        __m128i vecCodePoints = _mm_blendv_epi8(vecThreeBytes, vecTwoBytes, _mm_cmplt_epi16(vecLead, _mm_set1_epi16(0xE0)));
+
+        return _mm_blendv_epi8(vecCodePoints, vecLead, _mm_cmplt_epi16(vecLead, _mm_set1_epi16(0x80)));
+    };
+
+    // Gets the mask of the lanes with non-characters [U+FDD0; U+FDEF], U+FFFE and U+FFFF
+    auto getNonCharacters = [](const __m128i vecCodePoints) -> __m128i
+    {
+        __m128i vecOffset = _mm_sub_epi16(vecCodePoints, _mm_set1_epi16(static_cast<short>(0xFDD0)));
+
+        return _mm_or_si128(_mm_cmpeq_epi16(_mm_min_epu16(vecOffset, _mm_set1_epi16(0x1F)), vecOffset),
+                            _mm_cmpeq_epi16(_mm_max_epu16(vecCodePoints, _mm_set1_epi16(static_cast<short>(0xFFFE))), vecCodePoints));
+    };
+
+    for(; i + 16 <= length; )
+    {
+        __m128i vecUtf8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8String + i));
+        uint64_t nonAscii = static_cast<uint32_t>(_mm_movemask_epi8(vecUtf8));
+        if(nonAscii == 0)
+        {
+            // 7-bit ASCII block
+            for(size_t j = 0; j < 16; j += 4)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(utf32String + count + j), _mm_cvtepu8_epi32(vecUtf8));
+                vecUtf8 = _mm_srli_si128(vecUtf8, 4);
+            }
+            i += 16;
+            count += 16;
+            continue;
+        }
+
+        __m128i vecMasked = _mm_and_si128(vecUtf8, vecLeadsMask);
+        uint64_t nexts = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(vecUtf8, vecNextsMask), vecNexts)));
+        uint64_t leads3 = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(vecMasked, vecLeads3)));
+        uint64_t leads4 = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(vecMasked, vecLeadsMask)));
+        uint64_t leads = 0;
+        size_t consumed = getUtf8BlockLeads(nonAscii, nexts, leads3, leads4, 16, leads);
+        if(consumed == 0)
+        {
+            // 4 bytes or invalid sequences found
+            break;
+        }
+
+        // Overlong forms (0xC0 and 0xC1 leads, 0xE0 followed by [0x80; 0x9F]) and UTF-16 surrogates (0xED followed by [0xA0; 0xBF])
+        uint64_t leadsOverlong = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(vecUtf8, vecLeadOverlongMask), vecLeadOverlong)));
+        uint64_t leadsE0 = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(vecUtf8, vecLeadE0)));
+        uint64_t leadsED = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(vecUtf8, vecLeadED)));
+        uint64_t nextsHigh = static_cast<uint32_t>(_mm_movemask_epi8(_mm_slli_epi16(vecUtf8, 2))) >> 1;
+        if(((leadsOverlong | (leadsE0 & ~nextsHigh) | (leadsED & nextsHigh)) & leads) != 0)
+        {
+            // Ill-formed sequences found
+            break;
+        }
+
+        // The block and the 2 code units that follow each one
+        __m128i vecBytes1 = _mm_srli_si128(vecUtf8, 1);
+        __m128i vecBytes2 = _mm_srli_si128(vecUtf8, 2);
+        __m128i vecCodePointsLow = decodeUtf8Lanes(_mm_unpacklo_epi8(vecUtf8, vecZero), _mm_unpacklo_epi8(vecBytes1, vecZero),
+                                                   _mm_unpacklo_epi8(vecBytes2, vecZero));
+        __m128i vecCodePointsHigh = decodeUtf8Lanes(_mm_unpackhi_epi8(vecUtf8, vecZero), _mm_unpackhi_epi8(vecBytes1, vecZero),
+                                                    _mm_unpackhi_epi8(vecBytes2, vecZero));
+
+        uint64_t leadsNonCharacter = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(vecUtf8, vecLeadNonCharacter))) & leads;
+        if(leadsNonCharacter != 0)
+        {
+            __m128i vecBad = _mm_packs_epi16(getNonCharacters(vecCodePointsLow), getNonCharacters(vecCodePointsHigh));
+            if((static_cast<uint32_t>(_mm_movemask_epi8(vecBad)) & leadsNonCharacter) != 0)
+            {
+                // Unicode non-characters found
+                break;
+            }
+        }
+
+        unsigned int maskLow = static_cast<unsigned int>(leads & 0xFF);
+        unsigned int maskHigh = static_cast<unsigned int>((leads >> 8) & 0xFF);
+        __m128i vecPacked = _mm_shuffle_epi8(vecCodePointsLow, _mm_loadu_si128(reinterpret_cast<const __m128i*>(objTables.m_arrShuffles[maskLow])));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(utf32String + count), _mm_cvtepu16_epi32(vecPacked));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(utf32String + count + 4), _mm_cvtepu16_epi32(_mm_srli_si128(vecPacked, 8)));
+        count += objTables.m_arrCounts[maskLow];
+        vecPacked = _mm_shuffle_epi8(vecCodePointsHigh, _mm_loadu_si128(reinterpret_cast<const __m128i*>(objTables.m_arrShuffles[maskHigh])));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(utf32String + count), _mm_cvtepu16_epi32(vecPacked));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(utf32String + count + 4), _mm_cvtepu16_epi32(_mm_srli_si128(vecPacked, 8)));
+        count += objTables.m_arrCounts[maskHigh];
+        i += consumed;
+    }
+#endif
+
+    utf32Length = count;
+
+    return i;
+#else
+    // Zero-extend the 7-bit ASCII blocks only
+    utf32Length = convertAsciiBlocks_to_Utf32(utf8String, length, utf32String);
+
+    return utf32Length;
+#endif
+}
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE4_1)
+/**
+ * Lookup tables to pack the UTF-8 sequences of 4 code points, encoded one per 32-bit lane, by the
+ * sequences lengths: bit 'n' of the key is set if the lane 'n' has a 2 or 4 bytes sequence, and
+ * bit 'n + 4' if it has a 3 or 4 bytes sequence.
+ */
+struct CodePage2Unicode::Utf8PackTables
+{
+    unsigned char m_arrShuffles[256][16];
+    unsigned char m_arrLengths[256];
+
+    Utf8PackTables()
+    {
+        for(unsigned int key = 0; key < 256; ++key)
+        {
+            unsigned int count = 0;
+            for(unsigned int lane = 0; lane < 4; ++lane)
+            {
+                unsigned int sequenceBytes = 1 + ((key >> lane) & 1) + 2 * ((key >> (lane + 4)) & 1);
+                for(unsigned int j = 0; j < sequenceBytes; ++j)
+                {
+                    m_arrShuffles[key][count++] = static_cast<unsigned char>(4 * lane + j);
+                }
+            }
+            m_arrLengths[key] = static_cast<unsigned char>(count);
+            for(; count < 16; ++count)
+            {
+                // Zero the unused bytes
+                m_arrShuffles[key][count] = 0x80U;
+            }
+        }
+    }
+};
+
+/**
+ * Gets the UTF-8 packing lookup tables, built on the first call.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @return	the UTF-8 packing lookup tables
+ * @since	1.0
+ */
+const CodePage2Unicode::Utf8PackTables& CodePage2Unicode::getUtf8PackTables()
+{
+    static const Utf8PackTables objTables;
+
+    return objTables;
+}
+#endif
+
+/**
+ * Gets the number of UTF-8 code units needed to encode an UTF-32 string, counting the invalid
+ * code points as the replacement character, using SIMD instructions when available. The blocks with
+ * code points above U+10FFFF are counted by the scalar code.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String		the UTF-32 code points
+ * @param	length			the number of UTF-32 code points
+ * @return	the number of UTF-8 code units
+ * @since	1.0
+ */
+size_t CodePage2Unicode::getUtf8Length(const char32_t* utf32String, const size_t length)
+{
+    // Gets the number of UTF-8 code units of a code point, as encoded by the scalar encoder
+    auto getSequenceBytes = [](const char32_t codePoint) -> size_t
+    {
+        if(codePoint < 0x80UL)
+        {
+            return 1;
+        }
+        else if(codePoint < 0x800UL)
+        {
+            return 2;
+        }
+        else if(!isUnicodeInterchangeCharacter(codePoint))
+        {
+            // Replacement character
+            return 3;
+        }
+
+        // The surrogates are also replaced by a 3 bytes sequence
+        return (codePoint < 0x10000UL) ? 3 : 4;
+    };
+
+    size_t i = 0;
+    size_t utf8Length = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    const __m256i vecTwoBytes = _mm256_set1_epi32(0x80);
+    const __m256i vecThreeBytes = _mm256_set1_epi32(0x800);
+    const __m256i vecFourBytes = _mm256_set1_epi32(0x10000);
+    const __m256i vecTooLarge = _mm256_set1_epi32(0x110000);
+    const __m256i vecNonCharacterMask = _mm256_set1_epi32(0xFFFE);
+    while(i + 8 <= length)
+    {
+        // Per lane counters of the extra code units, flushed before they can overflow
+        __m256i vecExtra = _mm256_setzero_si256();
+        size_t blockEnd = min(length, i + 8 * 0x1000000);
+        for(; i + 8 <= blockEnd; i += 8)
+        {
+            __m256i vecUtf32 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(utf32String + i));
+            if(!_mm256_testz_si256(_mm256_cmpeq_epi32(_mm256_max_epu32(vecUtf32, vecTooLarge), vecUtf32), _mm256_set1_epi32(-1)))
+            {
+                // Code points above U+10FFFF
+                for(size_t j = 0; j < 8; ++j)
+                {
+                    utf8Length += getSequenceBytes(utf32String[i + j]) - 1;
+                }
+                continue;
+            }
+
+            // Supplementary planes non-characters are replaced by a 3 bytes sequence
+            __m256i vecFour = _mm256_cmpeq_epi32(_mm256_max_epu32(vecUtf32, vecFourBytes), vecUtf32);
+            vecFour = _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_and_si256(vecUtf32, vecNonCharacterMask), vecNonCharacterMask), vecFour);
+            vecExtra = _mm256_sub_epi32(vecExtra, _mm256_cmpeq_epi32(_mm256_max_epu32(vecUtf32, vecTwoBytes), vecUtf32));
+            vecExtra = _mm256_sub_epi32(vecExtra, _mm256_cmpeq_epi32(_mm256_max_epu32(vecUtf32, vecThreeBytes), vecUtf32));
+            vecExtra = _mm256_sub_epi32(vecExtra, vecFour);
+        }
+
+        __m128i vecSum = _mm_add_epi32(_mm256_castsi256_si128(vecExtra), _mm256_extracti128_si256(vecExtra, 1));
+        vecSum = _mm_add_epi32(vecSum, _mm_shuffle_epi32(vecSum, 0x4E));
+        vecSum = _mm_add_epi32(vecSum, _mm_shuffle_epi32(vecSum, 0xB1));
+        utf8Length += static_cast<uint32_t>(_mm_cvtsi128_si32(vecSum));
+    }
+    utf8Length += i;
+#elif (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE4_1)
+    const __m128i vecTwoBytes = _mm_set1_epi32(0x80);
+    const __m128i vecThreeBytes = _mm_set1_epi32(0x800);
+    const __m128i vecFourBytes = _mm_set1_epi32(0x10000);
+    const __m128i vecTooLarge = _mm_set1_epi32(0x110000);
+    const __m128i vecNonCharacterMask = _mm_set1_epi32(0xFFFE);
+    while(i + 4 <= length)
+    {
+        // Per lane counters of the extra code units, flushed before they can overflow
+        __m128i vecExtra = _mm_setzero_si128();
+        size_t blockEnd = min(length, i + 4 * 0x1000000);
+        for(; i + 4 <= blockEnd; i += 4)
+        {
+            __m128i vecUtf32 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf32String + i));
+            if(!_mm_testz_si128(_mm_cmpeq_epi32(_mm_max_epu32(vecUtf32, vecTooLarge), vecUtf32), _mm_set1_epi32(-1)))
+            {
+                // Code points above U+10FFFF
+                for(size_t j = 0; j < 4; ++j)
+                {
+                    utf8Length += getSequenceBytes(utf32String[i + j]) - 1;
+                }
+                continue;
+            }
+
+            // Supplementary planes non-characters are replaced by a 3 bytes sequence
+            __m128i vecFour = _mm_cmpeq_epi32(_mm_max_epu32(vecUtf32, vecFourBytes), vecUtf32);
+            vecFour = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(vecUtf32, vecNonCharacterMask), vecNonCharacterMask), vecFour);
+            vecExtra = _mm_sub_epi32(vecExtra, _mm_cmpeq_epi32(_mm_max_epu32(vecUtf32, vecTwoBytes), vecUtf32));
+            vecExtra = _mm_sub_epi32(vecExtra, _mm_cmpeq_epi32(_mm_max_epu32(vecUtf32, vecThreeBytes), vecUtf32));
+            vecExtra = _mm_sub_epi32(vecExtra, vecFour);
+        }
+
+        __m128i vecSum = _mm_add_epi32(vecExtra, _mm_shuffle_epi32(vecExtra, 0x4E));
+        vecSum = _mm_add_epi32(vecSum, _mm_shuffle_epi32(vecSum, 0xB1));
+        utf8Length += static_cast<uint32_t>(_mm_cvtsi128_si32(vecSum));
+    }
+    utf8Length += i;
+#endif
+
+    for(; i < length; ++i)
+    {
+        utf8Length += getSequenceBytes(utf32String[i]);
+    }
+
+    return utf8Length;
+}
+
+/**
+ * Encodes the leading blocks of valid code points of an UTF-32 string to UTF-8, using SIMD
+ * instructions when available, and stops at the first block with invalid code points or when
+ * the room left for the UTF-8 code units is too small for a block.
+ * Each code point is encoded in a 32-bit lane and the sequences are packed with byte shuffles,
+ * keyed by the sequences lengths. The results are the same of the scalar encoder.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String		the UTF-32 code points to be converted
+ * @param	length			the number of UTF-32 code points
+ * @param	utf8String		receives the UTF-8 code units
+ * @param	utf8Room		the room for UTF-8 code units
+ * @param	utf8Length		receives the number of UTF-8 code units
+ * @return	the number of UTF-32 code points converted
+ * @since	1.0
+ */
+size_t CodePage2Unicode::convertUtf32Blocks_to_Utf8(const char32_t* utf32String, const size_t length, char* utf8String, const size_t utf8Room, size_t& utf8Length)
+{
+    size_t i = 0;
+    size_t count = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    const Utf8PackTables& objTables = getUtf8PackTables();
+    const __m256i vecNonAscii = _mm256_set1_epi32(~0x7F);
+
+    // Encodes 8 code points, one UTF-8 sequence per lane, and gets the lanes with invalid code points
+    // and the packing keys of each 4 lanes
+    auto encodeUtf8Lanes = [](const __m256i vecUtf32, int& invalidMask, unsigned int& keyLow, unsigned int& keyHigh) -> __m256i
+    {
+        const __m256i vecNextMask = _mm256_set1_epi32(0x3F);
+        const __m256i vecNext = _mm256_set1_epi32(0x80);
+        __m256i vecTwo = _mm256_cmpeq_epi32(_mm256_max_epu32(vecUtf32, _mm256_set1_epi32(0x80)), vecUtf32);
+        __m256i vecThree = _mm256_cmpeq_epi32(_mm256_max_epu32(vecUtf32, _mm256_set1_epi32(0x800)), vecUtf32);
+        __m256i vecFour = _mm256_cmpeq_epi32(_mm256_max_epu32(vecUtf32, _mm256_set1_epi32(0x10000)), vecUtf32);
+
+        // Above U+10FFFF, surrogates [U+D800; U+DFFF], non-characters U+xFFFE, U+xFFFF and [U+FDD0; U+FDEF]
+        __m256i vecOffset = _mm256_sub_epi32(vecUtf32, _mm256_set1_epi32(0xFDD0));
+        __m256i vecInvalid = _mm256_or_si256(_mm256_cmpeq_epi32(_mm256_max_epu32(vecUtf32, _mm256_set1_epi32(0x110000)), vecUtf32),
+                                             _mm256_cmpeq_epi32(_mm256_min_epu32(vecOffset, _mm256_set1_epi32(0x1F)), vecOffset));
+        vecInvalid = _mm256_or_si256(vecInvalid, _mm256_cmpeq_epi32(_mm256_and_si256(vecUtf32, _mm256_set1_epi32(0xFFFE)), _mm256_set1_epi32(0xFFFE)));
+        vecInvalid = _mm256_or_si256(vecInvalid, _mm256_cmpeq_epi32(_mm256_and_si256(vecUtf32, _mm256_set1_epi32(static_cast<int>(0xFFFFF800U))), _mm256_set1_epi32(0xD800)));
+        invalidMask = _mm256_movemask_ps(_mm256_castsi256_ps(vecInvalid));
+
+        int twoMask = _mm256_movemask_ps(_mm256_castsi256_ps(vecTwo));
+        int threeMask = _mm256_movemask_ps(_mm256_castsi256_ps(vecThree));
+        int fourMask = _mm256_movemask_ps(_mm256_castsi256_ps(vecFour));
+        int evenMask = twoMask ^ threeMask ^ fourMask;
+        keyLow = static_cast<unsigned int>((evenMask & 0x0F) | ((threeMask & 0x0F) << 4));
+        keyHigh = static_cast<unsigned int>(((evenMask >> 4) & 0x0F) | (threeMask & 0xF0));
+
+        __m256i vecNext0 = _mm256_or_si256(_mm256_and_si256(vecUtf32, vecNextMask), vecNext);
+        __m256i vecNext1 = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(vecUtf32, 6), vecNextMask), vecNext);
+        __m256i vecNext2 = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(vecUtf32, 12), vecNextMask), vecNext);
+        __m256i vecTwoBytes = _mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(vecUtf32, 6), _mm256_set1_epi32(0xC0)), _mm256_slli_epi32(vecNext0, 8));
+        __m256i vecThreeBytes = _mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(vecUtf32, 12), _mm256_set1_epi32(0xE0)),
+                                                _mm256_or_si256(_mm256_slli_epi32(vecNext1, 8), _mm256_slli_epi32(vecNext0, 16)));
+        __m256i vecFourBytes = _mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(vecUtf32, 18), _mm256_set1_epi32(0xF0)),
+                                               _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vecNext2, 8), _mm256_slli_epi32(vecNext1, 16)),
+                                                               _mm256_slli_epi32(vecNext0, 24)));
+        __m256i vecUtf8 = _mm256_blendv_epi8(vecUtf32, vecTwoBytes, vecTwo);
+        vecUtf8 = _mm256_blendv_epi8(vecUtf8, vecThreeBytes, vecThree);
+
+        return _mm256_blendv_epi8(vecUtf8, vecFourBytes, vecFour);
+    };
+
+    // 16 code points blocks, each one gives at most 4 UTF-8 code units
+    for(; (i + 16 <= length) && (count + 64 <= utf8Room); )
+    {
+        __m256i vecLow = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(utf32String + i));
+        __m256i vecHigh = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(utf32String + i + 8));
+        if(_mm256_testz_si256(_mm256_or_si256(vecLow, vecHigh), vecNonAscii))
+        {
+            // 7-bit ASCII block
+            __m256i vecWords = _mm256_permute4x64_epi64(_mm256_packus_epi32(vecLow, vecHigh), 0xD8);
+            __m128i vecBytes = _mm_packus_epi16(_mm256_castsi256_si128(vecWords), _mm256_extracti128_si256(vecWords, 1));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(utf8String + count), vecBytes);
+            i += 16;
+            count += 16;
+            continue;
+        }
+
+        int invalidLow = 0;
+        int invalidHigh = 0;
+        unsigned int arrKeys[4];
+        __m256i arrUtf8[2];
+        arrUtf8[0] = encodeUtf8Lanes(vecLow, invalidLow, arrKeys[0], arrKeys[1]);
+        arrUtf8[1] = encodeUtf8Lanes(vecHigh, invalidHigh, arrKeys[2], arrKeys[3]);
+        if((invalidLow | invalidHigh) != 0)
+        {
+            // Invalid code points found
+            break;
+        }
+
+        for(size_t j = 0; j < 2; ++j)
+        {
+            // Pack the sequences of each 4 lanes, in place
+            __m256i vecShuffle = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(objTables.m_arrShuffles[arrKeys[2 * j]]))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(objTables.m_arrShuffles[arrKeys[2 * j + 1]])), 1);
+            __m256i vecPacked = _mm256_shuffle_epi8(arrUtf8[j], vecShuffle);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(utf8String + count), _mm256_castsi256_si128(vecPacked));
+            count += objTables.m_arrLengths[arrKeys[2 * j]];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(utf8String + count), _mm256_extracti128_si256(vecPacked, 1));
+            count += objTables.m_arrLengths[arrKeys[2 * j + 1]];
+        }
+        i += 16;
+    }
+#elif (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE4_1)
+    const Utf8PackTables& objTables = getUtf8PackTables();
+    const __m128i vecNonAscii = _mm_set1_epi32(~0x7F);
+
+    // Encodes 4 code points, one UTF-8 sequence per lane, and gets the lanes with invalid code points
+    // and the packing key
+    auto encodeUtf8Lanes = [](const __m128i vecUtf32, int& invalidMask, unsigned int& key) -> __m128i
+    {
+        const __m128i vecNextMask = _mm_set1_epi32(0x3F);
+        const __m128i vecNext = _mm_set1_epi32(0x80);
+        __m128i vecTwo = _mm_cmpeq_epi32(_mm_max_epu32(vecUtf32, _mm_set1_epi32(0x80)), vecUtf32);
+        __m128i vecThree = _mm_cmpeq_epi32(_mm_max_epu32(vecUtf32, _mm_set1_epi32(0x800)), vecUtf32);
+        __m128i vecFour = _mm_cmpeq_epi32(_mm_max_epu32(vecUtf32, _mm_set1_epi32(0x10000)), vecUtf32);
+
+        // Above U+10FFFF, surrogates [U+D800; U+DFFF], non-characters U+xFFFE, U+xFFFF and [U+FDD0; U+FDEF]
+        __m128i vecOffset = _mm_sub_epi32(vecUtf32, _mm_set1_epi32(0xFDD0));
+        __m128i vecInvalid = _mm_or_si128(_mm_cmpeq_epi32(_mm_max_epu32(vecUtf32, _mm_set1_epi32(0x110000)), vecUtf32),
+                                          _mm_cmpeq_epi32(_mm_min_epu32(vecOffset, _mm_set1_epi32(0x1F)), vecOffset));
+        vecInvalid = _mm_or_si128(vecInvalid, _mm_cmpeq_epi32(_mm_and_si128(vecUtf32, _mm_set1_epi32(0xFFFE)), _mm_set1_epi32(0xFFFE)));
+        vecInvalid = _mm_or_si128(vecInvalid, _mm_cmpeq_epi32(_mm_and_si128(vecUtf32, _mm_set1_epi32(static_cast<int>(0xFFFFF800U))), _mm_set1_epi32(0xD800)));
+        invalidMask = _mm_movemask_ps(_mm_castsi128_ps(vecInvalid));
+
+        int twoMask = _mm_movemask_ps(_mm_castsi128_ps(vecTwo));
+        int threeMask = _mm_movemask_ps(_mm_castsi128_ps(vecThree));
+        int fourMask = _mm_movemask_ps(_mm_castsi128_ps(vecFour));
+        key = static_cast<unsigned int>((twoMask ^ threeMask ^ fourMask) | (threeMask << 4));
+
+        __m128i vecNext0 = _mm_or_si128(_mm_and_si128(vecUtf32, vecNextMask), vecNext);
+        __m128i vecNext1 = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(vecUtf32, 6), vecNextMask), vecNext);
+        __m128i vecNext2 = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(vecUtf32, 12), vecNextMask), vecNext);
+        __m128i vecTwoBytes = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(vecUtf32, 6), _mm_set1_epi32(0xC0)), _mm_slli_epi32(vecNext0, 8));
+        __m128i vecThreeBytes = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(vecUtf32, 12), _mm_set1_epi32(0xE0)),
+                                             _mm_or_si128(_mm_slli_epi32(vecNext1, 8), _mm_slli_epi32(vecNext0, 16)));
+        __m128i vecFourBytes = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(vecUtf32, 18), _mm_set1_epi32(0xF0)),
+                                            _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vecNext2, 8), _mm_slli_epi32(vecNext1, 16)),
+                                                         _mm_slli_epi32(vecNext0, 24)));
+        __m128i vecUtf8 = _mm_blendv_epi8(vecUtf32, vecTwoBytes, vecTwo);
+        vecUtf8 = _mm_blendv_epi8(vecUtf8, vecThreeBytes, vecThree);
+
+        return _mm_blendv_epi8(vecUtf8, vecFourBytes, vecFour);
+    };
+
+    // 8 code points blocks, each one gives at most 4 UTF-8 code units
+    for(; (i + 8 <= length) && (count + 32 <= utf8Room); )
+    {
+        __m128i vecLow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf32String + i));
+        __m128i vecHigh = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf32String + i + 4));
+        if(_mm_testz_si128(_mm_or_si128(vecLow, vecHigh), vecNonAscii))
+        {
+            // 7-bit ASCII block
+            __m128i vecWords = _mm_packus_epi32(vecLow, vecHigh);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(utf8String + count), _mm_packus_epi16(vecWords, vecWords));
+            i += 8;
+            count += 8;
+            continue;
+        }
+
+        int invalidLow = 0;
+        int invalidHigh = 0;
+        unsigned int arrKeys[2];
+        __m128i arrUtf8[2];
+        arrUtf8[0] = encodeUtf8Lanes(vecLow, invalidLow, arrKeys[0]);
+        arrUtf8[1] = encodeUtf8Lanes(vecHigh, invalidHigh, arrKeys[1]);
+        if((invalidLow | invalidHigh) != 0)
+        {
+            // Invalid code points found
+            break;
+        }
+
+        for(size_t j = 0; j < 2; ++j)
+        {
+            __m128i vecShuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(objTables.m_arrShuffles[arrKeys[j]]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(utf8String + count), _mm_shuffle_epi8(arrUtf8[j], vecShuffle));
+            count += objTables.m_arrLengths[arrKeys[j]];
+        }
+        i += 8;
+    }
+#else
+    // No blocks are encoded without SSE4.1, the scalar encoder converts the whole string
+    (void)utf32String;
+    (void)length;
+    (void)utf8String;
+    (void)utf8Room;
+#endif
+
+    utf8Length = count;
+
+    return i;
+}
+
+/**
+ * Widens the leading UTF-16 code units of BMP characters, other than surrogates and non-characters,
+ * straight to UTF-32, using SIMD instructions when available, and stops at the first surrogate or
+ * non-character, left to the scalar decoder.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String		the UTF-16 code units to be converted
+ * @param	length			the number of UTF-16 code units
+ * @param	utf32String		receives the UTF-32 code points, must have room for 'length' code points
+ * @return	the number of UTF-16 code units converted
+ * @since	1.0
+ */
+size_t CodePage2Unicode::convertUtf16Blocks_to_Utf32(const char16_t* utf16String, const size_t length, char32_t* utf32String)
+{
+    size_t i = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    const __m256i vecSurrogateMask = _mm256_set1_epi16(static_cast<short>(0xF800));
+    const __m256i vecSurrogate = _mm256_set1_epi16(static_cast<short>(0xD800));
+    const __m256i vecNonCharacterStart = _mm256_set1_epi16(static_cast<short>(0xFDD0));
+    const __m256i vecNonCharacterRange = _mm256_set1_epi16(0x1F);
+    const __m256i vecNonCharacterLast = _mm256_set1_epi16(static_cast<short>(0xFFFE));
+    for(; i + 16 <= length; i += 16)
+    {
+        __m256i vecUtf16 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(utf16String + i));
+        __m256i vecOffset = _mm256_sub_epi16(vecUtf16, vecNonCharacterStart);
+        __m256i vecInvalid = _mm256_or_si256(_mm256_cmpeq_epi16(_mm256_and_si256(vecUtf16, vecSurrogateMask), vecSurrogate),
+                                             _mm256_cmpeq_epi16(_mm256_min_epu16(vecOffset, vecNonCharacterRange), vecOffset));
+        vecInvalid = _mm256_or_si256(vecInvalid, _mm256_cmpeq_epi16(_mm256_max_epu16(vecUtf16, vecNonCharacterLast), vecUtf16));
+
+        __m256i* pUtf32 = reinterpret_cast<__m256i*>(utf32String + i);
+        _mm256_storeu_si256(pUtf32, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(vecUtf16)));
+        _mm256_storeu_si256(pUtf32 + 1, _mm256_cvtepu16_epi32(_mm256_extracti128_si256(vecUtf16, 1)));
+        if(!_mm256_testz_si256(vecInvalid, vecInvalid))
+        {
+            // Surrogate or non-character found, the valid code units before it are widened one at a time
+            break;
+        }
+    }
+#elif (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE2)
+    // Unsigned 16-bit comparisons, as signed ones with the sign bit flipped
+    const __m128i vecZero = _mm_setzero_si128();
+    const __m128i vecSignBit = _mm_set1_epi16(static_cast<short>(0x8000));
+    const __m128i vecSurrogateMask = _mm_set1_epi16(static_cast<short>(0xF800));
+    const __m128i vecSurrogate = _mm_set1_epi16(static_cast<short>(0xD800));
+    const __m128i vecNonCharacterStart = _mm_set1_epi16(static_cast<short>(0xFDD0));
+    const __m128i vecNonCharacterEnd = _mm_set1_epi16(static_cast<short>(0x8000 + 0x20));
+    const __m128i vecNonCharacterLast = _mm_set1_epi16(static_cast<short>(0xFFFD ^ 0x8000));
+    for(; i + 8 <= length; i += 8)
+    {
+        __m128i vecUtf16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf16String + i));
+        __m128i vecOffset = _mm_xor_si128(_mm_sub_epi16(vecUtf16, vecNonCharacterStart), vecSignBit);
+        __m128i vecInvalid = _mm_or_si128(_mm_cmpeq_epi16(_mm_and_si128(vecUtf16, vecSurrogateMask), vecSurrogate),
+                                          _mm_cmplt_epi16(vecOffset, vecNonCharacterEnd));
+        vecInvalid = _mm_or_si128(vecInvalid, _mm_cmpgt_epi16(_mm_xor_si128(vecUtf16, vecSignBit), vecNonCharacterLast));
+
+        __m128i* pUtf32 = reinterpret_cast<__m128i*>(utf32String + i);
+        _mm_storeu_si128(pUtf32, _mm_unpacklo_epi16(vecUtf16, vecZero));
+        _mm_storeu_si128(pUtf32 + 1, _mm_unpackhi_epi16(vecUtf16, vecZero));
+        if(_mm_movemask_epi8(vecInvalid) != 0)
+        {
+            // Surrogate or non-character found, the valid code units before it are widened one at a time
+            break;
+        }
+    }
+#endif
+
+    for(; i < length; ++i)
+    {
+        char16_t charUtf16 = utf16String[i];
+        if(isUtf16Surrogate(charUtf16) || isUnicodeNonCharacter(static_cast<char32_t>(charUtf16)))
+        {
+            break;
+        }
+        utf32String[i] = static_cast<char32_t>(charUtf16);
+    }
+
+    return i;
+}
+
+/**
+ * Narrows the leading UTF-32 code points of BMP characters, other than surrogates and non-characters,
+ * straight to UTF-16, using SIMD instructions when available, and stops at the first code point that
+ * needs a surrogate pair or is invalid, left to the scalar encoder.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String		the UTF-32 code points to be converted
+ * @param	length			the number of UTF-32 code points
+ * @param	utf16String		receives the UTF-16 code units, must have room for 'length' code units
+ * @return	the number of UTF-32 code points converted
+ * @since	1.0
+ */
+size_t CodePage2Unicode::convertUtf32Blocks_to_Utf16(const char32_t* utf32String, const size_t length, char16_t* utf16String)
+{
+    size_t i = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    const __m256i vecNonBmp = _mm256_set1_epi32(0x10000);
+    const __m256i vecSurrogateMask = _mm256_set1_epi32(static_cast<int>(0xFFFFF800U));
+    const __m256i vecSurrogate = _mm256_set1_epi32(0xD800);
+    const __m256i vecNonCharacterStart = _mm256_set1_epi32(0xFDD0);
+    const __m256i vecNonCharacterRange = _mm256_set1_epi32(0x1F);
+    const __m256i vecNonCharacterLast = _mm256_set1_epi32(0xFFFE);
+
+    // Gets the lanes with code points above the BMP, surrogates or non-characters
+    auto getInvalidLanes = [&](const __m256i vecUtf32) -> __m256i
+    {
+        __m256i vecOffset = _mm256_sub_epi32(vecUtf32, vecNonCharacterStart);
+        __m256i vecInvalid = _mm256_or_si256(_mm256_cmpeq_epi32(_mm256_max_epu32(vecUtf32, vecNonBmp), vecUtf32),
+                                             _mm256_cmpeq_epi32(_mm256_and_si256(vecUtf32, vecSurrogateMask), vecSurrogate));
+        vecInvalid = _mm256_or_si256(vecInvalid, _mm256_cmpeq_epi32(_mm256_min_epu32(vecOffset, vecNonCharacterRange), vecOffset));
+
+        return _mm256_or_si256(vecInvalid, _mm256_cmpeq_epi32(_mm256_and_si256(vecUtf32, vecNonCharacterLast), vecNonCharacterLast));
+    };
+
+    for(; i + 16 <= length; i += 16)
+    {
+        __m256i vecLow = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(utf32String + i));
+        __m256i vecHigh = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(utf32String + i + 8));
+        __m256i vecInvalid = _mm256_or_si256(getInvalidLanes(vecLow), getInvalidLanes(vecHigh));
+        if(!_mm256_testz_si256(vecInvalid, vecInvalid))
+        {
+            // Surrogate pair needed or invalid code point found, the valid code points before it are narrowed one at a time
+            break;
+        }
+
+        __m256i vecUtf16 = _mm256_permute4x64_epi64(_mm256_packus_epi32(vecLow, vecHigh), 0xD8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(utf16String + i), vecUtf16);
+    }
+#elif (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE2)
+    const __m128i vecZero = _mm_setzero_si128();
+    const __m128i vecNonBmpMask = _mm_set1_epi32(static_cast<int>(0xFFFF0000U));
+    const __m128i vecSurrogateMask = _mm_set1_epi32(static_cast<int>(0xFFFFF800U));
+    const __m128i vecSurrogate = _mm_set1_epi32(0xD800);
+    const __m128i vecNonCharacterStart = _mm_set1_epi32(0xFDD0);
+    const __m128i vecNonCharacterRange = _mm_set1_epi32(0x20);
+    const __m128i vecNonCharacterLast = _mm_set1_epi32(0xFFFE);
+    const __m128i vecSignBit = _mm_set1_epi32(0x8000);
+
+    // Gets the lanes with code points above the BMP, surrogates or non-characters
+    auto getInvalidLanes = [&](const __m128i vecUtf32) -> __m128i
+    {
+        // Signed comparisons are enough for the BMP code points
+        __m128i vecOffset = _mm_sub_epi32(vecUtf32, vecNonCharacterStart);
+        __m128i vecInvalid = _mm_or_si128(_mm_xor_si128(_mm_cmpeq_epi32(_mm_and_si128(vecUtf32, vecNonBmpMask), vecZero), _mm_set1_epi32(-1)),
+                                          _mm_cmpeq_epi32(_mm_and_si128(vecUtf32, vecSurrogateMask), vecSurrogate));
+        vecInvalid = _mm_or_si128(vecInvalid, _mm_andnot_si128(_mm_cmplt_epi32(vecOffset, vecZero), _mm_cmplt_epi32(vecOffset, vecNonCharacterRange)));
+
+        return _mm_or_si128(vecInvalid, _mm_cmpeq_epi32(_mm_and_si128(vecUtf32, vecNonCharacterLast), vecNonCharacterLast));
+    };
+
+    for(; i + 8 <= length; i += 8)
+    {
+        __m128i vecLow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf32String + i));
+        __m128i vecHigh = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf32String + i + 4));
+        if(_mm_movemask_epi8(_mm_or_si128(getInvalidLanes(vecLow), getInvalidLanes(vecHigh))) != 0)
+        {
+            // Surrogate pair needed or invalid code point found, the valid code points before it are narrowed one at a time
+            break;
+        }
+
+        // Unsigned saturation of BMP code points, as signed one with the values biased by 0x8000
+        __m128i vecUtf16 = _mm_packs_epi32(_mm_sub_epi32(vecLow, vecSignBit), _mm_sub_epi32(vecHigh, vecSignBit));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(utf16String + i), _mm_xor_si128(vecUtf16, _mm_set1_epi16(static_cast<short>(0x8000))));
+    }
+#endif
+
+    for(; i < length; ++i)
+    {
+        char32_t codePoint = utf32String[i];
+        if((codePoint > UNICODE_MAXIMUM_BMP) || isUtf16Surrogate(static_cast<char16_t>(codePoint)) || isUnicodeNonCharacter(codePoint))
+        {
+            break;
+        }
+        utf16String[i] = static_cast<char16_t>(codePoint);
+    }
+
+    return i;
+}
+
+/**
+ * Swaps the byte order of 16-bit code units, using SIMD instructions when available.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	source			the code units to be swapped
+ * @param	length			the number of code units
+ * @param	destination		receives the swapped code units, can be the source itself
+ * @since	1.0
+ */
+void CodePage2Unicode::swapByteOrder16(const char* source, const size_t length, char* destination)
+{
+    size_t i = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    const __m256i vecShuffle = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                                1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    for(; i + 16 <= length; i += 16)
+    {
+        __m256i vecUnits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + 2 * i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + 2 * i), _mm256_shuffle_epi8(vecUnits, vecShuffle));
+    }
+#elif (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSSE3)
+    const __m128i vecShuffle = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    for(; i + 8 <= length; i += 8)
+    {
+        __m128i vecUnits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 2 * i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 2 * i), _mm_shuffle_epi8(vecUnits, vecShuffle));
+    }
+#elif (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE2)
+    for(; i + 8 <= length; i += 8)
+    {
+        __m128i vecUnits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 2 * i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 2 * i),
+                         _mm_or_si128(_mm_slli_epi16(vecUnits, 8), _mm_srli_epi16(vecUnits, 8)));
+    }
+#endif
+
+    for(; i < length; ++i)
+    {
+        char byte0 = source[2 * i];
+        destination[2 * i] = source[2 * i + 1];
+        destination[2 * i + 1] = byte0;
+    }
+}
+
+/**
+ * Swaps the byte order of 32-bit code units, using SIMD instructions when available.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	source			the code units to be swapped
+ * @param	length			the number of code units
+ * @param	destination		receives the swapped code units, can be the source itself
+ * @since	1.0
+ */
+void CodePage2Unicode::swapByteOrder32(const char* source, const size_t length, char* destination)
+{
+    size_t i = 0;
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    const __m256i vecShuffle = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                                3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    for(; i + 8 <= length; i += 8)
+    {
+        __m256i vecUnits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + 4 * i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + 4 * i), _mm256_shuffle_epi8(vecUnits, vecShuffle));
+    }
+#elif (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSSE3)
+    const __m128i vecShuffle = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    for(; i + 4 <= length; i += 4)
+    {
+        __m128i vecUnits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 4 * i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 4 * i), _mm_shuffle_epi8(vecUnits, vecShuffle));
+    }
+#elif (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE2)
+    for(; i + 4 <= length; i += 4)
+    {
+        // Swap the 16-bit halves, then the bytes of each half
+        __m128i vecUnits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 4 * i));
+        vecUnits = _mm_shufflehi_epi16(_mm_shufflelo_epi16(vecUnits, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 4 * i),
+                         _mm_or_si128(_mm_slli_epi16(vecUnits, 8), _mm_srli_epi16(vecUnits, 8)));
+    }
+#endif
+
+    for(; i < length; ++i)
+    {
+        char byte0 = source[4 * i];
+        char byte1 = source[4 * i + 1];
+        destination[4 * i] = source[4 * i + 3];
+        destination[4 * i + 1] = source[4 * i + 2];
+        destination[4 * i + 2] = byte1;
+        destination[4 * i + 3] = byte0;
+    }
+}
+
+/**
+ * Copies whole code units between a byte buffer and a code units buffer, swapping their byte order
+ * if asked.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	source				the code units to be copied
+ * @param	sourceBytes			the number of bytes of the code units to be copied
+ * @param	destination			receives the code units
+ * @param	destinationBytes	the room in bytes for code units
+ * @param	unitSize			the code unit size in bytes, 2 or 4
+ * @param	swapBytes			if 'true' swaps the byte order of the code units
+ * @return	the conversion status and the number of bytes consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertByteOrder(const char* source, const size_t sourceBytes, char* destination,
+                                                    const size_t destinationBytes, const size_t unitSize, const bool swapBytes)
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+
+    // Only whole code units are copied
+    size_t length = sourceBytes / unitSize;
+    if(length > destinationBytes / unitSize)
+    {
+        length = destinationBytes / unitSize;
+        objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+    }
+    else if(sourceBytes % unitSize != 0)
+    {
+        // The last code unit continues in the next buffer
+        objResult.status = ConversionStatus::INCOMPLETE_SEQUENCE;
+        objResult.errorOffset = length * unitSize;
+    }
+
+    if(!swapBytes)
+    {
+        memmove(destination, source, length * unitSize);
+    }
+    else if(unitSize == sizeof(char16_t))
+    {
+        swapByteOrder16(source, length, destination);
+    }
+    else
+    {
+        swapByteOrder32(source, length, destination);
+    }
+    objResult.consumed = length * unitSize;
+    objResult.written = length * unitSize;
+
+    return objResult;
+}
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+/**
+ * Decodes the leading 16 characters blocks of an 8-bit string to UTF-32 through a flattened
+ * decoding table, widening the characters to 32-bit indexes and gathering the code points
+ * from the table with AVX2.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString	the 8-bit characters to be converted
+ * @param	length			the number of 8-bit characters
+ * @param	table			the flattened 256-entry decoding table
+ * @param	utf32String		receives the UTF-32 code points, must have room for 'length' code points
+ * @return	the number of characters converted, a multiple of 16
+ * @since	1.0
+ */
+size_t CodePage2Unicode::convertTableBlocks_to_Utf32(const char* narrowString, const size_t length, const char32_t* table, char32_t* utf32String)
+{
+    const int* pTable = reinterpret_cast<const int*>(table);
+    size_t i = 0;
+
+    for(; i + 16 <= length; i += 16)
+    {
+        __m128i vecBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(narrowString + i));
+        __m256i vecIndexesLow = _mm256_cvtepu8_epi32(vecBytes);
+        __m256i vecIndexesHigh = _mm256_cvtepu8_epi32(_mm_unpackhi_epi64(vecBytes, vecBytes));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(utf32String + i), _mm256_i32gather_epi32(pTable, vecIndexesLow, 4));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(utf32String + i + 8), _mm256_i32gather_epi32(pTable, vecIndexesHigh, 4));
+    }
+
+    return i;
+}
+#endif
+
+/**
+ * Converts an 8-bit extended ASCII character from a given code page to the equivalent UTF-32 code point,
+ * walking the code page maps. Only used to build the flattened decoding tables.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowChar			the ASCII character [0; 255] to be converted
+ * @param	codePage			the code page from CodePage enumeration that the narrow character belongs to
+ * @param	convertAsciiControl	if 'true', also converts ASCII control codes [0; 31, 127] to Unicode
+ * @return	the equivalent UTF-32 code point
+ * @since	1.0
+ */
+char32_t CodePage2Unicode::decodeCharAscii(const char narrowChar, const CodePage codePage, const bool convertAsciiControl)
+{
+    char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+    // Validate parameters
+#if defined(_DEBUG)
+    assert((code >= 0) && (code <= 255));
+#endif
+
+    // EBCDIC isn't ASCII compatible, all the characters are mapped
+    switch(codePage)
+    {
+        // IBM037, cp037, 37 - Code page IBM 037, EBCDIC US/Canada (Latin-1, Western Europe, English)
+        case CodePage::EBCDIC_CP037:
+            return convertEBCDIC_CP037_To_Unicode((char)code);
+            break;
+
+        // IBM500, cp500, 500 - Code page IBM 500, EBCDIC International (Latin-1, Western Europe)
+        case CodePage::EBCDIC_CP500:
+            return convertEBCDIC_CP500_To_Unicode((char)code);
+            break;
+
+        // IBM875, cp875, 875 - Code page IBM 875, EBCDIC Greek (Greek, English)
+        case CodePage::EBCDIC_CP875:
+            return convertEBCDIC_CP875_To_Unicode((char)code);
+            break;
+
+        // IBM1047, cp1047, 1047 - Code page IBM 1047, EBCDIC Open Systems Latin-1 (Latin-1, Western Europe)
+        case CodePage::EBCDIC_CP1047:
+            return convertEBCDIC_CP1047_To_Unicode((char)code);
+            break;
+
+        default:
+            break;
+    }
+
+    // Standard ISO/ANSI ASCII
+    if(code <= 127)
+    {
+        if(convertAsciiControl)
+        {
+            if((codePage == CodePage::DOS_CP437) ||
+               (codePage == CodePage::DOS_CP737) ||
+               (codePage == CodePage::DOS_CP850) ||
+               (codePage == CodePage::DOS_CP858) ||
+               (codePage == CodePage::DOS_CP859) ||
+               (codePage == CodePage::DOS_CP860))
+            {
+                // MS-DOS extensions
+                return convertDOS_ASCII_To_Unicode((char)code);
+            }
+            else if((codePage == CodePage::MAC_ROMAN) ||
+                    (codePage == CodePage::MAC_GREEK))
+            {
+                // MacOS extensions
+                return convertMac_ASCII_To_Unicode((char)code);
+            }
+        }
+        // else
+        return convertASCII_To_Unicode((char)code);
+    }
+    // else
+    // Extended ASCII
+    switch(codePage)
+    {
+		// US_ASCII, IBM367, cp367, 367 - Code page IBM 367, MS-DOS US-ASCII
+        case CodePage::US_ASCII:
+            return convertDOS_CP367_To_Unicode((char)code);
+            break;
+
+        // IBM437, cp437, 437 - Code page IBM 437, MS-DOS Latin US (English, Western Europe)
+        case CodePage::DOS_CP437:
+            return convertDOS_CP437_To_Unicode((char)code);
+            break;
+
+        // IBM737, cp737, 737 - Code page IBM 737, MS-DOS Greek (Greek, English)
+        case CodePage::DOS_CP737:
+            return convertDOS_CP737_To_Unicode((char)code);
+            break;
+
+        // IBM850, cp850, 850 - Code page IBM 850, MS-DOS Latin-1/Multilingual (Latin-1, Western Europe)
+        case CodePage::DOS_CP850:
+            return convertDOS_CP850_To_Unicode((char)code);
+            break;
+
+        // IBM858, cp858@euro, 858 - Code page IBM 858, MS-DOS Latin-1/Multilingual with € (Latin-1, Western Europe, €)
+        case CodePage::DOS_CP858:
+            return convertDOS_CP858_To_Unicode((char)code);
+            break;
+
+        // IBM859, cp859@euro, 859 - Code page IBM 859, MS-DOS Latin-9 (Latin-9, Latin-1, Western Europe, €)
+        case CodePage::DOS_CP859:
+            return convertDOS_CP859_To_Unicode((char)code);
+            break;
+
+        // IBM860, cp860, 860 - Code page IBM 860, MS-DOS Portuguese (Portuguese, Western Europe)
+        case CodePage::DOS_CP860:
+            return convertDOS_CP860_To_Unicode((char)code);
+            break;
+
+        // macintosh@euro, mac, MacRoman, 10000 - Code page Apple Macintosh, Mac OS Latin-1/Roman (Latin-1, Western Europe, €)
+        case CodePage::MAC_ROMAN:
+            return convertMac_Roman_To_Unicode((char)code);
+            break;
+
+        // x-mac-greek, MacGreek, 10006 - Code page Apple Macintosh, Mac OS Greek (Greek, English)
+        case CodePage::MAC_GREEK:
+            return convertMac_Greek_To_Unicode((char)code);
+            break;
+
+        // windows-1252@euro, 1252 - Code page Microsoft Windows 1252, Windows Latin-1/Western Europe (Latin-1, Western Europe, €)
+        case CodePage::WINDOWS_1252:
+            return convertWindows_1252_To_Unicode((char)code);
+            break;
+
+        // windows-1253@euro, 1253 - Code page Microsoft Windows 1253, Windows Greek (Greek, English, €)
+        case CodePage::WINDOWS_1253:
+            return convertWindows_1253_To_Unicode((char)code);
+            break;
+
+        // ISO-8859-1, 28591 - Code page ISO 8859-1, ISO/IEC Latin-1 (Latin-1, Western Europe)
+        case CodePage::ISO_8859_1:
+            return convertISO_8859_1_To_Unicode((char)code);
+            break;
+
+        // ISO-8859-7@euro, 28597 - Code page ISO 8859-7, ISO/IEC Greek (Greek, English, €)
+        case CodePage::ISO_8859_7:
+            return convertISO_8859_7_To_Unicode((char)code);
+            break;
+
+        // ISO-8859-15@euro, 28605 - Code page ISO 8859-15, ISO/IEC Latin-9 (Latin-9, Latin-1, Western Europe, €)
+        case CodePage::ISO_8859_15:
+            return convertISO_8859_15_To_Unicode((char)code);
+            break;
+
+        default:
+            // Code page without a map
+            break;
+    }
+
+    return (char32_t)UNICODE_REPLACEMENT_CHARACTER;
+}
+
+/**
+ * Converts a 8-bit extended ASCII character from a given code page to the equivalent UTF-32 code point,
+ * based on it's' code page and if control codes less or equal to 127 are to be converted.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowChar			the ASCII character [0; 255] to be converted
+ * @param	codePage			the code page from CodePage enumeration that the narrow character belongs to
+ * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+ *                              also converts ASCII control codes [0; 31, 127] to Unicode
+ * @return	the equivalent UTF-32 code point
+ * @since	1.0
+ */
+char32_t CodePage2Unicode::convertCharAscii_to_CharUtf32(const char narrowChar, const CodePage codePage, const bool convertAsciiControl)
+{
+    return getCodePageTable(codePage, convertAsciiControl)[static_cast<unsigned char>(narrowChar)];
+}
+
+/**
+ * Converts a 8-bit extended ASCII encoded string from a given code page to the equivalent UTF-32 encoded string,
+ * based on it's code page and if control codes less or equal to 127 are to be converted.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString		the ASCII encoded string to be converted
+ * @param	codePage			the code page from CodePage enumeration that the ASCII string belongs to
+ * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+ *                              also converts ASCII control codes [0; 31, 127] to Unicode
+ * @return	the equivalent UTF-32 encoded string
+ * @since	1.0
+ */
+u32string CodePage2Unicode::convertStringAscii_to_StringUtf32(const string& narrowString, const CodePage codePage, const bool convertAsciiControl)
+{
+    // Resolve the code page once, so each character is a single table load
+    const CodePageTables& objTables = getCodePageTables();
+    size_t tableIndex = getCodePageTableIndex(codePage);
+    size_t variant = convertAsciiControl ? 1 : 0;
+    const char32_t* pTable = objTables.m_arrTables[tableIndex][variant];
+    bool asciiIdentity = objTables.m_arrAsciiIdentity[tableIndex][variant];
+
+    const char* pNarrow = narrowString.data();
+    size_t length = narrowString.length();
+
+    u32string strRet(length, (char32_t)0);
+    if(length > 0)
+    {
+        char32_t* pUtf32 = &strRet[0];
+        size_t i = 0;
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+        if(isCodePageGatherDecoded(codePage))
+        {
+            // Mostly extended ASCII text, gather all the blocks from the table
+            i = convertTableBlocks_to_Utf32(pNarrow, length, pTable, pUtf32);
+            asciiIdentity = false;
+        }
+#endif
+        while(i < length)
+        {
+            if(asciiIdentity)
+            {
+                // Zero-extend the 7-bit ASCII blocks
+                i += convertAsciiBlocks_to_Utf32(pNarrow + i, length - i, pUtf32 + i);
+            }
+
+            // Decode the next block through the table
+            size_t blockEnd = min(i + ASCII_BLOCK_SIZE, length);
+            for(; i < blockEnd; ++i)
+            {
+                pUtf32[i] = pTable[static_cast<unsigned char>(pNarrow[i])];
+            }
+        }
+    }
+
+    return strRet;
+}
+
+/**
+ * Converts a 8-bit extended ASCII encoded string from a given code page directly to the equivalent UTF-8 encoded string,
+ * based on it's code page and if control codes less or equal to 127 are to be converted.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString		the ASCII encoded string to be converted
+ * @param	codePage			the code page from CodePage enumeration that the ASCII string belongs to
+ * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+ *                              also converts ASCII control codes [0; 31, 127] to Unicode
+ * @return	the equivalent UTF-8 encoded string
+ * @since	1.0
+ */
+string CodePage2Unicode::convertStringAscii_to_StringUtf8(const string& narrowString, const CodePage codePage, const bool convertAsciiControl)
+{
+    // Resolve the code page once
+    const CodePageTables& objTables = getCodePageTables();
+    size_t tableIndex = getCodePageTableIndex(codePage);
+    size_t variant = convertAsciiControl ? 1 : 0;
+    const unsigned char (*pTable)[4] = objTables.m_arrUtf8Tables[tableIndex][variant];
+    bool asciiIdentity = objTables.m_arrAsciiIdentity[tableIndex][variant];
+
+    // The Latin-1 based code pages are expanded as Latin-1 blocks, unless the control codes are converted to their glyphs
+    bool latin1Based = isCodePageLatin1Based(codePage) && !convertAsciiControl;
+
+    // The EBCDIC code pages don't have 7-bit ASCII blocks, but their translation to Latin-1 has,
+    // unless the control codes are converted to their glyphs
+    const unsigned char* pAsciiTable = nullptr;
+    if(isCodePageEbcdic(codePage) && !convertAsciiControl)
+    {
+        pAsciiTable = getCodePageTranslationTables().m_arrTables[tableIndex][getCodePageTableIndex(CodePage::ISO_8859_1)];
+    }
+
+    const char* pNarrow = narrowString.data();
+    size_t length = narrowString.length();
+
+    // Measure the UTF-8 string, so it's allocated only once
+    size_t utf8Length = 0;
+    for(size_t i = 0; i < length; ++i)
+    {
+        utf8Length += pTable[static_cast<unsigned char>(pNarrow[i])][3];
+    }
+
+    // The sequences are copied 3 bytes at a time, so leave room for the last one
+    string strRet(utf8Length + 2, '\0');
+    char* pUtf8 = &strRet[0];
+    size_t count = 0;
+    size_t i = 0;
+    while(i < length)
+    {
+        if(latin1Based)
+        {
+            // Expand the blocks of Latin-1 characters
+            size_t blockCodeUnits = 0;
+            i += convertLatin1Blocks_to_Utf8(pNarrow + i, length - i, pUtf8 + count, strRet.length() - count,
+                                             objTables.m_arrLatin1Patches[tableIndex], blockCodeUnits);
+            count += blockCodeUnits;
+        }
+        else if(asciiIdentity)
+        {
+            // Copy the 7-bit ASCII blocks
+            size_t asciiBytes = getAsciiBlocksLength(pNarrow + i, length - i);
+            memcpy(pUtf8 + count, pNarrow + i, asciiBytes);
+            i += asciiBytes;
+            count += asciiBytes;
+        }
+        else if(pAsciiTable != nullptr)
+        {
+            // Translate the blocks of 7-bit ASCII characters
+            size_t asciiBytes = translateAsciiBlocks(pNarrow + i, length - i, pAsciiTable, pUtf8 + count);
+            i += asciiBytes;
+            count += asciiBytes;
+        }
+
+        // Copy the UTF-8 sequences of the next block
+        size_t blockEnd = min(i + ASCII_BLOCK_SIZE, length);
+        for(; i < blockEnd; ++i)
+        {
+            const unsigned char* pSequence = pTable[static_cast<unsigned char>(pNarrow[i])];
+            pUtf8[count] = static_cast<char>(pSequence[0]);
+            pUtf8[count + 1] = static_cast<char>(pSequence[1]);
+            pUtf8[count + 2] = static_cast<char>(pSequence[2]);
+            count += pSequence[3];
+        }
+    }
+
+    strRet.resize(utf8Length);
+
+    return strRet;
+}
+
+/**
+ * Converts a 8-bit extended ASCII encoded string from a given code page directly to the equivalent UTF-16 encoded string,
+ * based on it's code page and if control codes less or equal to 127 are to be converted.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString		the ASCII encoded string to be converted
+ * @param	codePage			the code page from CodePage enumeration that the ASCII string belongs to
+ * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+ *                              also converts ASCII control codes [0; 31, 127] to Unicode
+ * @return	the equivalent UTF-16 encoded string
+ * @since	1.0
+ */
+u16string CodePage2Unicode::convertStringAscii_to_StringUtf16(const string& narrowString, const CodePage codePage, const bool convertAsciiControl)
+{
+    // Resolve the code page once, so each character is a single table load
+    const CodePageTables& objTables = getCodePageTables();
+    size_t tableIndex = getCodePageTableIndex(codePage);
+    size_t variant = convertAsciiControl ? 1 : 0;
+    const char16_t* pTable = objTables.m_arrUtf16Tables[tableIndex][variant];
+    bool asciiIdentity = objTables.m_arrAsciiIdentity[tableIndex][variant];
+
+    // The Latin-1 based code pages are zero-extended as Latin-1 blocks, unless the control codes are converted to their glyphs
+    bool latin1Based = isCodePageLatin1Based(codePage) && !convertAsciiControl;
+
+    const char* pNarrow = narrowString.data();
+    size_t length = narrowString.length();
+
+    // Every character of an 8-bit code page is a single UTF-16 code unit
+    u16string strRet(length, (char16_t)0);
+    if(length > 0)
+    {
+        char16_t* pUtf16 = &strRet[0];
+        size_t i = 0;
+        while(i < length)
+        {
+            if(latin1Based)
+            {
+                // Zero-extend the Latin-1 blocks
+                i += convertLatin1Blocks_to_Utf16(pNarrow + i, length - i, pUtf16 + i, objTables.m_arrLatin1Patches[tableIndex]);
+            }
+            else if(asciiIdentity)
+            {
+                // Zero-extend the 7-bit ASCII blocks
+                i += convertAsciiBlocks_to_Utf16(pNarrow + i, length - i, pUtf16 + i);
+            }
+
+            // Decode the next block through the table
+            size_t blockEnd = min(i + ASCII_BLOCK_SIZE, length);
+            for(; i < blockEnd; ++i)
+            {
+                pUtf16[i] = pTable[static_cast<unsigned char>(pNarrow[i])];
+            }
+        }
+    }
+
+    return strRet;
+}
+
+/**
+ * Converts an UTF-32 code point to the equivalent 8-bit extended ASCII character of a given code page.<br />
+ * Both the characters and the control code glyphs of the code page are mapped back.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	charUtf32			the UTF-32 code point to be converted
+ * @param	codePage			the code page from CodePage enumeration of the ASCII character
+ * @param	narrowChar			receives the equivalent ASCII character, if the code point is mappable
+ * @return	'true' if the code point can be represented in the code page, 'false' otherwise
+ * @since	1.0
+ */
+bool CodePage2Unicode::convertCharUtf32_to_CharAscii(const char32_t charUtf32, const CodePage codePage, char& narrowChar)
+{
+    return getCodePageEncodingTables().lookup(getCodePageTableIndex(codePage), charUtf32, narrowChar);
+}
+
+/**
+ * Converts an UTF-32 encoded string to the equivalent 8-bit extended ASCII encoded string of a given code page.<br />
+ * The 8-bit code pages without a map only represent the 7-bit ASCII characters, UTF-8 is
+ * encoded directly and the code pages with 16-bit or 32-bit code units aren't narrow encodings.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String			the UTF-32 encoded string to be converted
+ * @param	codePage			the code page from CodePage enumeration of the ASCII string
+ * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+ *                              with the characters that can't be represented in the code page
+ * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+ *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+ * @return	the equivalent ASCII encoded string
+ * @since	1.0
+ */
+string CodePage2Unicode::convertStringUtf32_to_StringAscii(const u32string& utf32String, const CodePage codePage,
+                                                           const UnmappableAction unmappableAction, const char replacementChar)
+{
+    // Each code point gives at most one character, but for UTF-8
+    size_t length = utf32String.length();
+    if(codePage == CodePage::UTF_8)
+    {
+        length = getUtf8Length(utf32String.data(), length);
+    }
+
+    string strRet(length, '\0');
+    ConversionResult objResult = convertUtf32_to_Ascii(utf32String.data(), utf32String.length(), &strRet[0], strRet.length(),
+                                                       codePage, unmappableAction, replacementChar);
+    if(objResult.status != ConversionStatus::OK)
+    {
+        throw logic_error(getConversionErrorMessage(objResult.status, (codePage == CodePage::UTF_8) ? CodePage::UTF_32 : codePage));
+    }
+    strRet.resize(objResult.written);
+
+    return strRet;
+}
+
+/**
+ * Converts an UTF-8 encoded string directly to the equivalent 8-bit extended ASCII encoded string of a given
+ * code page, without going through UTF-32.<br />
+ * ISO-8859-1 (Latin-1) and the code pages based on it (ISO-8859-15 and Windows-1252) are narrowed with
+ * SIMD instructions when available, with their own characters handled separately. The 8-bit code pages
+ * without a map only represent the 7-bit ASCII characters, and the Unicode encodings aren't narrow 8-bit
+ * code pages. The invalid UTF-8 sequences are unmappable characters.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String			the UTF-8 encoded string to be converted
+ * @param	codePage			the code page from CodePage enumeration of the ASCII string
+ * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+ *                              with the characters that can't be represented in the code page
+ * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+ *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+ * @return	the equivalent ASCII encoded string
+ * @since	1.0
+ */
+string CodePage2Unicode::convertStringUtf8_to_StringAscii(const string& utf8String, const CodePage codePage,
+                                                          const UnmappableAction unmappableAction, const char replacementChar)
+{
+    // Each UTF-8 sequence gives at most one character
+    string strRet(utf8String.length(), '\0');
+    ConversionResult objResult = convertUtf8_to_Ascii(utf8String.data(), utf8String.length(), &strRet[0], strRet.length(),
+                                                      codePage, unmappableAction, replacementChar);
+    if(objResult.status != ConversionStatus::OK)
+    {
+        throw logic_error(getConversionErrorMessage(objResult.status, (objResult.status == ConversionStatus::UNSUPPORTED_CODE_PAGE) ? codePage : CodePage::UTF_8));
+    }
+    strRet.resize(objResult.written);
+
+    return strRet;
+}
+
+/**
+ * Converts an UTF-16 encoded string directly to the equivalent 8-bit extended ASCII encoded string of a given
+ * code page, without going through UTF-32.<br />
+ * ISO-8859-1 (Latin-1) and the code pages based on it (ISO-8859-15 and Windows-1252) are narrowed with
+ * SIMD instructions when available, with their own characters handled separately, and the other 8-bit
+ * code pages through their encoding tables. The 8-bit code pages without a map only represent the 7-bit
+ * ASCII characters, and the Unicode encodings aren't narrow 8-bit code pages. The unpaired surrogates
+ * are unmappable characters.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String			the UTF-16 encoded string to be converted
+ * @param	codePage			the code page from CodePage enumeration of the ASCII string
+ * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+ *                              with the characters that can't be represented in the code page
+ * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+ *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+ * @return	the equivalent ASCII encoded string
+ * @since	1.0
+ */
+string CodePage2Unicode::convertStringUtf16_to_StringAscii(const u16string& utf16String, const CodePage codePage,
+                                                           const UnmappableAction unmappableAction, const char replacementChar)
+{
+    // Each UTF-16 code unit gives at most one character
+    string strRet(utf16String.length(), '\0');
+    ConversionResult objResult = convertUtf16_to_Ascii(utf16String.data(), utf16String.length(), &strRet[0], strRet.length(),
+                                                       codePage, unmappableAction, replacementChar);
+    if(objResult.status != ConversionStatus::OK)
+    {
+        throw logic_error(getConversionErrorMessage(objResult.status, (objResult.status == ConversionStatus::UNSUPPORTED_CODE_PAGE) ? codePage : CodePage::UTF_16));
+    }
+    strRet.resize(objResult.written);
+
+    return strRet;
+}
+
+/**
+ * Translates an 8-bit extended ASCII encoded string of a given code page to the equivalent encoded string
+ * of another code page, byte to byte, without going through UTF-32.<br />
+ * The 8-bit code pages without a map only represent the 7-bit ASCII characters, and the Unicode
+ * encodings aren't translated.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString		the ASCII encoded string to be translated
+ * @param	fromCodePage		the code page from CodePage enumeration of the string to be translated
+ * @param	toCodePage			the code page from CodePage enumeration of the translated string
+ * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+ *                              with the characters that can't be represented in the target code page
+ * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+ *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+ * @return	the equivalent ASCII encoded string of the target code page
+ * @since	1.0
+ */
+string CodePage2Unicode::translateStringCodePage(const string& narrowString, const CodePage fromCodePage, const CodePage toCodePage,
+                                                const UnmappableAction unmappableAction, const char replacementChar)
+{
+    // Each character gives at most one character
+    string strRet(narrowString.length(), '\0');
+    ConversionResult objResult = translateCodePage(narrowString.data(), narrowString.length(), &strRet[0], strRet.length(),
+                                                   fromCodePage, toCodePage, unmappableAction, replacementChar);
+    if(objResult.status == ConversionStatus::UNMAPPABLE_CHARACTER)
+    {
+        throw logic_error("Untranslatable character");
+    }
+    else if(objResult.status != ConversionStatus::OK)
+    {
+        throw logic_error(getConversionErrorMessage(objResult.status, isCodePageUnicode(fromCodePage) ? fromCodePage : toCodePage));
+    }
+    strRet.resize(objResult.written);
+
+    return strRet;
+}
+
+/**
+ * Converts an UTF-16 encoded string to the equivalent 2 bytes system wide character encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String			the UTF-16 encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                          invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @return	the equivalent 2 bytes system wide character encoded string
+ * @since	1.0
+ */
+wstring CodePage2Unicode::convertStringUtf16_to_StringWide2(const u16string& utf16String, const bool strictConversion)
+{
+#if defined(_DEBUG)
+        // wchar_t must be 16-bit
+        assert(isWideCharUtf16());
+#endif
+
+    wstring strRet;
+    wchar_t codeUnits[2] = {
+        0, 0
+    };
+    for(unsigned i = 0; i < utf16String.length(); i++)
+    {
+        codeUnits[0] = static_cast<wchar_t>(utf16String.at(i));
+        strRet.append(codeUnits);
+    }
+
+    return strRet;
+}
+
+/**
+ * Converts a 2 bytes system wide character encoded string to the equivalent UTF-16 encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	wideString			the 2 bytes system wide character encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                          invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @return	the equivalent UTF-16 encoded string
+ * @since	1.0
+ */
+u16string CodePage2Unicode::convertStringWide2_to_StringUtf16(const wstring& wideString, const bool strictConversion)
+{
+#if defined(_DEBUG)
+        // wchar_t must be 16-bit
+        assert(isWideCharUtf16());
+#endif
+
+    u16string strRet;
+    char16_t codeUnits[2] = {
+        0, 0
+    };
+    for(unsigned i = 0; i < wideString.length(); i++)
+    {
+        codeUnits[0] = static_cast<char16_t>(wideString.at(i));
+        strRet.append(codeUnits);
+    }
+
+    return strRet;
+}
+
+/**
+ * Converts an UTF-16 encoded string to the equivalent 4 bytes system wide character encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String			the UTF-16 encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                          invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @return	the equivalent 4 bytes system wide character encoded string
+ * @since	1.0
+ */
+wstring CodePage2Unicode::convertStringUtf16_to_StringWide4(const u16string& utf16String, const bool strictConversion)
+{
+#if defined(_DEBUG)
+        // wchar_t must be 32-bit
+        assert(isWideCharUtf32());
+#endif
+
+    wstring strRet;
+    u32string strRetT = convertStringUtf16_to_StringUtf32(utf16String, strictConversion);
+    wchar_t codeUnits[2] = {
+        0, 0
+    };
+    for(unsigned i = 0; i < strRetT.length(); i++)
+    {
+        codeUnits[0] = static_cast<wchar_t>(strRetT.at(i));
+        strRet.append(codeUnits);
+    }
+
+    return strRet;
+}
+
+/**
+ * Converts a 4 bytes system wide character encoded string to the equivalent UTF-16 encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	wideString			the 4 bytes system wide character encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                          invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @return	the equivalent UTF-16 encoded string
+ * @since	1.0
+ */
+u16string CodePage2Unicode::convertStringWide4_to_StringUtf16(const wstring& wideString, const bool strictConversion)
+{
+#if defined(_DEBUG)
+        // wchar_t must be 32-bit
+        assert(isWideCharUtf32());
+#endif
+
+    u32string strRetT = convertStringWide4_to_StringUtf32(wideString, strictConversion);
+    u16string strRet = convertStringUtf32_to_StringUtf16(strRetT, strictConversion);
+
+    return strRet;
+}
+
+/**
+ * Converts an UTF-32 encoded string to the equivalent 2 bytes system wide character encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String			the UTF-32 encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                          invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @return	the equivalent 2 bytes system wide character encoded string
+ * @since	1.0
+ */
+wstring CodePage2Unicode::convertStringUtf32_to_StringWide2(const u32string& utf32String, const bool strictConversion)
+{
+#if defined(_DEBUG)
+        // wchar_t must be 16-bit
+        assert(isWideCharUtf16());
+#endif
+
+    wstring strRet;
+    u16string strRetT = convertStringUtf32_to_StringUtf16(utf32String, strictConversion);
+    wchar_t codeUnits[2] = {
+        0, 0
+    };
+    for(unsigned i = 0; i < strRetT.length(); i++)
+    {
+        codeUnits[0] = static_cast<wchar_t>(strRetT.at(i));
+        strRet.append(codeUnits);
+    }
+
+    return strRet;
+}
+
+/**
+ * Converts an 2 bytes system wide character encoded string to the equivalent  encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	wideString			the 2 bytes system wide character encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @return	the equivalent UTF-32 string
+ * @since	1.0
+ */
+u32string CodePage2Unicode::convertStringWide2_to_StringUtf32(const wstring& wideString, const bool strictConversion)
+{
+#if defined(_DEBUG)
+        // wchar_t must be 16-bit
+        assert(isWideCharUtf16());
+#endif
+
+    u16string strRetT = convertStringWide2_to_StringUtf16(wideString, strictConversion);
+    u32string strRet = convertStringUtf16_to_StringUtf32(strRetT, strictConversion);
+
+    return strRet;
+}
+
+/**
+ * Converts an UTF-32 encoded string to the equivalent 4 bytes system wide character encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String			the UTF-32 encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                          invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @return	the equivalent 4 bytes system wide character encoded string
+ * @since	1.0
+ */
+wstring CodePage2Unicode::convertStringUtf32_to_StringWide4(const u32string& utf32String, const bool strictConversion)
+{
+#if defined(_DEBUG)
+        // wchar_t must be 32-bit
+        assert(isWideCharUtf32());
+#endif
+
+    wstring strRet;
+    wchar_t codeUnits[2] = {
+        0, 0
+    };
+    for(unsigned i = 0; i < utf32String.length(); i++)
+    {
+        codeUnits[0] = static_cast<wchar_t>(utf32String.at(i));
+        strRet.append(codeUnits);
+    }
+
+    return strRet;
+}
+
+/**
+ * Converts an 4 bytes system wide character encoded string to the equivalent  encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	wideString			the 4 bytes system wide character encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @return	the equivalent UTF-32 string
+ * @since	1.0
+ */
+u32string CodePage2Unicode::convertStringWide4_to_StringUtf32(const wstring& wideString, const bool strictConversion)
+{
+#if defined(_DEBUG)
+        // wchar_t must be 32-bit
+        assert(isWideCharUtf32());
+#endif
+
+    u32string strRet;
+    char32_t codeUnits[2] = {
+        0, 0
+    };
+    for(unsigned i = 0; i < wideString.length(); i++)
+    {
+        codeUnits[0] = static_cast<char32_t>(wideString.at(i));
+        strRet.append(codeUnits);
+    }
+
+    return strRet;
+}
+
+/**
+ * Converts an system narrow character encoded string to the equivalent system wide character encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString		the system narrow character encoded string to be converted
+ * @return	the equivalent system wide character string
+ * @since	1.0
+ */
+wstring CodePage2Unicode::convertStringNarrow_to_StringWide(const string& narrowString)
+{
+    wstring wideString;
+    size_t requiredSize = 0;
+    wchar_t* cstrUnicode = nullptr;
+    size_t nRet = 0;
+
+#if defined(_WIN32) || defined(_WIN64) || defined(_WIN32_WCE) || defined(__CYGWIN__)
+        // Microsoft Windows
+        requiredSize = (size_t)::MultiByteToWideChar(CP_ACP, MB_PRECOMPOSED, narrowString.c_str(), -1, nullptr, 0);
+#else
+        // ANSI C/C++
+        requiredSize = ::mbstowcs(nullptr, narrowString.c_str(), 0);
+#endif
+
+    if(requiredSize > 0)
+    {
+        cstrUnicode = (wchar_t*)::malloc((requiredSize + 1) * sizeof(wchar_t));
+        if(cstrUnicode != nullptr)
+        {
+            cstrUnicode[requiredSize] = L'\0';
+#if defined(_WIN32) || defined(_WIN64) || defined(_WIN32_WCE) || defined(__CYGWIN__)
+                // Microsoft Windows
+                nRet = (size_t)::MultiByteToWideChar(CP_ACP, MB_PRECOMPOSED, narrowString.c_str(), -1, cstrUnicode, (int)requiredSize);
+#else
+                // ANSI C/C++
+                nRet = ::mbstowcs(cstrUnicode, narrowString.c_str(), requiredSize);
+#endif
+
+            if((nRet == 0) || (nRet == static_cast<size_t>(-1)) || (nRet > requiredSize))
+            {
+                // Error converting string
+                ::free((void*)cstrUnicode);
+                cstrUnicode = nullptr;
+            }
+        }
+        else
+        {
+            // Error allocating memory
+            cstrUnicode = nullptr;
+        }
+    }
+    else
+    {
+        // Error, can't convert
+        cstrUnicode = nullptr;
+    }
+
+    if(cstrUnicode == nullptr)
+    {
+        throw logic_error("Can't convert narrow string to wide string");
+    }
+    else
+    {
+        wideString = wstring(cstrUnicode);
+        ::free(cstrUnicode);
+        cstrUnicode = nullptr;
+    }
+
+    return wideString;
+}
+
+/**
+ * Converts an system wide character encoded string to the equivalent system narrow character encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	wideString		the system wide character encoded string to be converted
+ * @return	the equivalent system narrow character string
+ * @since	1.0
+ */
+string CodePage2Unicode::convertStringWide_to_StringNarrow(const wstring& wideString)
+{
+    string narrowString;
+    size_t requiredSize = 0;
+    char* cstrASCII = nullptr;
+    size_t nRet = 0;
+
+#if defined(_WIN32) || defined(_WIN64) || defined(_WIN32_WCE) || defined(__CYGWIN__)
+        // Microsoft Windows
+        requiredSize = (size_t)::WideCharToMultiByte(CP_ACP, WC_COMPOSITECHECK | WC_SEPCHARS | WC_NO_BEST_FIT_CHARS, wideString.c_str(), -1, nullptr, 0, nullptr, nullptr);
+#else
+        // ANSI C/C++
+        requiredSize = ::wcstombs(nullptr, wideString.c_str(), 0);
+#endif
+
+    if(requiredSize > 0)
+    {
+        cstrASCII = (char*)::malloc((requiredSize + 1) * sizeof(char));
+        if(cstrASCII != nullptr)
+        {
+            cstrASCII[requiredSize] = '\0';
+#if defined(_WIN32) || defined(_WIN64) || defined(_WIN32_WCE) || defined(__CYGWIN__)
+                // Microsoft Windows
+                nRet = (size_t)::WideCharToMultiByte(CP_ACP, WC_COMPOSITECHECK | WC_SEPCHARS | WC_NO_BEST_FIT_CHARS, wideString.c_str(), -1, cstrASCII, (int)requiredSize, nullptr, nullptr);
+#else
+                // ANSI C/C++
+                nRet = ::wcstombs(cstrASCII, wideString.c_str(), requiredSize);
+#endif
+
+            if((nRet == 0) || (nRet == static_cast<size_t>(-1)) || (nRet > requiredSize))
+            {
+                // Error converting string
+                ::free((void*)cstrASCII);
+                cstrASCII = nullptr;
+            }
+        }
+        else
+        {
+            // Error allocating memory
+            cstrASCII = nullptr;
+        }
+    }
+    else
+    {
+        // Error, can't convert
+        cstrASCII = nullptr;
+    }
+
+    if(cstrASCII == nullptr)
+    {
+        throw logic_error("Can't convert wide string to narrow string");
+    }
+    else
+    {
+        narrowString = string(cstrASCII);
+        ::free(cstrASCII);
+        cstrASCII = nullptr;
+    }
+
+    return narrowString;
+}
+
+/**
+ * Decodes the UTF-8 sequence of a code point without throwing exceptions, following the well-formed UTF-8
+ * byte sequences table of the Unicode Standard (no overlong forms, no surrogates, nothing above U+10FFFF).
+ * An ill-formed sequence is decoded as the replacement character and only its maximal subpart (the code
+ * units before the first one that can't continue it) is consumed, so each error is replaced once.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String	the UTF-8 code units
+ * @param	length		the number of UTF-8 code units
+ * @param	index		the index of the first code unit of the sequence, receives the index of the next one
+ * @param	codePoint	receives the UTF-32 code point, or the replacement character
+ * @return	'ConversionStatus::OK' if the sequence is valid, otherwise the error found
+ * @since	1.0
+ */
+inline ConversionStatus CodePage2Unicode::tryDecodeUtf8Char(const char* utf8String, const size_t length, size_t& index, char32_t& codePoint)
+{
+    unsigned char codeUnit = static_cast<unsigned char>(utf8String[index]);
+    ++index;
+
+    if(codeUnit < 0x80U)
+    {
+        // OK, it's an ASCII, so no surrogate needed
+        codePoint = static_cast<char32_t>(codeUnit);
+
+        return ConversionStatus::OK;
+    }
+
+    // First surrogate sequence code unit, the overlong 2 bytes leads (0xC0, 0xC1) and the leads above
+    // U+10FFFF can't start a sequence
+    size_t sequenceBytes = ((codeUnit >= 0xC2U) && (codeUnit <= 0xF4U)) ? getCodeUnitsForUtf8Leads(static_cast<char>(codeUnit)) : 0;
+    switch(sequenceBytes)
+    {
+        case 2:
+            codePoint = codeUnit & UTF8_LEAD_BYTES2_MASK;
+            break;
+
+        case 3:
+            codePoint = codeUnit & UTF8_LEAD_BYTES3_MASK;
+            break;
+
+        case 4:
+            codePoint = codeUnit & UTF8_LEAD_BYTES4_MASK;
+            break;
+
+        default:
+            // A next code unit, an overlong or above U+10FFFF lead, or a 5 or 6 bytes sequence lead, which
+            // are no longer UTF-8
+            codePoint = static_cast<char32_t>(UNICODE_REPLACEMENT_CHARACTER);
+
+            return ConversionStatus::INVALID_LEAD_UNIT;
+    }
+
+    for(size_t j = 1; j < sequenceBytes; ++j, ++index)
+    {
+        // Read the next code unit of the surrogate sequence
+        if(index >= length)
+        {
+            // The UTF-8 string ended to soon
+            codePoint = static_cast<char32_t>(UNICODE_REPLACEMENT_CHARACTER);
+
+            return ConversionStatus::INCOMPLETE_SEQUENCE;
+        }
+        char codeUnitNext = utf8String[index];
+        if(!isUtf8NextSurrogateOf(static_cast<char>(codeUnit), j, codeUnitNext))
+        {
+            // Not a next code unit that continues the surrogate sequence, it's left to start the next one
+            codePoint = static_cast<char32_t>(UNICODE_REPLACEMENT_CHARACTER);
+
+            return ConversionStatus::INVALID_SEQUENCE;
+        }
+
+        // OK, build UTF-32 character from sequence
+        codePoint = codePoint << UTF8_HALF_SHIFT;
+        codePoint = codePoint + (codeUnitNext & UTF8_NEXT_MASK);
+    }
+
+    // Check if UTF-32 code point is valid, the well-formed sequences leave only the non-characters out
+    if(!isUnicodeInterchangeCharacter(codePoint))
+    {
+        codePoint = static_cast<char32_t>(UNICODE_REPLACEMENT_CHARACTER);
+
+        return ConversionStatus::INVALID_CODE_POINT;
+    }
+
+    return ConversionStatus::OK;
+}
+
+/**
+ * Encodes a code point as an UTF-8 sequence without throwing exceptions. An invalid code point is
+ * encoded as the replacement character.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	codePoint		the UTF-32 code point to be encoded
+ * @param	utf8Sequence	receives the UTF-8 sequence, must have room for 4 code units
+ * @param	sequenceLength	receives the number of UTF-8 code units of the sequence
+ * @return	'ConversionStatus::OK' if the code point is valid, otherwise 'ConversionStatus::INVALID_CODE_POINT'
+ * @since	1.0
+ */
+inline ConversionStatus CodePage2Unicode::tryEncodeUtf8Char(const char32_t codePoint, char* utf8Sequence, size_t& sequenceLength)
+{
+    // Check if UTF-32 code point is valid, isn't a surrogate and fits a 4 bytes sequence
+    if((getCodeUnitsForUtf8Char(codePoint) == 0) ||
+       !isUnicodeInterchangeCharacter(codePoint) ||
+       isUnicodeSurrogateCodePoint(codePoint))
+    {
+        utf8Sequence[0] = static_cast<char>(0xEFU);
+        utf8Sequence[1] = static_cast<char>(0xBFU);
+        utf8Sequence[2] = static_cast<char>(0xBDU);
+        sequenceLength = 3;
+
+        return ConversionStatus::INVALID_CODE_POINT;
+    }
+
+    if(codePoint < 0x80UL)
+    {
+        // OK, it's an ASCII, so no surrogate needed
+        utf8Sequence[0] = static_cast<char>(codePoint);
+        sequenceLength = 1;
+    }
+    else if(codePoint < 0x800UL)
+    {
+        utf8Sequence[0] = static_cast<char>((codePoint >> UTF8_HALF_SHIFT) | 0xC0U);
+        utf8Sequence[1] = static_cast<char>((codePoint & 0x3FU) | 0x80U);
+        sequenceLength = 2;
+    }
+    else if(codePoint < 0x10000UL)
+    {
+        utf8Sequence[0] = static_cast<char>((codePoint >> (2 * UTF8_HALF_SHIFT)) | 0xE0U);
+        utf8Sequence[1] = static_cast<char>(((codePoint >> UTF8_HALF_SHIFT) & 0x3FU) | 0x80U);
+        utf8Sequence[2] = static_cast<char>((codePoint & 0x3FU) | 0x80U);
+        sequenceLength = 3;
+    }
+    else
+    {
+        utf8Sequence[0] = static_cast<char>((codePoint >> (3 * UTF8_HALF_SHIFT)) | 0xF0U);
+        utf8Sequence[1] = static_cast<char>(((codePoint >> (2 * UTF8_HALF_SHIFT)) & 0x3FU) | 0x80U);
+        utf8Sequence[2] = static_cast<char>(((codePoint >> UTF8_HALF_SHIFT) & 0x3FU) | 0x80U);
+        utf8Sequence[3] = static_cast<char>((codePoint & 0x3FU) | 0x80U);
+        sequenceLength = 4;
+    }
+
+    return ConversionStatus::OK;
+}
+
+/**
+ * Decodes the UTF-16 code unit or surrogate pair of a code point without throwing exceptions. An unpaired
+ * surrogate is decoded as the replacement character.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String	the UTF-16 code units
+ * @param	length		the number of UTF-16 code units
+ * @param	index		the index of the code unit, receives the index of the next one
+ * @param	codePoint	receives the UTF-32 code point, or the replacement character
+ * @return	'ConversionStatus::OK' if the code unit or surrogate pair is valid, otherwise the error found
+ * @since	1.0
+ */
+inline ConversionStatus CodePage2Unicode::tryDecodeUtf16Char(const char16_t* utf16String, const size_t length, size_t& index, char32_t& codePoint)
+{
+    char16_t charUtf16_1 = utf16String[index];
+    ++index;
+
+    if(isUtf16HighSurrogate(charUtf16_1))
+    {
+        if(index >= length)
+        {
+            // The UTF-16 string ended before the low surrogate
+            codePoint = static_cast<char32_t>(UNICODE_REPLACEMENT_CHARACTER);
+
+            return ConversionStatus::INCOMPLETE_SEQUENCE;
+        }
+
+        // Read surrogate low
+        char16_t charUtf16_2 = utf16String[index];
+        if(!isUtf16LowSurrogate(charUtf16_2))
+        {
+            // Unpaired high surrogate, the code unit is left to start the next character
+            codePoint = static_cast<char32_t>(UNICODE_REPLACEMENT_CHARACTER);
+
+            return ConversionStatus::INVALID_SEQUENCE;
+        }
+        codePoint = static_cast<char32_t>(((charUtf16_1 - UNICODE_HIGH_SURROGATE_START) << UTF16_HALF_SHIFT) +
+                                          (charUtf16_2 - UNICODE_LOW_SURROGATE_START) + UTF16_HALF_BASE);
+        ++index;
+    }
+    else if(isUtf16LowSurrogate(charUtf16_1))
+    {
+        // Unpaired low surrogate
+        codePoint = static_cast<char32_t>(UNICODE_REPLACEMENT_CHARACTER);
+
+        return ConversionStatus::INVALID_LEAD_UNIT;
+    }
+    else
+    {
+        // OK, code point in BMP
+        codePoint = static_cast<char32_t>(charUtf16_1);
+    }
+
+    // Check if UTF-32 code point is valid
+    if(!isUnicodeInterchangeCharacter(codePoint))
+    {
+        codePoint = static_cast<char32_t>(UNICODE_REPLACEMENT_CHARACTER);
+
+        return ConversionStatus::INVALID_CODE_POINT;
+    }
+
+    return ConversionStatus::OK;
+}
+
+/**
+ * Encodes a code point as an UTF-16 code unit or surrogate pair without throwing exceptions. An invalid
+ * code point is encoded as the replacement character.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	codePoint		the UTF-32 code point to be encoded
+ * @param	utf16Sequence	receives the UTF-16 code units, must have room for 2 code units
+ * @param	sequenceLength	receives the number of UTF-16 code units
+ * @return	'ConversionStatus::OK' if the code point is valid, otherwise 'ConversionStatus::INVALID_CODE_POINT'
+ * @since	1.0
+ */
+inline ConversionStatus CodePage2Unicode::tryEncodeUtf16Char(const char32_t codePoint, char16_t* utf16Sequence, size_t& sequenceLength)
+{
+    // Check if UTF-32 code point is valid: UTF-16 surrogate values are illegal in UTF-32,
+    // 0XFFFF and 0XFFFE are both reserved values, and nothing above the maximum value of Unicode
+    if(!isUnicodeInterchangeCharacter(codePoint) ||
+       ((codePoint <= UNICODE_MAXIMUM_BMP) && isUtf16Surrogate(static_cast<char16_t>(codePoint))) ||
+       (codePoint > UNICODE_MAXIMUM))
+    {
+        utf16Sequence[0] = static_cast<char16_t>(UNICODE_REPLACEMENT_CHARACTER);
+        sequenceLength = 1;
+
+        return ConversionStatus::INVALID_CODE_POINT;
+    }
+
+    if(codePoint <= UNICODE_MAXIMUM_BMP)
+    {
+        // UCS-4/UTF-32 BMP code point doesn't needs to be converted to UTF-16 surrogate
+        utf16Sequence[0] = static_cast<char16_t>(codePoint);
+        sequenceLength = 1;
+    }
+    else
+    {
+        // UTF-32 code point in range 0x10000 - 0x10FFFF, needs to be converted to UTF-16 surrogate
+        char32_t offset = codePoint - UTF16_HALF_BASE;
+        utf16Sequence[0] = static_cast<char16_t>((offset >> UTF16_HALF_SHIFT) + UNICODE_HIGH_SURROGATE_START);
+        utf16Sequence[1] = static_cast<char16_t>((offset & UTF16_HALF_MASK) + UNICODE_LOW_SURROGATE_START);
+        sequenceLength = 2;
+    }
+
+    return ConversionStatus::OK;
+}
+
+/**
+ * Gets the message of the exception thrown by the string conversions for a conversion error.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	status		the conversion status of the error
+ * @param	codePage	the code page from CodePage enumeration of the input where the error was found
+ * @return	the exception message
+ * @since	1.0
+ */
+const char* CodePage2Unicode::getConversionErrorMessage(const ConversionStatus status, const CodePage codePage)
+{
+    bool utf16 = (codePage == CodePage::UTF_16);
+
+    if(codePage == CodePage::UTF_7)
+    {
+        switch(status)
+        {
+            case ConversionStatus::INCOMPLETE_SEQUENCE:
+                return "Invalid UTF-7 unterminated base64 sequence";
+
+            case ConversionStatus::INVALID_LEAD_UNIT:
+                return "Invalid UTF-7 character";
+
+            case ConversionStatus::INVALID_SEQUENCE:
+                return "Invalid UTF-7 base64 sequence";
+
+            default:
+                break;
+        }
+    }
+
+    switch(status)
+    {
+        case ConversionStatus::OUTPUT_TOO_SMALL:
+            return "Output buffer too small";
+
+        case ConversionStatus::INCOMPLETE_SEQUENCE:
+            return utf16 ? "Invalid UTF-16 unpaired high surrogate pair" : "Invalid UTF-8 size";
+
+        case ConversionStatus::INVALID_LEAD_UNIT:
+            return utf16 ? "Invalid UTF-16 unpaired low surrogate pair" : "Invalid UTF-8 sequence header value";
+
+        case ConversionStatus::INVALID_SEQUENCE:
+            return utf16 ? "Invalid UTF-16 low surrogate pair" : "Invalid UTF-8 sequence";
+
+        case ConversionStatus::INVALID_CODE_POINT:
+            return "Invalid UTF-32 code point";
+
+        case ConversionStatus::UNMAPPABLE_CHARACTER:
+            return "Unmappable UTF-32 code point";
+
+        case ConversionStatus::UNSUPPORTED_CODE_PAGE:
+            return (codePage == CodePage::UTF_7) ? "Unsupported code page" : "Code page isn't a narrow character encoding";
+
+        default:
+            break;
+    }
+
+    return "Invalid conversion";
+}
+
+/**
+ * Converts an UTF-16 encoded string to the equivalent UTF-32 encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String			the UTF-16 encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @return	the equivalent UTF-32 encoded string
+ * @since	1.0
+ */
+u32string CodePage2Unicode::convertStringUtf16_to_StringUtf32(const u16string& utf16String, const bool strictConversion)
+{
+    // Each UTF-16 code unit gives at most one UTF-32 code point
+    u32string strRet(utf16String.length(), (char32_t)0);
+    ConversionResult objResult = convertUtf16_to_Utf32(utf16String.data(), utf16String.length(), &strRet[0], strRet.length(), strictConversion);
+    if(objResult.status != ConversionStatus::OK)
+    {
+        throw logic_error(getConversionErrorMessage(objResult.status, CodePage::UTF_16));
+    }
+    strRet.resize(objResult.written);
+
+    return strRet;
+}
+
+/**
+ * Converts an UTF-32 encoded string to the equivalent UTF-16 encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String			the UTF-32 encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @return	the equivalent UTF-16 encoded string
+ * @since	1.0
+ */
+u16string CodePage2Unicode::convertStringUtf32_to_StringUtf16(const u32string& utf32String, const bool strictConversion)
+{
+    // Each UTF-32 code point gives at most two UTF-16 code units
+    u16string strRet(2 * utf32String.length(), (char16_t)0);
+    ConversionResult objResult = convertUtf32_to_Utf16(utf32String.data(), utf32String.length(), &strRet[0], strRet.length(), strictConversion);
+    if(objResult.status != ConversionStatus::OK)
+    {
+        throw logic_error(getConversionErrorMessage(objResult.status, CodePage::UTF_32));
+    }
+    strRet.resize(objResult.written);
+
+    return strRet;
+}
+
+/**
+ * Converts an UTF-16 encoded string to the equivalent UTF-8 encoded string, in a single pass.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String			the UTF-16 encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @return	the equivalent UTF-8 encoded string
+ * @since	1.0
+ */
+string CodePage2Unicode::convertStringUtf16_to_StringUtf8(const u16string& utf16String, const bool strictConversion)
+{
+    // Validate parameters
+    assert(&utf16String != nullptr);
+
+    // Each UTF-16 code unit gives at most three UTF-8 code units (a surrogate pair gives four)
+    string strRet(3 * utf16String.length(), '\0');
+    ConversionResult objResult = convertUtf16_to_Utf8(utf16String.data(), utf16String.length(), &strRet[0], strRet.length(), strictConversion);
+    if(objResult.status != ConversionStatus::OK)
+    {
+        throw logic_error(getConversionErrorMessage(objResult.status, CodePage::UTF_16));
+    }
+    strRet.resize(objResult.written);
+
+    return strRet;
+}
+
+/**
+ * Converts an UTF-8 encoded string to the equivalent UTF-16 encoded string, in a single pass.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String			the UTF-8 encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @return	the equivalent UTF-16 encoded string
+ * @since	1.0
+ */
+u16string CodePage2Unicode::convertStringUtf8_to_StringUtf16(const string& utf8String, const bool strictConversion)
+{
+    // Validate parameters
+    assert(&utf8String != nullptr);
+
+    // Each UTF-8 code unit gives at most one UTF-16 code unit (a 4 bytes sequence gives a surrogate pair)
+    u16string strRet(utf8String.length(), (char16_t)0);
+    ConversionResult objResult = convertUtf8_to_Utf16(utf8String.data(), utf8String.length(), &strRet[0], strRet.length(), strictConversion);
+    if(objResult.status != ConversionStatus::OK)
+    {
+        throw logic_error(getConversionErrorMessage(objResult.status, CodePage::UTF_8));
+    }
+    strRet.resize(objResult.written);
+
+    return strRet;
+}
+
+/**
+ * Converts an UTF-32 encoded string to the equivalent UTF-8 encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String			the UTF-32 encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @return	the equivalent UTF-8 encoded string
+ * @since	1.0
+ */
+string CodePage2Unicode::convertStringUtf32_to_StringUtf8(const u32string& utf32String, const bool strictConversion)
+{
+    // Validate parameters
+    assert(&utf32String != nullptr);
+
+    // Pre-size the UTF-8 string from the lengths of the sequences
+    string strRet(getUtf8Length(utf32String.data(), utf32String.length()), '\0');
+    ConversionResult objResult = convertUtf32_to_Utf8(utf32String.data(), utf32String.length(), &strRet[0], strRet.length(), strictConversion);
+    if(objResult.status != ConversionStatus::OK)
+    {
+        throw logic_error(getConversionErrorMessage(objResult.status, CodePage::UTF_32));
+    }
+    strRet.resize(objResult.written);
+
+    return strRet;
+}
+
+/**
+ * Converts an UTF-8 encoded string to the equivalent UTF-32 encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String			the UTF-8 encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @return	the equivalent UTF-32 encoded string
+ * @since	1.0
+ */
+u32string CodePage2Unicode::convertStringUtf8_to_StringUtf32(const string& utf8String, const bool strictConversion)
+{
+    // Validate parameters
+    assert(&utf8String != nullptr);
+
+    // Each UTF-8 code unit gives at most one UTF-32 code point
+    u32string strRet(utf8String.length(), (char32_t)0);
+    ConversionResult objResult = convertUtf8_to_Utf32(utf8String.data(), utf8String.length(), &strRet[0], strRet.length(), strictConversion);
+    if(objResult.status != ConversionStatus::OK)
+    {
+        throw logic_error(getConversionErrorMessage(objResult.status, CodePage::UTF_8));
+    }
+    strRet.resize(objResult.written);
+
+    return strRet;
+}
+
+/**
+ * Converts an UTF-32 encoded string to the equivalent UTF-7 encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String			the UTF-32 encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @param	modifiedUtf7		optional parameter (default is 'false'), if 'true' encodes modified UTF-7 (RFC 3501)
+ * @return	the equivalent UTF-7 encoded string
+ * @since	1.0
+ */
+string CodePage2Unicode::convertStringUtf32_to_StringUtf7(const u32string& utf32String, const bool strictConversion, const bool modifiedUtf7)
+{
+    // Validate parameters
+    assert(&utf32String != nullptr);
+
+    // Mostly directly encoded text, grown when the base64 encoded characters don't fit
+    string strRet(utf32String.length() + 8, '\0');
+    Utf7Encoder objEncoder(strictConversion, modifiedUtf7);
+    size_t consumed = 0;
+    size_t written = 0;
+    while(true)
+    {
+        ConversionResult objResult = (consumed < utf32String.length()) ?
+                                     objEncoder.feed(utf32String.data() + consumed, utf32String.length() - consumed,
+                                                     &strRet[written], strRet.length() - written) :
+                                     objEncoder.finish(&strRet[written], strRet.length() - written);
+        consumed += objResult.consumed;
+        written += objResult.written;
+        if(objResult.status == ConversionStatus::OUTPUT_TOO_SMALL)
+        {
+            strRet.resize(2 * strRet.length());
+            continue;
+        }
+        if(objResult.status != ConversionStatus::OK)
+        {
+            throw logic_error(getConversionErrorMessage(objResult.status, CodePage::UTF_7));
+        }
+        if(consumed >= utf32String.length() && !objEncoder.hasPendingOutput())
+        {
+            break;
+        }
+    }
+    strRet.resize(written);
+
+    return strRet;
+}
+
+/**
+ * Converts an UTF-7 encoded string to the equivalent UTF-32 encoded string.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf7String			the UTF-7 encoded string to be converted
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+ *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+ * @param	modifiedUtf7		optional parameter (default is 'false'), if 'true' decodes modified UTF-7 (RFC 3501)
+ * @return	the equivalent UTF-32 encoded string
+ * @since	1.0
+ */
+u32string CodePage2Unicode::convertStringUtf7_to_StringUtf32(const string& utf7String, const bool strictConversion, const bool modifiedUtf7)
+{
+    // Validate parameters
+    assert(&utf7String != nullptr);
+
+    // Each UTF-7 character gives at most one UTF-32 code point, plus the end of the base64 encoded characters
+    u32string strRet(utf7String.length() + 2, (char32_t)0);
+    Utf7Decoder objDecoder(strictConversion, modifiedUtf7);
+    ConversionResult objResult = objDecoder.feed(utf7String.data(), utf7String.length(), &strRet[0], strRet.length());
+    size_t written = objResult.written;
+    if(objResult.status == ConversionStatus::OK)
+    {
+        objResult = objDecoder.finish(&strRet[written], strRet.length() - written);
+        written += objResult.written;
+    }
+    if(objResult.status != ConversionStatus::OK)
+    {
+        throw logic_error(getConversionErrorMessage(objResult.status, CodePage::UTF_7));
+    }
+    strRet.resize(written);
+
+    return strRet;
+}
+
+/**
+ * Converts an UTF-8 code units buffer to an UTF-16 code units buffer, without allocations.<br />
+ * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String			the UTF-8 code units to be converted
+ * @param	utf8Length			the number of UTF-8 code units
+ * @param	utf16String			receives the UTF-16 code units
+ * @param	utf16Room			the room for UTF-16 code units
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+ *                              sequence, if 'false' replaces invalid character width the replacement character
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertUtf8_to_Utf16(const char* utf8String, const size_t utf8Length,
+                                                        char16_t* utf16String, const size_t utf16Room, const bool strictConversion)
+{
+    ConversionStatus status = ConversionStatus::OK;
+    size_t errorOffset = NO_ERROR_OFFSET;
+    size_t count = 0;
+    size_t i = 0;
+    size_t blockEnd = 0;
+
+    while(i < utf8Length)
+    {
+        if(i >= blockEnd)
+        {
+            // Zero-extend the 7-bit ASCII blocks and join the 2 bytes blocks that fit the room left
+            size_t bytes = convertAsciiBlocks_to_Utf16(utf8String + i, min(utf8Length - i, utf16Room - count), utf16String + count);
+            i += bytes;
+            count += bytes;
+            bytes = convertUtf8TwoBytesBlocks_to_Utf16(utf8String + i, min(utf8Length - i, 2 * (utf16Room - count)), utf16String + count);
+            i += bytes;
+            count += bytes / 2;
+            blockEnd = i + ASCII_BLOCK_SIZE;
+            if(i >= utf8Length)
+            {
+                break;
+            }
+        }
+
+        size_t sequenceStart = i;
+        char32_t codePoint = 0;
+        ConversionStatus charStatus = tryDecodeUtf8Char(utf8String, utf8Length, i, codePoint);
+        ConversionStatus encodeStatus = ConversionStatus::OK;
+        size_t sequenceLength = 0;
+        if(utf16Room - count >= 2)
+        {
+            // Encode straight into the output
+            encodeStatus = tryEncodeUtf16Char(codePoint, utf16String + count, sequenceLength);
+        }
+        else
+        {
+            // Encode aside, as the sequence may not fit the room left
+            char16_t sequence[2];
+            encodeStatus = tryEncodeUtf16Char(codePoint, sequence, sequenceLength);
+            if(count + sequenceLength > utf16Room)
+            {
+                i = sequenceStart;
+                status = ConversionStatus::OUTPUT_TOO_SMALL;
+                break;
+            }
+            for(size_t j = 0; j < sequenceLength; ++j)
+            {
+                utf16String[count + j] = sequence[j];
+            }
+        }
+        if(charStatus == ConversionStatus::OK)
+        {
+            charStatus = encodeStatus;
+        }
+
+        if(charStatus != ConversionStatus::OK)
+        {
+            if(strictConversion)
+            {
+                i = sequenceStart;
+                status = charStatus;
+                errorOffset = sequenceStart;
+                break;
+            }
+            if(errorOffset == NO_ERROR_OFFSET)
+            {
+                errorOffset = sequenceStart;
+            }
+        }
+        count += sequenceLength;
+    }
+
+    ConversionResult objResult = { status, i, count, errorOffset };
+
+    return objResult;
+}
+
+/**
+ * Converts an UTF-16 code units buffer to an UTF-8 code units buffer, without allocations.<br />
+ * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String			the UTF-16 code units to be converted
+ * @param	utf16Length			the number of UTF-16 code units
+ * @param	utf8String			receives the UTF-8 code units
+ * @param	utf8Room			the room for UTF-8 code units
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+ *                              sequence, if 'false' replaces invalid character width the replacement character
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertUtf16_to_Utf8(const char16_t* utf16String, const size_t utf16Length,
+                                                        char* utf8String, const size_t utf8Room, const bool strictConversion)
+{
+    ConversionStatus status = ConversionStatus::OK;
+    size_t errorOffset = NO_ERROR_OFFSET;
+    size_t count = 0;
+    size_t i = 0;
+    size_t blockEnd = 0;
+
+    while(i < utf16Length)
+    {
+        if(i >= blockEnd)
+        {
+            // Narrow the 7-bit ASCII blocks and split the 2 bytes blocks that fit the room left
+            size_t units = convertUtf16AsciiBlocks_to_Utf8(utf16String + i, min(utf16Length - i, utf8Room - count), utf8String + count);
+            i += units;
+            count += units;
+            units = convertUtf16TwoBytesBlocks_to_Utf8(utf16String + i, min(utf16Length - i, (utf8Room - count) / 2), utf8String + count);
+            i += units;
+            count += 2 * units;
+            blockEnd = i + ASCII_BLOCK_SIZE;
+            if(i >= utf16Length)
+            {
+                break;
+            }
+        }
+
+        size_t sequenceStart = i;
+        char32_t codePoint = 0;
+        ConversionStatus charStatus = tryDecodeUtf16Char(utf16String, utf16Length, i, codePoint);
+        ConversionStatus encodeStatus = ConversionStatus::OK;
+        size_t sequenceLength = 0;
+        if(utf8Room - count >= 4)
+        {
+            // Encode straight into the output
+            encodeStatus = tryEncodeUtf8Char(codePoint, utf8String + count, sequenceLength);
+        }
+        else
+        {
+            // Encode aside, as the sequence may not fit the room left
+            char sequence[4];
+            encodeStatus = tryEncodeUtf8Char(codePoint, sequence, sequenceLength);
+            if(count + sequenceLength > utf8Room)
+            {
+                i = sequenceStart;
+                status = ConversionStatus::OUTPUT_TOO_SMALL;
+                break;
+            }
+            for(size_t j = 0; j < sequenceLength; ++j)
+            {
+                utf8String[count + j] = sequence[j];
+            }
+        }
+        if(charStatus == ConversionStatus::OK)
+        {
+            charStatus = encodeStatus;
+        }
+
+        if(charStatus != ConversionStatus::OK)
+        {
+            if(strictConversion)
+            {
+                i = sequenceStart;
+                status = charStatus;
+                errorOffset = sequenceStart;
+                break;
+            }
+            if(errorOffset == NO_ERROR_OFFSET)
+            {
+                errorOffset = sequenceStart;
+            }
+        }
+        count += sequenceLength;
+    }
+
+    ConversionResult objResult = { status, i, count, errorOffset };
+
+    return objResult;
+}
+
+/**
+ * Converts an UTF-8 code units buffer to an UTF-32 code points buffer, without allocations.<br />
+ * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String			the UTF-8 code units to be converted
+ * @param	utf8Length			the number of UTF-8 code units
+ * @param	utf32String			receives the UTF-32 code points
+ * @param	utf32Room			the room for UTF-32 code points
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+ *                              sequence, if 'false' replaces invalid character width the replacement character
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertUtf8_to_Utf32(const char* utf8String, const size_t utf8Length,
+                                                        char32_t* utf32String, const size_t utf32Room, const bool strictConversion)
+{
+    ConversionStatus status = ConversionStatus::OK;
+    size_t errorOffset = NO_ERROR_OFFSET;
+    size_t count = 0;
+    size_t i = 0;
+    size_t blockEnd = 0;
+
+    while(i < utf8Length)
+    {
+        if(i >= blockEnd)
+        {
+            // Decode the blocks of 1, 2 and 3 bytes sequences that fit the room left
+            size_t blockCodePoints = 0;
+            i += convertUtf8Blocks_to_Utf32(utf8String + i, min(utf8Length - i, utf32Room - count), utf32String + count, blockCodePoints);
+            count += blockCodePoints;
+            blockEnd = i + UTF8_BLOCK_SIZE;
+            if(i >= utf8Length)
+            {
+                break;
+            }
+        }
+
+        if(count >= utf32Room)
+        {
+            status = ConversionStatus::OUTPUT_TOO_SMALL;
+            break;
+        }
+
+        size_t sequenceStart = i;
+        ConversionStatus charStatus = tryDecodeUtf8Char(utf8String, utf8Length, i, utf32String[count]);
+        if(charStatus != ConversionStatus::OK)
+        {
+            if(strictConversion)
+            {
+                i = sequenceStart;
+                status = charStatus;
+                errorOffset = sequenceStart;
+                break;
+            }
+            if(errorOffset == NO_ERROR_OFFSET)
+            {
+                errorOffset = sequenceStart;
+            }
+        }
+        ++count;
+    }
+
+    ConversionResult objResult = { status, i, count, errorOffset };
+
+    return objResult;
+}
+
+/**
+ * Converts an UTF-32 code points buffer to an UTF-8 code units buffer, without allocations.<br />
+ * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String			the UTF-32 code points to be converted
+ * @param	utf32Length			the number of UTF-32 code points
+ * @param	utf8String			receives the UTF-8 code units
+ * @param	utf8Room			the room for UTF-8 code units
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+ *                              code point, if 'false' replaces invalid character width the replacement character
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertUtf32_to_Utf8(const char32_t* utf32String, const size_t utf32Length,
+                                                        char* utf8String, const size_t utf8Room, const bool strictConversion)
+{
+    ConversionStatus status = ConversionStatus::OK;
+    size_t errorOffset = NO_ERROR_OFFSET;
+    size_t count = 0;
+    size_t i = 0;
+    size_t blockEnd = 0;
+
+    while(i < utf32Length)
+    {
+        if(i >= blockEnd)
+        {
+            // Encode the blocks of valid code points that fit the room left
+            size_t blockCodeUnits = 0;
+            i += convertUtf32Blocks_to_Utf8(utf32String + i, utf32Length - i, utf8String + count, utf8Room - count, blockCodeUnits);
+            count += blockCodeUnits;
+            blockEnd = i + UTF32_BLOCK_SIZE;
+            if(i >= utf32Length)
+            {
+                break;
+            }
+        }
+
+        ConversionStatus charStatus = ConversionStatus::OK;
+        size_t sequenceLength = 0;
+        if(utf8Room - count >= 4)
+        {
+            // Encode straight into the output
+            charStatus = tryEncodeUtf8Char(utf32String[i], utf8String + count, sequenceLength);
+        }
+        else
+        {
+            // Encode aside, as the sequence may not fit the room left
+            char sequence[4];
+            charStatus = tryEncodeUtf8Char(utf32String[i], sequence, sequenceLength);
+            if(count + sequenceLength > utf8Room)
+            {
+                status = ConversionStatus::OUTPUT_TOO_SMALL;
+                break;
+            }
+            for(size_t j = 0; j < sequenceLength; ++j)
+            {
+                utf8String[count + j] = sequence[j];
+            }
+        }
+
+        if(charStatus != ConversionStatus::OK)
+        {
+            if(strictConversion)
+            {
+                status = charStatus;
+                errorOffset = i;
+                break;
+            }
+            if(errorOffset == NO_ERROR_OFFSET)
+            {
+                errorOffset = i;
+            }
+        }
+        count += sequenceLength;
+        ++i;
+    }
+
+    ConversionResult objResult = { status, i, count, errorOffset };
+
+    return objResult;
+}
+
+/**
+ * Converts an UTF-16 code units buffer to an UTF-32 code points buffer, without allocations.<br />
+ * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String			the UTF-16 code units to be converted
+ * @param	utf16Length			the number of UTF-16 code units
+ * @param	utf32String			receives the UTF-32 code points
+ * @param	utf32Room			the room for UTF-32 code points
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+ *                              code unit, if 'false' replaces invalid character width the replacement character
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertUtf16_to_Utf32(const char16_t* utf16String, const size_t utf16Length,
+                                                         char32_t* utf32String, const size_t utf32Room, const bool strictConversion)
+{
+    ConversionStatus status = ConversionStatus::OK;
+    size_t errorOffset = NO_ERROR_OFFSET;
+    size_t count = 0;
+    size_t i = 0;
+    size_t blockEnd = 0;
+
+    while(i < utf16Length)
+    {
+        if(i >= blockEnd)
+        {
+            // Widen the BMP characters that fit the room left
+            size_t units = convertUtf16Blocks_to_Utf32(utf16String + i, min(utf16Length - i, utf32Room - count), utf32String + count);
+            i += units;
+            count += units;
+            blockEnd = i + UTF16_BLOCK_SIZE;
+            if(i >= utf16Length)
+            {
+                break;
+            }
+        }
+
+        if(count >= utf32Room)
+        {
+            status = ConversionStatus::OUTPUT_TOO_SMALL;
+            break;
+        }
+
+        size_t sequenceStart = i;
+        ConversionStatus charStatus = tryDecodeUtf16Char(utf16String, utf16Length, i, utf32String[count]);
+        if(charStatus != ConversionStatus::OK)
+        {
+            if(strictConversion)
+            {
+                i = sequenceStart;
+                status = charStatus;
+                errorOffset = sequenceStart;
+                break;
+            }
+            if(errorOffset == NO_ERROR_OFFSET)
+            {
+                errorOffset = sequenceStart;
+            }
+        }
+        ++count;
+    }
+
+    ConversionResult objResult = { status, i, count, errorOffset };
+
+    return objResult;
+}
+
+/**
+ * Converts an UTF-32 code points buffer to an UTF-16 code units buffer, without allocations.<br />
+ * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String			the UTF-32 code points to be converted
+ * @param	utf32Length			the number of UTF-32 code points
+ * @param	utf16String			receives the UTF-16 code units
+ * @param	utf16Room			the room for UTF-16 code units
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+ *                              code point, if 'false' replaces invalid character width the replacement character
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertUtf32_to_Utf16(const char32_t* utf32String, const size_t utf32Length,
+                                                         char16_t* utf16String, const size_t utf16Room, const bool strictConversion)
+{
+    ConversionStatus status = ConversionStatus::OK;
+    size_t errorOffset = NO_ERROR_OFFSET;
+    size_t count = 0;
+    size_t i = 0;
+    size_t blockEnd = 0;
+
+    while(i < utf32Length)
+    {
+        if(i >= blockEnd)
+        {
+            // Narrow the BMP characters that fit the room left
+            size_t codePoints = convertUtf32Blocks_to_Utf16(utf32String + i, min(utf32Length - i, utf16Room - count), utf16String + count);
+            i += codePoints;
+            count += codePoints;
+            blockEnd = i + UTF16_BLOCK_SIZE;
+            if(i >= utf32Length)
+            {
+                break;
+            }
+        }
+
+        ConversionStatus charStatus = ConversionStatus::OK;
+        size_t sequenceLength = 0;
+        if(utf16Room - count >= 2)
+        {
+            // Encode straight into the output
+            charStatus = tryEncodeUtf16Char(utf32String[i], utf16String + count, sequenceLength);
+        }
+        else
+        {
+            // Encode aside, as the sequence may not fit the room left
+            char16_t sequence[2];
+            charStatus = tryEncodeUtf16Char(utf32String[i], sequence, sequenceLength);
+            if(count + sequenceLength > utf16Room)
+            {
+                status = ConversionStatus::OUTPUT_TOO_SMALL;
+                break;
+            }
+            for(size_t j = 0; j < sequenceLength; ++j)
+            {
+                utf16String[count + j] = sequence[j];
+            }
+        }
+
+        if(charStatus != ConversionStatus::OK)
+        {
+            if(strictConversion)
+            {
+                status = charStatus;
+                errorOffset = i;
+                break;
+            }
+            if(errorOffset == NO_ERROR_OFFSET)
+            {
+                errorOffset = i;
+            }
+        }
+        count += sequenceLength;
+        ++i;
+    }
+
+    ConversionResult objResult = { status, i, count, errorOffset };
+
+    return objResult;
+}
+
+/**
+ * Converts a 8-bit extended ASCII characters buffer from a given code page to an UTF-32 code points buffer,
+ * without allocations.<br />
+ * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString		the ASCII characters to be converted
+ * @param	narrowLength		the number of ASCII characters
+ * @param	utf32String			receives the UTF-32 code points
+ * @param	utf32Room			the room for UTF-32 code points
+ * @param	codePage			the code page from CodePage enumeration that the ASCII characters belong to
+ * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+ *                              also converts ASCII control codes [0; 31, 127] to Unicode
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertAscii_to_Utf32(const char* narrowString, const size_t narrowLength,
+                                                         char32_t* utf32String, const size_t utf32Room,
+                                                         const CodePage codePage, const bool convertAsciiControl)
+{
+    // Resolve the code page once, so each character is a single table load
+    const CodePageTables& objTables = getCodePageTables();
+    size_t tableIndex = getCodePageTableIndex(codePage);
+    size_t variant = convertAsciiControl ? 1 : 0;
+    const char32_t* pTable = objTables.m_arrTables[tableIndex][variant];
+    bool asciiIdentity = objTables.m_arrAsciiIdentity[tableIndex][variant];
+
+    // Every character of an 8-bit code page is a single UTF-32 code point
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+    size_t length = narrowLength;
+    if(utf32Room < narrowLength)
+    {
+        length = utf32Room;
+        objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+    }
+
+    size_t i = 0;
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    if(isCodePageGatherDecoded(codePage))
+    {
+        // Mostly extended ASCII text, gather all the blocks from the table
+        i = convertTableBlocks_to_Utf32(narrowString, length, pTable, utf32String);
+        asciiIdentity = false;
+    }
+#endif
+    while(i < length)
+    {
+        if(asciiIdentity)
+        {
+            // Zero-extend the 7-bit ASCII blocks
+            i += convertAsciiBlocks_to_Utf32(narrowString + i, length - i, utf32String + i);
+        }
+
+        // Decode the next block through the table
+        size_t blockEnd = min(i + ASCII_BLOCK_SIZE, length);
+        for(; i < blockEnd; ++i)
+        {
+            utf32String[i] = pTable[static_cast<unsigned char>(narrowString[i])];
+        }
+    }
+
+    objResult.consumed = length;
+    objResult.written = length;
+
+    return objResult;
+}
+
+/**
+ * Converts a 8-bit extended ASCII characters buffer from a given code page to an UTF-8 code units buffer,
+ * without allocations.<br />
+ * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString		the ASCII characters to be converted
+ * @param	narrowLength		the number of ASCII characters
+ * @param	utf8String			receives the UTF-8 code units
+ * @param	utf8Room			the room for UTF-8 code units
+ * @param	codePage			the code page from CodePage enumeration that the ASCII characters belong to
+ * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+ *                              also converts ASCII control codes [0; 31, 127] to Unicode
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertAscii_to_Utf8(const char* narrowString, const size_t narrowLength,
+                                                        char* utf8String, const size_t utf8Room,
+                                                        const CodePage codePage, const bool convertAsciiControl)
+{
+    // Resolve the code page once
+    const CodePageTables& objTables = getCodePageTables();
+    size_t tableIndex = getCodePageTableIndex(codePage);
+    size_t variant = convertAsciiControl ? 1 : 0;
+    const unsigned char (*pTable)[4] = objTables.m_arrUtf8Tables[tableIndex][variant];
+    bool asciiIdentity = objTables.m_arrAsciiIdentity[tableIndex][variant];
+
+    // The Latin-1 based code pages are expanded as Latin-1 blocks, unless the control codes are converted to their glyphs
+    bool latin1Based = isCodePageLatin1Based(codePage) && !convertAsciiControl;
+
+    // The EBCDIC code pages don't have 7-bit ASCII blocks, but their translation to Latin-1 has,
+    // unless the control codes are converted to their glyphs
+    const unsigned char* pAsciiTable = nullptr;
+    if(isCodePageEbcdic(codePage) && !convertAsciiControl)
+    {
+        pAsciiTable = getCodePageTranslationTables().m_arrTables[tableIndex][getCodePageTableIndex(CodePage::ISO_8859_1)];
+    }
+
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+    size_t count = 0;
+    size_t i = 0;
+    while(i < narrowLength)
+    {
+        if(latin1Based)
+        {
+            // Expand the blocks of Latin-1 characters that fit the room left
+            size_t blockCodeUnits = 0;
+            i += convertLatin1Blocks_to_Utf8(narrowString + i, narrowLength - i, utf8String + count, utf8Room - count,
+                                             objTables.m_arrLatin1Patches[tableIndex], blockCodeUnits);
+            count += blockCodeUnits;
+        }
+        else if(asciiIdentity)
+        {
+            // Copy the 7-bit ASCII blocks that fit the room left
+            size_t asciiBytes = getAsciiBlocksLength(narrowString + i, min(narrowLength - i, utf8Room - count));
+            memcpy(utf8String + count, narrowString + i, asciiBytes);
+            i += asciiBytes;
+            count += asciiBytes;
+        }
+        else if(pAsciiTable != nullptr)
+        {
+            // Translate the blocks of 7-bit ASCII characters that fit the room left
+            size_t asciiBytes = translateAsciiBlocks(narrowString + i, min(narrowLength - i, utf8Room - count), pAsciiTable, utf8String + count);
+            i += asciiBytes;
+            count += asciiBytes;
+        }
+
+        // Copy the UTF-8 sequences of the next block
+        size_t blockEnd = min(i + ASCII_BLOCK_SIZE, narrowLength);
+        for(; i < blockEnd; ++i)
+        {
+            const unsigned char* pSequence = pTable[static_cast<unsigned char>(narrowString[i])];
+            if(count + pSequence[3] > utf8Room)
+            {
+                objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+                objResult.consumed = i;
+                objResult.written = count;
+
+                return objResult;
+            }
+            for(size_t j = 0; j < pSequence[3]; ++j)
+            {
+                utf8String[count++] = static_cast<char>(pSequence[j]);
+            }
+        }
+    }
+
+    objResult.consumed = i;
+    objResult.written = count;
+
+    return objResult;
+}
+
+/**
+ * Converts a 8-bit extended ASCII characters buffer from a given code page to an UTF-16 code units buffer,
+ * without allocations.<br />
+ * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString		the ASCII characters to be converted
+ * @param	narrowLength		the number of ASCII characters
+ * @param	utf16String			receives the UTF-16 code units
+ * @param	utf16Room			the room for UTF-16 code units
+ * @param	codePage			the code page from CodePage enumeration that the ASCII characters belong to
+ * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+ *                              also converts ASCII control codes [0; 31, 127] to Unicode
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertAscii_to_Utf16(const char* narrowString, const size_t narrowLength,
+                                                         char16_t* utf16String, const size_t utf16Room,
+                                                         const CodePage codePage, const bool convertAsciiControl)
+{
+    // Resolve the code page once, so each character is a single table load
+    const CodePageTables& objTables = getCodePageTables();
+    size_t tableIndex = getCodePageTableIndex(codePage);
+    size_t variant = convertAsciiControl ? 1 : 0;
+    const char16_t* pTable = objTables.m_arrUtf16Tables[tableIndex][variant];
+    bool asciiIdentity = objTables.m_arrAsciiIdentity[tableIndex][variant];
+
+    // The Latin-1 based code pages are zero-extended as Latin-1 blocks, unless the control codes are converted to their glyphs
+    bool latin1Based = isCodePageLatin1Based(codePage) && !convertAsciiControl;
+
+    // Every character of an 8-bit code page is a single UTF-16 code unit
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+    size_t length = narrowLength;
+    if(utf16Room < narrowLength)
+    {
+        length = utf16Room;
+        objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+    }
+
+    size_t i = 0;
+    while(i < length)
+    {
+        if(latin1Based)
+        {
+            // Zero-extend the Latin-1 blocks
+            i += convertLatin1Blocks_to_Utf16(narrowString + i, length - i, utf16String + i, objTables.m_arrLatin1Patches[tableIndex]);
+        }
+        else if(asciiIdentity)
+        {
+            // Zero-extend the 7-bit ASCII blocks
+            i += convertAsciiBlocks_to_Utf16(narrowString + i, length - i, utf16String + i);
+        }
+
+        // Decode the next block through the table
+        size_t blockEnd = min(i + ASCII_BLOCK_SIZE, length);
+        for(; i < blockEnd; ++i)
+        {
+            utf16String[i] = pTable[static_cast<unsigned char>(narrowString[i])];
+        }
+    }
+
+    objResult.consumed = length;
+    objResult.written = length;
+
+    return objResult;
+}
+
+/**
+ * Converts an UTF-32 code points buffer to a 8-bit extended ASCII characters buffer of a given code page,
+ * without allocations.<br />
+ * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String			the UTF-32 code points to be converted
+ * @param	utf32Length			the number of UTF-32 code points
+ * @param	narrowString		receives the ASCII characters
+ * @param	narrowRoom			the room for ASCII characters
+ * @param	codePage			the code page from CodePage enumeration of the ASCII characters
+ * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+ *                              with the characters that can't be represented in the code page
+ * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+ *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertUtf32_to_Ascii(const char32_t* utf32String, const size_t utf32Length,
+                                                         char* narrowString, const size_t narrowRoom, const CodePage codePage,
+                                                         const UnmappableAction unmappableAction, const char replacementChar)
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+
+    switch(codePage)
+    {
+        case CodePage::UTF_8:
+            // Every Unicode scalar is mappable
+            return convertUtf32_to_Utf8(utf32String, utf32Length, narrowString, narrowRoom, unmappableAction == UnmappableAction::STRICT);
+
+        case CodePage::UTF_7:
+        case CodePage::UCS_2:
+        case CodePage::UCS_4:
+        case CodePage::UTF_16:
+        case CodePage::UTF_32:
+            // Not a supported narrow character encoding
+            objResult.status = ConversionStatus::UNSUPPORTED_CODE_PAGE;
+
+            return objResult;
+
+        default:
+            break;
+    }
+
+    // Resolve the code page once
+    const CodePageEncodingTables& objTables = getCodePageEncodingTables();
+    size_t tableIndex = getCodePageTableIndex(codePage);
+
+    size_t count = 0;
+    size_t i = 0;
+    char narrowChar = 0;
+    for(; i < utf32Length; ++i)
+    {
+        bool mapped = objTables.lookup(tableIndex, utf32String[i], narrowChar);
+        if(!mapped)
+        {
+            if(unmappableAction == UnmappableAction::STRICT)
+            {
+                objResult.status = ConversionStatus::UNMAPPABLE_CHARACTER;
+                objResult.errorOffset = i;
+                break;
+            }
+            narrowChar = replacementChar;
+        }
+
+        if(mapped || (unmappableAction == UnmappableAction::REPLACE))
+        {
+            if(count >= narrowRoom)
+            {
+                objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+                break;
+            }
+            narrowString[count++] = narrowChar;
+        }
+        // else UnmappableAction::SKIP
+
+        if(!mapped && (objResult.errorOffset == NO_ERROR_OFFSET))
+        {
+            objResult.errorOffset = i;
+        }
+    }
+
+    objResult.consumed = i;
+    objResult.written = count;
+
+    return objResult;
+}
+
+/**
+ * Converts an UTF-8 code units buffer directly to a 8-bit extended ASCII characters buffer of a given code page,
+ * without allocations.<br />
+ * ISO-8859-1 (Latin-1) and the code pages based on it (ISO-8859-15 and Windows-1252) are narrowed with
+ * SIMD instructions when available, with their own characters handled separately. The invalid UTF-8 sequences
+ * are unmappable characters, that stop the conversion with their own status when 'unmappableAction' is
+ * 'UnmappableAction::STRICT'. The conversion stops when the output buffer is full, and can be resumed from the
+ * consumed input.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String			the UTF-8 code units to be converted
+ * @param	utf8Length			the number of UTF-8 code units
+ * @param	narrowString		receives the ASCII characters
+ * @param	narrowRoom			the room for ASCII characters
+ * @param	codePage			the code page from CodePage enumeration of the ASCII characters
+ * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+ *                              with the characters that can't be represented in the code page
+ * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+ *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertUtf8_to_Ascii(const char* utf8String, const size_t utf8Length,
+                                                        char* narrowString, const size_t narrowRoom, const CodePage codePage,
+                                                        const UnmappableAction unmappableAction, const char replacementChar)
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+    if(isCodePageUnicode(codePage))
+    {
+        // Not an 8-bit code page
+        objResult.status = ConversionStatus::UNSUPPORTED_CODE_PAGE;
+
+        return objResult;
+    }
+
+    // Resolve the code page once
+    const CodePageTables& objTables = getCodePageTables();
+    const CodePageEncodingTables& objEncodingTables = getCodePageEncodingTables();
+    size_t tableIndex = getCodePageTableIndex(codePage);
+    bool latin1Based = isCodePageLatin1Based(codePage);
+    bool asciiIdentity = objTables.m_arrAsciiIdentity[tableIndex][0];
+
+    size_t count = 0;
+    size_t i = 0;
+    size_t blockEnd = 0;
+    while(i < utf8Length)
+    {
+        if(i >= blockEnd)
+        {
+            if(latin1Based)
+            {
+                // Narrow the blocks of Latin-1 characters that fit the room left
+                size_t blockChars = 0;
+                i += convertUtf8Blocks_to_Latin1(utf8String + i, utf8Length - i, narrowString + count, narrowRoom - count,
+                                                 objTables.m_arrLatin1Patches[tableIndex], blockChars);
+                count += blockChars;
+            }
+            else if(asciiIdentity)
+            {
+                // Copy the 7-bit ASCII blocks that fit the room left
+                size_t asciiBytes = getAsciiBlocksLength(utf8String + i, min(utf8Length - i, narrowRoom - count));
+                memcpy(narrowString + count, utf8String + i, asciiBytes);
+                i += asciiBytes;
+                count += asciiBytes;
+            }
+            blockEnd = i + UTF8_BLOCK_SIZE;
+            if(i >= utf8Length)
+            {
+                break;
+            }
+        }
+
+        size_t sequenceStart = i;
+        char32_t codePoint = 0;
+        ConversionStatus charStatus = tryDecodeUtf8Char(utf8String, utf8Length, i, codePoint);
+        if((charStatus != ConversionStatus::OK) && (unmappableAction == UnmappableAction::STRICT))
+        {
+            i = sequenceStart;
+            objResult.status = charStatus;
+            objResult.errorOffset = sequenceStart;
+            break;
+        }
+
+        char narrowChar = replacementChar;
+        bool mapped = (charStatus == ConversionStatus::OK) && objEncodingTables.lookup(tableIndex, codePoint, narrowChar);
+        if(!mapped && (unmappableAction == UnmappableAction::STRICT))
+        {
+            i = sequenceStart;
+            objResult.status = ConversionStatus::UNMAPPABLE_CHARACTER;
+            objResult.errorOffset = sequenceStart;
+            break;
+        }
+
+        if(mapped || (unmappableAction == UnmappableAction::REPLACE))
+        {
+            if(count >= narrowRoom)
+            {
+                i = sequenceStart;
+                objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+                break;
+            }
+            narrowString[count++] = narrowChar;
+        }
+        // else UnmappableAction::SKIP
+
+        if(!mapped && (objResult.errorOffset == NO_ERROR_OFFSET))
+        {
+            objResult.errorOffset = sequenceStart;
+        }
+    }
+
+    objResult.consumed = i;
+    objResult.written = count;
+
+    return objResult;
+}
+
+/**
+ * Converts an UTF-16 code units buffer directly to a 8-bit extended ASCII characters buffer of a given code page,
+ * without allocations.<br />
+ * ISO-8859-1 (Latin-1) and the code pages based on it (ISO-8859-15 and Windows-1252) are narrowed with
+ * SIMD instructions when available, with their own characters handled separately, and the other 8-bit code
+ * pages through their encoding tables. The unpaired surrogates are unmappable characters, that stop the
+ * conversion with their own status when 'unmappableAction' is 'UnmappableAction::STRICT'. The conversion
+ * stops when the output buffer is full, and can be resumed from the consumed input.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String			the UTF-16 code units to be converted
+ * @param	utf16Length			the number of UTF-16 code units
+ * @param	narrowString		receives the ASCII characters
+ * @param	narrowRoom			the room for ASCII characters
+ * @param	codePage			the code page from CodePage enumeration of the ASCII characters
+ * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+ *                              with the characters that can't be represented in the code page
+ * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+ *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertUtf16_to_Ascii(const char16_t* utf16String, const size_t utf16Length,
+                                                         char* narrowString, const size_t narrowRoom, const CodePage codePage,
+                                                         const UnmappableAction unmappableAction, const char replacementChar)
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+    if(isCodePageUnicode(codePage))
+    {
+        // Not an 8-bit code page
+        objResult.status = ConversionStatus::UNSUPPORTED_CODE_PAGE;
+
+        return objResult;
+    }
+
+    // Resolve the code page once
+    const CodePageTables& objTables = getCodePageTables();
+    const CodePageEncodingTables& objEncodingTables = getCodePageEncodingTables();
+    size_t tableIndex = getCodePageTableIndex(codePage);
+    bool latin1Based = isCodePageLatin1Based(codePage);
+    bool asciiIdentity = objTables.m_arrAsciiIdentity[tableIndex][0];
+
+    size_t count = 0;
+    size_t i = 0;
+    size_t blockEnd = 0;
+    while(i < utf16Length)
+    {
+        if(i >= blockEnd)
+        {
+            // Each code unit of the blocks gives one character
+            size_t blockUnits = 0;
+            if(latin1Based)
+            {
+                // Pack the blocks of Latin-1 characters that fit the room left
+                blockUnits = convertUtf16Blocks_to_Latin1(utf16String + i, min(utf16Length - i, narrowRoom - count), narrowString + count,
+                                                          objTables.m_arrLatin1Patches[tableIndex]);
+            }
+            else if(asciiIdentity)
+            {
+                // Pack the 7-bit ASCII blocks that fit the room left
+                blockUnits = convertUtf16AsciiBlocks_to_Utf8(utf16String + i, min(utf16Length - i, narrowRoom - count), narrowString + count);
+            }
+            i += blockUnits;
+            count += blockUnits;
+            blockEnd = i + UTF16_BLOCK_SIZE;
+            if(i >= utf16Length)
+            {
+                break;
+            }
+        }
+
+        size_t sequenceStart = i;
+        char32_t codePoint = 0;
+        ConversionStatus charStatus = tryDecodeUtf16Char(utf16String, utf16Length, i, codePoint);
+        if((charStatus != ConversionStatus::OK) && (unmappableAction == UnmappableAction::STRICT))
+        {
+            i = sequenceStart;
+            objResult.status = charStatus;
+            objResult.errorOffset = sequenceStart;
+            break;
+        }
+
+        char narrowChar = replacementChar;
+        bool mapped = (charStatus == ConversionStatus::OK) && objEncodingTables.lookup(tableIndex, codePoint, narrowChar);
+        if(!mapped && (unmappableAction == UnmappableAction::STRICT))
+        {
+            i = sequenceStart;
+            objResult.status = ConversionStatus::UNMAPPABLE_CHARACTER;
+            objResult.errorOffset = sequenceStart;
+            break;
+        }
+
+        if(mapped || (unmappableAction == UnmappableAction::REPLACE))
+        {
+            if(count >= narrowRoom)
+            {
+                i = sequenceStart;
+                objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+                break;
+            }
+            narrowString[count++] = narrowChar;
+        }
+        // else UnmappableAction::SKIP
+
+        if(!mapped && (objResult.errorOffset == NO_ERROR_OFFSET))
+        {
+            objResult.errorOffset = sequenceStart;
+        }
+    }
+
+    objResult.consumed = i;
+    objResult.written = count;
+
+    return objResult;
+}
+
+/**
+ * Checks if every character of a code page can be represented in another code page, so the translation
+ * between them never loses characters.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	fromCodePage	the code page from CodePage enumeration of the characters to be translated
+ * @param	toCodePage		the code page from CodePage enumeration of the translated characters
+ * @return	'true' if the translation is lossless, 'false' otherwise or if any of the code pages is a Unicode encoding
+ * @since	1.0
+ */
+bool CodePage2Unicode::isCodePageTranslationLossless(const CodePage fromCodePage, const CodePage toCodePage)
+{
+    if(isCodePageUnicode(fromCodePage) || isCodePageUnicode(toCodePage))
+    {
+        return false;
+    }
+
+    if(fromCodePage == toCodePage)
+    {
+        // Every character is kept as is, including the ones without a map
+        return true;
+    }
+
+    return getCodePageTranslationTables().m_arrLossless[getCodePageTableIndex(fromCodePage)][getCodePageTableIndex(toCodePage)];
+}
+
+/**
+ * Translates an 8-bit extended ASCII characters buffer of a given code page to the equivalent characters
+ * buffer of another code page, byte to byte, without allocations and without going through UTF-32.<br />
+ * The translation table of the two code pages is composed once, and applied with SIMD byte shuffles when
+ * available, also when the unmappable characters are replaced. The output buffer can be the input buffer
+ * itself. The 8-bit code pages without a map only represent the 7-bit ASCII characters, and the Unicode
+ * encodings aren't translated. A code page is translated to itself as an identity copy. The conversion
+ * stops when the output buffer is full, and can be resumed from the consumed input.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	sourceString		the ASCII characters to be translated
+ * @param	sourceLength		the number of ASCII characters
+ * @param	destinationString	receives the translated ASCII characters, can be the source buffer itself
+ * @param	destinationRoom		the room for translated ASCII characters
+ * @param	fromCodePage		the code page from CodePage enumeration of the characters to be translated
+ * @param	toCodePage			the code page from CodePage enumeration of the translated characters
+ * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+ *                              with the characters that can't be represented in the target code page
+ * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+ *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::translateCodePage(const char* sourceString, const size_t sourceLength,
+                                                     char* destinationString, const size_t destinationRoom,
+                                                     const CodePage fromCodePage, const CodePage toCodePage,
+                                                     const UnmappableAction unmappableAction, const char replacementChar)
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+    if(isCodePageUnicode(fromCodePage) || isCodePageUnicode(toCodePage))
+    {
+        // Not an 8-bit code page
+        objResult.status = ConversionStatus::UNSUPPORTED_CODE_PAGE;
+
+        return objResult;
+    }
+
+    if(fromCodePage == toCodePage)
+    {
+        // An identity copy, including the characters without a map
+        size_t length = sourceLength;
+        if(destinationRoom < sourceLength)
+        {
+            length = destinationRoom;
+            objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+        }
+
+        if((length > 0) && (destinationString != sourceString))
+        {
+            memmove(destinationString, sourceString, length);
+        }
+
+        objResult.consumed = length;
+        objResult.written = length;
+
+        return objResult;
+    }
+
+    // Resolve the code pages once
+    const CodePageTranslationTables& objTables = getCodePageTranslationTables();
+    size_t from = getCodePageTableIndex(fromCodePage);
+    size_t to = getCodePageTableIndex(toCodePage);
+    const unsigned char* pTable = objTables.m_arrTables[from][to];
+
+    if(objTables.m_arrLossless[from][to] || (unmappableAction == UnmappableAction::REPLACE))
+    {
+        // A plain byte to byte translation
+        size_t length = sourceLength;
+        if(destinationRoom < sourceLength)
+        {
+            length = destinationRoom;
+            objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+        }
+
+        if(objTables.m_arrLossless[from][to])
+        {
+            translateBytes(sourceString, length, pTable, destinationString);
+        }
+        else
+        {
+            // Patch a copy of the table, so the unmappable characters are translated to a marker that no other
+            // character is translated to, and the first one is found with a plain search of the output
+            bool arrTranslated[CODEPAGE_TABLE_SIZE];
+            memset(arrTranslated, 0, sizeof(arrTranslated));
+            for(size_t code = 0; code < CODEPAGE_TABLE_SIZE; ++code)
+            {
+                if(!objTables.isLossy(from, to, (unsigned char)code))
+                {
+                    arrTranslated[pTable[code]] = true;
+                }
+            }
+
+            // There's at least one unmappable character, so at least one byte value is free
+            unsigned char marker = static_cast<unsigned char>(replacementChar);
+            if(arrTranslated[marker])
+            {
+                marker = 0;
+                while(arrTranslated[marker])
+                {
+                    ++marker;
+                }
+            }
+
+            unsigned char arrTable[CODEPAGE_TABLE_SIZE];
+            for(size_t code = 0; code < CODEPAGE_TABLE_SIZE; ++code)
+            {
+                arrTable[code] = objTables.isLossy(from, to, (unsigned char)code) ? marker : pTable[code];
+            }
+            translateBytes(sourceString, length, arrTable, destinationString);
+
+            const char* pMarker = static_cast<const char*>(memchr(destinationString, marker, length));
+            if(pMarker != nullptr)
+            {
+                objResult.errorOffset = pMarker - destinationString;
+                if(marker != static_cast<unsigned char>(replacementChar))
+                {
+                    for(size_t i = objResult.errorOffset; i < length; ++i)
+                    {
+                        destinationString[i] = (destinationString[i] == (char)marker) ? replacementChar : destinationString[i];
+                    }
+                }
+            }
+        }
+
+        objResult.consumed = length;
+        objResult.written = length;
+
+        return objResult;
+    }
+
+    // The output never gets ahead of the input, so it can be the input buffer itself
+    size_t count = 0;
+    size_t i = 0;
+    for(; i < sourceLength; ++i)
+    {
+        unsigned char code = static_cast<unsigned char>(sourceString[i]);
+        if(!objTables.isLossy(from, to, code))
+        {
+            if(count >= destinationRoom)
+            {
+                objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+                break;
+            }
+            destinationString[count++] = static_cast<char>(pTable[code]);
+        }
+        else if(unmappableAction == UnmappableAction::STRICT)
+        {
+            objResult.status = ConversionStatus::UNMAPPABLE_CHARACTER;
+            objResult.errorOffset = i;
+            break;
+        }
+        else if(objResult.errorOffset == NO_ERROR_OFFSET)
+        {
+            // UnmappableAction::SKIP
+            objResult.errorOffset = i;
+        }
+    }
+
+    objResult.consumed = i;
+    objResult.written = count;
+
+    return objResult;
+}
+
+/**
+ * Translates an EBCDIC characters buffer to an ISO-8859-1 (Latin-1) characters buffer, byte to byte,
+ * without allocations.<br />
+ * It's the translation of 'translateCodePage' to 'CodePage::ISO_8859_1', with SIMD byte shuffles when available.
+ * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	ebcdicString		the EBCDIC characters to be translated
+ * @param	ebcdicLength		the number of EBCDIC characters
+ * @param	latin1String		receives the Latin-1 characters
+ * @param	latin1Room			the room for Latin-1 characters
+ * @param	codePage			the EBCDIC code page from CodePage enumeration of the EBCDIC characters
+ * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+ *                              with the characters that can't be represented in Latin-1
+ * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+ *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertEbcdic_to_Latin1(const char* ebcdicString, const size_t ebcdicLength,
+                                                           char* latin1String, const size_t latin1Room, const CodePage codePage,
+                                                           const UnmappableAction unmappableAction, const char replacementChar)
+{
+    if(!isCodePageEbcdic(codePage))
+    {
+        ConversionResult objResult = { ConversionStatus::UNSUPPORTED_CODE_PAGE, 0, 0, NO_ERROR_OFFSET };
+
+        return objResult;
+    }
+
+    return translateCodePage(ebcdicString, ebcdicLength, latin1String, latin1Room, codePage, CodePage::ISO_8859_1,
+                             unmappableAction, replacementChar);
+}
+
+/**
+ * Converts a characters buffer of a double-byte code page loaded by the 'CodePageRegistry' to an UTF-32
+ * code points buffer, skipping the 7-bit ASCII blocks with SIMD instructions when available.<br />
+ * The ASCII blocks are only skipped at a character boundary, where an ASCII byte can't be a trail byte.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString	the single-byte and double-byte characters to be converted
+ * @param	narrowLength	the number of bytes
+ * @param	utf32String		receives the UTF-32 code points
+ * @param	utf32Room		the room for UTF-32 code points
+ * @param	codePage		the handle of the double-byte code page
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertDoubleByte_to_Utf32(const char* narrowString, const size_t narrowLength,
+                                                              char32_t* utf32String, const size_t utf32Room,
+                                                              const CodePageHandle codePage)
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+
+    size_t count = 0;
+    size_t i = 0;
+    while(i < narrowLength)
+    {
+        if(codePage->asciiIdentity)
+        {
+            // Zero-extend the 7-bit ASCII blocks that fit the room left
+            size_t asciiLength = convertAsciiBlocks_to_Utf32(narrowString + i, min(narrowLength - i, utf32Room - count), utf32String + count);
+            i += asciiLength;
+            count += asciiLength;
+        }
+
+        // Decode the characters of the next block, the last one may end after it
+        size_t blockEnd = min(i + ASCII_BLOCK_SIZE, narrowLength);
+        while(i < blockEnd)
+        {
+            if(count >= utf32Room)
+            {
+                objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+                objResult.consumed = i;
+                objResult.written = count;
+
+                return objResult;
+            }
+
+            size_t codeLength = 0;
+            char16_t charUtf16 = codePage->decode(narrowString + i, narrowLength - i, codeLength);
+            if(codeLength == 0)
+            {
+                // The lead byte continues in the next buffer
+                objResult.status = ConversionStatus::INCOMPLETE_SEQUENCE;
+                if(objResult.errorOffset == NO_ERROR_OFFSET)
+                {
+                    objResult.errorOffset = i;
+                }
+                objResult.consumed = i;
+                objResult.written = count;
+
+                return objResult;
+            }
+            if((charUtf16 == UNICODE_REPLACEMENT_CHARACTER) && codePage->isLeadByte(static_cast<unsigned char>(narrowString[i])) &&
+               (objResult.errorOffset == NO_ERROR_OFFSET))
+            {
+                objResult.errorOffset = i;
+            }
+
+            utf32String[count++] = charUtf16;
+            i += codeLength;
+        }
+    }
+
+    objResult.consumed = i;
+    objResult.written = count;
+
+    return objResult;
+}
+
+/**
+ * Converts a characters buffer of a double-byte code page loaded by the 'CodePageRegistry' to an UTF-8
+ * code units buffer, copying the 7-bit ASCII blocks with SIMD instructions when available.<br />
+ * The ASCII blocks are only copied at a character boundary, where an ASCII byte can't be a trail byte.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString	the single-byte and double-byte characters to be converted
+ * @param	narrowLength	the number of bytes
+ * @param	utf8String		receives the UTF-8 code units
+ * @param	utf8Room		the room for UTF-8 code units
+ * @param	codePage		the handle of the double-byte code page
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertDoubleByte_to_Utf8(const char* narrowString, const size_t narrowLength,
+                                                             char* utf8String, const size_t utf8Room,
+                                                             const CodePageHandle codePage)
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+
+    size_t count = 0;
+    size_t i = 0;
+    while(i < narrowLength)
+    {
+        if(codePage->asciiIdentity)
+        {
+            // Copy the 7-bit ASCII blocks that fit the room left
+            size_t asciiBytes = getAsciiBlocksLength(narrowString + i, min(narrowLength - i, utf8Room - count));
+            memcpy(utf8String + count, narrowString + i, asciiBytes);
+            i += asciiBytes;
+            count += asciiBytes;
+        }
+
+        // Encode the characters of the next block, the last one may end after it
+        size_t blockEnd = min(i + ASCII_BLOCK_SIZE, narrowLength);
+        while(i < blockEnd)
+        {
+            size_t codeLength = 0;
+            char16_t charUtf16 = codePage->decode(narrowString + i, narrowLength - i, codeLength);
+            if(codeLength == 0)
+            {
+                // The lead byte continues in the next buffer
+                objResult.status = ConversionStatus::INCOMPLETE_SEQUENCE;
+                if(objResult.errorOffset == NO_ERROR_OFFSET)
+                {
+                    objResult.errorOffset = i;
+                }
+                objResult.consumed = i;
+                objResult.written = count;
+
+                return objResult;
+            }
+
+            // All the characters are in the BMP, so 1 to 3 bytes long
+            size_t sequenceLength = (charUtf16 < 0x80) ? 1 : ((charUtf16 < 0x800) ? 2 : 3);
+            if(count + sequenceLength > utf8Room)
+            {
+                objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+                objResult.consumed = i;
+                objResult.written = count;
+
+                return objResult;
+            }
+            if((charUtf16 == UNICODE_REPLACEMENT_CHARACTER) && codePage->isLeadByte(static_cast<unsigned char>(narrowString[i])) &&
+               (objResult.errorOffset == NO_ERROR_OFFSET))
+            {
+                objResult.errorOffset = i;
+            }
+
+            if(sequenceLength == 1)
+            {
+                utf8String[count++] = static_cast<char>(charUtf16);
+            }
+            else if(sequenceLength == 2)
+            {
+                utf8String[count++] = static_cast<char>(UTF8_LEAD_BYTES2 | (charUtf16 >> UTF8_HALF_SHIFT));
+                utf8String[count++] = static_cast<char>(UTF8_NEXT | (charUtf16 & UTF8_NEXT_MASK));
+            }
+            else
+            {
+                utf8String[count++] = static_cast<char>(UTF8_LEAD_BYTES3 | (charUtf16 >> (2 * UTF8_HALF_SHIFT)));
+                utf8String[count++] = static_cast<char>(UTF8_NEXT | ((charUtf16 >> UTF8_HALF_SHIFT) & UTF8_NEXT_MASK));
+                utf8String[count++] = static_cast<char>(UTF8_NEXT | (charUtf16 & UTF8_NEXT_MASK));
+            }
+            i += codeLength;
+        }
+    }
+
+    objResult.consumed = i;
+    objResult.written = count;
+
+    return objResult;
+}
+
+/**
+ * Converts a characters buffer of a double-byte code page loaded by the 'CodePageRegistry' to an UTF-16
+ * code units buffer, skipping the 7-bit ASCII blocks with SIMD instructions when available.<br />
+ * The ASCII blocks are only skipped at a character boundary, where an ASCII byte can't be a trail byte.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString	the single-byte and double-byte characters to be converted
+ * @param	narrowLength	the number of bytes
+ * @param	utf16String		receives the UTF-16 code units
+ * @param	utf16Room		the room for UTF-16 code units
+ * @param	codePage		the handle of the double-byte code page
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertDoubleByte_to_Utf16(const char* narrowString, const size_t narrowLength,
+                                                              char16_t* utf16String, const size_t utf16Room,
+                                                              const CodePageHandle codePage)
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+
+    size_t count = 0;
+    size_t i = 0;
+    while(i < narrowLength)
+    {
+        if(codePage->asciiIdentity)
+        {
+            // Zero-extend the 7-bit ASCII blocks that fit the room left
+            size_t asciiLength = convertAsciiBlocks_to_Utf16(narrowString + i, min(narrowLength - i, utf16Room - count), utf16String + count);
+            i += asciiLength;
+            count += asciiLength;
+        }
+
+        // Decode the characters of the next block, the last one may end after it
+        size_t blockEnd = min(i + ASCII_BLOCK_SIZE, narrowLength);
+        while(i < blockEnd)
+        {
+            if(count >= utf16Room)
+            {
+                objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+                objResult.consumed = i;
+                objResult.written = count;
+
+                return objResult;
+            }
+
+            size_t codeLength = 0;
+            char16_t charUtf16 = codePage->decode(narrowString + i, narrowLength - i, codeLength);
+            if(codeLength == 0)
+            {
+                // The lead byte continues in the next buffer
+                objResult.status = ConversionStatus::INCOMPLETE_SEQUENCE;
+                if(objResult.errorOffset == NO_ERROR_OFFSET)
+                {
+                    objResult.errorOffset = i;
+                }
+                objResult.consumed = i;
+                objResult.written = count;
+
+                return objResult;
+            }
+            if((charUtf16 == UNICODE_REPLACEMENT_CHARACTER) && codePage->isLeadByte(static_cast<unsigned char>(narrowString[i])) &&
+               (objResult.errorOffset == NO_ERROR_OFFSET))
+            {
+                objResult.errorOffset = i;
+            }
+
+            utf16String[count++] = charUtf16;
+            i += codeLength;
+        }
+    }
+
+    objResult.consumed = i;
+    objResult.written = count;
+
+    return objResult;
+}
+
+/**
+ * Converts an 8-bit extended ASCII character from a code page loaded by the 'CodePageRegistry' to the
+ * equivalent UTF-32 code point.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowChar	the ASCII character [0; 255] to be converted
+ * @param	codePage	the handle of the code page that the narrow character belongs to
+ * @return	the equivalent UTF-32 code point, or the replacement character if the handle is 'nullptr'
+ * @since	1.0
+ */
+char32_t CodePage2Unicode::convertCharAscii_to_CharUtf32(const char narrowChar, const CodePageHandle codePage)
+{
+    if(codePage == nullptr)
+    {
+        return (char32_t)UNICODE_REPLACEMENT_CHARACTER;
+    }
+
+    return codePage->utf32Table[static_cast<unsigned char>(narrowChar)];
+}
+
+/**
+ * Converts an UTF-32 code point to the equivalent 8-bit extended ASCII character of a code page loaded by
+ * the 'CodePageRegistry'.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	charUtf32	the UTF-32 code point to be converted
+ * @param	codePage	the handle of the code page of the ASCII character
+ * @param	narrowChar	receives the equivalent ASCII character, if the code point is mappable
+ * @return	'true' if the code point can be represented in the code page, 'false' otherwise
+ * @since	1.0
+ */
+bool CodePage2Unicode::convertCharUtf32_to_CharAscii(const char32_t charUtf32, const CodePageHandle codePage, char& narrowChar)
+{
+    // The double-byte characters don't fit a single character
+    unsigned int code = 0;
+    if((codePage == nullptr) || !codePage->lookup(charUtf32, code) || (code > 0xFF))
+    {
+        return false;
+    }
+    narrowChar = static_cast<char>(code);
+
+    return true;
+}
+
+/**
+ * Converts a 8-bit extended ASCII characters buffer from a code page loaded by the 'CodePageRegistry'
+ * to an UTF-32 code points buffer, without allocations.<br />
+ * The conversion stops when the output buffer is full, and can be resumed from the consumed input.<br />
+ * A lead byte of a double-byte code page that ends the buffer stops the conversion with
+ * 'ConversionStatus::INCOMPLETE_SEQUENCE', so it can be resumed with the next buffer.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString	the ASCII characters to be converted
+ * @param	narrowLength	the number of ASCII characters
+ * @param	utf32String		receives the UTF-32 code points
+ * @param	utf32Room		the room for UTF-32 code points
+ * @param	codePage		the handle of the code page that the ASCII characters belong to
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertAscii_to_Utf32(const char* narrowString, const size_t narrowLength,
+                                                         char32_t* utf32String, const size_t utf32Room,
+                                                         const CodePageHandle codePage)
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+    if(codePage == nullptr)
+    {
+        objResult.status = ConversionStatus::UNSUPPORTED_CODE_PAGE;
+
+        return objResult;
+    }
+    if(codePage->doubleByte)
+    {
+        return convertDoubleByte_to_Utf32(narrowString, narrowLength, utf32String, utf32Room, codePage);
+    }
+
+    // Every character of an 8-bit code page is a single UTF-32 code point
+    const char32_t* pTable = codePage->utf32Table;
+    size_t length = narrowLength;
+    if(utf32Room < narrowLength)
+    {
+        length = utf32Room;
+        objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+    }
+
+    size_t i = 0;
+    while(i < length)
+    {
+        if(codePage->asciiIdentity)
+        {
+            // Zero-extend the 7-bit ASCII blocks
+            i += convertAsciiBlocks_to_Utf32(narrowString + i, length - i, utf32String + i);
+        }
+
+        // Decode the next block through the mapped table
+        size_t blockEnd = min(i + ASCII_BLOCK_SIZE, length);
+        for(; i < blockEnd; ++i)
+        {
+            utf32String[i] = pTable[static_cast<unsigned char>(narrowString[i])];
+        }
+    }
+
+    objResult.consumed = length;
+    objResult.written = length;
+
+    return objResult;
+}
+
+/**
+ * Converts a 8-bit extended ASCII characters buffer from a code page loaded by the 'CodePageRegistry'
+ * to an UTF-8 code units buffer, without allocations.<br />
+ * The conversion stops when the output buffer is full, and can be resumed from the consumed input.<br />
+ * A lead byte of a double-byte code page that ends the buffer stops the conversion with
+ * 'ConversionStatus::INCOMPLETE_SEQUENCE', so it can be resumed with the next buffer.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString	the ASCII characters to be converted
+ * @param	narrowLength	the number of ASCII characters
+ * @param	utf8String		receives the UTF-8 code units
+ * @param	utf8Room		the room for UTF-8 code units
+ * @param	codePage		the handle of the code page that the ASCII characters belong to
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertAscii_to_Utf8(const char* narrowString, const size_t narrowLength,
+                                                        char* utf8String, const size_t utf8Room,
+                                                        const CodePageHandle codePage)
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+    if(codePage == nullptr)
+    {
+        objResult.status = ConversionStatus::UNSUPPORTED_CODE_PAGE;
+
+        return objResult;
+    }
+    if(codePage->doubleByte)
+    {
+        return convertDoubleByte_to_Utf8(narrowString, narrowLength, utf8String, utf8Room, codePage);
+    }
+
+    const unsigned char (*pTable)[4] = codePage->utf8Table;
+    size_t count = 0;
+    size_t i = 0;
+    while(i < narrowLength)
+    {
+        if(codePage->asciiIdentity)
+        {
+            // Copy the 7-bit ASCII blocks that fit the room left
+            size_t asciiBytes = getAsciiBlocksLength(narrowString + i, min(narrowLength - i, utf8Room - count));
+            memcpy(utf8String + count, narrowString + i, asciiBytes);
+            i += asciiBytes;
+            count += asciiBytes;
+        }
+
+        // Copy the UTF-8 sequences of the next block
+        size_t blockEnd = min(i + ASCII_BLOCK_SIZE, narrowLength);
+        for(; i < blockEnd; ++i)
+        {
+            const unsigned char* pSequence = pTable[static_cast<unsigned char>(narrowString[i])];
+            if(count + pSequence[3] > utf8Room)
+            {
+                objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+                objResult.consumed = i;
+                objResult.written = count;
+
+                return objResult;
+            }
+            for(size_t j = 0; j < pSequence[3]; ++j)
+            {
+                utf8String[count++] = static_cast<char>(pSequence[j]);
+            }
+        }
+    }
+
+    objResult.consumed = i;
+    objResult.written = count;
+
+    return objResult;
+}
+
+/**
+ * Converts a 8-bit extended ASCII characters buffer from a code page loaded by the 'CodePageRegistry'
+ * to an UTF-16 code units buffer, without allocations.<br />
+ * The conversion stops when the output buffer is full, and can be resumed from the consumed input.<br />
+ * A lead byte of a double-byte code page that ends the buffer stops the conversion with
+ * 'ConversionStatus::INCOMPLETE_SEQUENCE', so it can be resumed with the next buffer.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	narrowString	the ASCII characters to be converted
+ * @param	narrowLength	the number of ASCII characters
+ * @param	utf16String		receives the UTF-16 code units
+ * @param	utf16Room		the room for UTF-16 code units
+ * @param	codePage		the handle of the code page that the ASCII characters belong to
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult CodePage2Unicode::convertAscii_to_Utf16(const char* narrowString, const size_t narrowLength,
+                                                         char16_t* utf16String, const size_t utf16Room,
+                                                         const CodePageHandle codePage)
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+    if(codePage == nullptr)
+    {
+        objResult.status = ConversionStatus::UNSUPPORTED_CODE_PAGE;
+
+        return objResult;
+    }
+    if(codePage->doubleByte)
+    {
+        return convertDoubleByte_to_Utf16(narrowString, narrowLength, utf16String, utf16Room, codePage);
+    }
+
+    // The registry only maps characters to the BMP, so each one is a single UTF-16 code unit
+    const char16_t* pTable = codePage->utf16Table;
+    size_t length = narrowLength;
+    if(utf16Room < narrowLength)
+    {
+        length = utf16Room;
+        objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+    }
+
+    size_t i = 0;
+    while(i < length)
+    {
+        if(codePage->asciiIdentity)
+        {
+            // Zero-extend the 7-bit ASCII blocks
+            i += convertAsciiBlocks_to_Utf16(narrowString + i, length - i, utf16String + i);
+        }
+
+        // Decode the next block through the mapped table
+        size_t blockEnd = min(i + ASCII_BLOCK_SIZE, length);
+        for(; i < blockEnd; ++i)
+        {
+            utf16String[i] = pTable[static_cast<unsigned char>(narrowString[i])];
+        }
     }
 
-    return narrowString;
+    objResult.consumed = length;
+    objResult.written = length;
+
+    return objResult;
 }
 
 /**
- * Converts an UTF-16 encoded string to the equivalent UTF-32 encoded string.
+ * Converts an UTF-32 code points buffer to a 8-bit extended ASCII characters buffer of a code page loaded
+ * by the 'CodePageRegistry', without allocations.<br />
+ * The conversion stops when the output buffer is full, and can be resumed from the consumed input.<br />
+ * The double-byte characters are written as the lead byte followed by the trail byte.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	utf16String			the UTF-16 encoded string to be converted
- * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
- *                              invalid conversion, if 'false' replaces invalid character width the replacement character
- * @return	the equivalent UTF-32 encoded string
+ * @param	utf32String			the UTF-32 code points to be converted
+ * @param	utf32Length			the number of UTF-32 code points
+ * @param	narrowString		receives the ASCII characters
+ * @param	narrowRoom			the room for ASCII characters
+ * @param	codePage			the handle of the code page of the ASCII characters
+ * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+ *                              with the characters that can't be represented in the code page
+ * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+ *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+ * @return	the conversion status and the number of code units consumed and written
  * @since	1.0
  */
-u32string CodePage2Unicode::convertStringUtf16_to_StringUtf32(const u16string& utf16String, const bool strictConversion)
+ConversionResult CodePage2Unicode::convertUtf32_to_Ascii(const char32_t* utf32String, const size_t utf32Length,
+                                                         char* narrowString, const size_t narrowRoom, const CodePageHandle codePage,
+                                                         const UnmappableAction unmappableAction, const char replacementChar)
 {
-    u32string strRet;
-    char16_t charUtf16_1;
-    char16_t charUtf16_2;
-    char32_t codeUnits[2] = {
-        0, 0
-    };
-    for(unsigned i = 0; i < utf16String.length(); i++)
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+    if(codePage == nullptr)
     {
-        charUtf16_1 = utf16String.at(i);
-        if(isUtf16HighSurrogate(charUtf16_1))
+        objResult.status = ConversionStatus::UNSUPPORTED_CODE_PAGE;
+
+        return objResult;
+    }
+
+    size_t count = 0;
+    size_t i = 0;
+    unsigned int code = 0;
+    for(; i < utf32Length; ++i)
+    {
+        bool mapped = codePage->lookup(utf32String[i], code);
+        if(!mapped)
         {
-            // If we have a surrogate pair, convert to UTF-32 first
-            ++i;
-            if(i < utf16String.length())
-            {
-                // Read surrogate low
-                charUtf16_2 = utf16String.at(i);
-                if(isUtf16LowSurrogate(charUtf16_2))
-                {
-                    codeUnits[0] = static_cast<char32_t>(((charUtf16_1 - UNICODE_HIGH_SURROGATE_START) << UTF16_HALF_SHIFT) +
-                                                         (charUtf16_2 - UNICODE_LOW_SURROGATE_START) + UTF16_HALF_BASE);
-                }
-                else
-                {
-                    if(strictConversion)
-                    {
-                        throw logic_error("Invalid UTF-16 low surrogate pair");
-                        break;
-                    }
-                    else
-                    {
-                        // Ignore
-                        --i;
-                    }
-                }
-            }
-            else
+            if(unmappableAction == UnmappableAction::STRICT)
             {
-                if(strictConversion)
-                {
-                    throw logic_error("Invalid UTF-16 unpaired high surrogate pair");
-                    break;
-                }
-                else
-                {
-                    // Ignore
-                    --i;
-                }
+                objResult.status = ConversionStatus::UNMAPPABLE_CHARACTER;
+                objResult.errorOffset = i;
+                break;
             }
+            code = static_cast<unsigned char>(replacementChar);
         }
-        else if(isUtf16LowSurrogate(charUtf16_1))
+
+        if(mapped || (unmappableAction == UnmappableAction::REPLACE))
         {
-            if(strictConversion)
+            // A double-byte character is written whole or not at all
+            size_t codeLength = (code > 0xFF) ? 2 : 1;
+            if(count + codeLength > narrowRoom)
             {
-                throw logic_error("Invalid UTF-16 unpaired low surrogate pair");
+                objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
                 break;
             }
-            else
+            if(codeLength == 2)
             {
-                codeUnits[0] = static_cast<char32_t>(UNICODE_REPLACEMENT_CHARACTER);
-                strRet.append(codeUnits);
+                narrowString[count++] = static_cast<char>(code >> 8);
             }
+            narrowString[count++] = static_cast<char>(code);
         }
-        else
+        // else UnmappableAction::SKIP
+
+        if(!mapped && (objResult.errorOffset == NO_ERROR_OFFSET))
         {
-            // OK, code point in BMP
-            codeUnits[0] = static_cast<char32_t>(charUtf16_1);
+            objResult.errorOffset = i;
         }
+    }
 
-        // Check if UTF-32 code point is valid
-        if(!isUnicodeInterchangeCharacter(codeUnits[0]) && !isUtf16Surrogate((char16_t)codeUnits[0]))
+    objResult.consumed = i;
+    objResult.written = count;
+
+    return objResult;
+}
+
+/**
+ * Gets the number of UTF-16 code units needed to convert an UTF-8 code units buffer, counting the
+ * invalid sequences as the replacement character. The valid leading part is measured by counting its
+ * code units, the rest is measured one sequence at a time.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String	the UTF-8 code units
+ * @param	utf8Length	the number of UTF-8 code units
+ * @return	the number of UTF-16 code units
+ * @since	1.0
+ */
+size_t CodePage2Unicode::getRequiredLengthUtf8_to_Utf16(const char* utf8String, const size_t utf8Length)
+{
+    bool nonAsciiFound = false;
+    size_t validLength = validateUtf8Blocks(utf8String, utf8Length, nonAsciiFound);
+    if(validLength < utf8Length)
+    {
+        validLength = validateUtf8(utf8String, utf8Length, validLength);
+    }
+
+    // Each lead gives one UTF-16 code unit, and each 4 bytes sequence lead a surrogate pair,
+    // but for the non-characters, which are replaced
+    size_t utf16Length = 0;
+    for(size_t i = 0; i < validLength; ++i)
+    {
+        unsigned char codeUnit = static_cast<unsigned char>(utf8String[i]);
+        utf16Length += ((codeUnit & 0xC0U) != 0x80U);
+        if(codeUnit >= 0xF0U)
         {
-            if(strictConversion)
-            {
-                throw logic_error("Invalid UTF-32 code point");
-            }
-            else
-            {
-                codeUnits[0] = static_cast<char32_t>(UNICODE_REPLACEMENT_CHARACTER);
-            }
+            bool nonCharacter = ((utf8String[i + 1] & 0x0F) == 0x0F) &&
+                                ((utf8String[i + 2] & 0x3F) == 0x3F) &&
+                                ((utf8String[i + 3] & 0x3E) == 0x3E);
+            utf16Length += !nonCharacter;
         }
+    }
 
-        // Add code point to UTF-32 string
-        strRet.append(codeUnits);
+    size_t i = validLength;
+    while(i < utf8Length)
+    {
+        char32_t codePoint = 0;
+        char16_t utf16Sequence[2];
+        size_t sequenceLength = 0;
+        tryDecodeUtf8Char(utf8String, utf8Length, i, codePoint);
+        tryEncodeUtf16Char(codePoint, utf16Sequence, sequenceLength);
+        utf16Length += sequenceLength;
     }
 
-    return strRet;
+    return utf16Length;
 }
 
 /**
- * Converts an UTF-32 encoded string to the equivalent UTF-16 encoded string.
+ * Gets the number of UTF-8 code units needed to convert an UTF-16 code units buffer, counting the
+ * invalid code units as the replacement character.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	utf32String			the UTF-32 encoded string to be converted
- * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
- *                              invalid conversion, if 'false' replaces invalid character width the replacement character
- * @return	the equivalent UTF-16 encoded string
+ * @param	utf16String	the UTF-16 code units
+ * @param	utf16Length	the number of UTF-16 code units
+ * @return	the number of UTF-8 code units
  * @since	1.0
  */
-u16string CodePage2Unicode::convertStringUtf32_to_StringUtf16(const u32string& utf32String, const bool strictConversion)
+size_t CodePage2Unicode::getRequiredLengthUtf16_to_Utf8(const char16_t* utf16String, const size_t utf16Length)
 {
-    u16string strRet;
-    char32_t charUtf32;
-    bool surrogate32;
-    for(unsigned i = 0; i < utf32String.length(); i++)
+    size_t utf8Length = 0;
+    size_t i = 0;
+    while(i < utf16Length)
     {
-        charUtf32 = utf32String.at(i);
-        surrogate32 = isUtf32Surrogate(charUtf32);
-
-        // Check if UTF-32 code point is valid
-        if(!isUnicodeInterchangeCharacter(charUtf32) && !isUtf16Surrogate((char16_t)charUtf32))
+        char16_t codeUnit = utf16String[i];
+        if(codeUnit < 0x800U)
         {
-            if(strictConversion)
-            {
-                throw logic_error("Invalid UTF-32 code point");
-            }
-            else
-            {
-                char16_t codeUnits[2] = {
-                    0, 0
-                };
-                codeUnits[1] = static_cast<char16_t>(UNICODE_REPLACEMENT_CHARACTER);
-                strRet.append(codeUnits);
-            }
+            // 1 or 2 bytes sequence
+            utf8Length += (codeUnit < 0x80U) ? 1 : 2;
+            ++i;
         }
         else
         {
-            if((charUtf32 <= UNICODE_MAXIMUM_BMP) && !(surrogate32))
-            {
-                // UCS-4/UTF-32 BMP code point doesn't needs to be converted to UTF-16 surrogate
-                char16_t codeUnits[2] = {
-                    0, 0
-                };
-
-                if(isUtf16Surrogate(static_cast<char16_t>(charUtf32)) || (charUtf32 == 0XFFFE) || (charUtf32 == 0XFFFF))
-                {
-                    // UTF-16 surrogate values are illegal in UTF-32; 0XFFFF and 0XFFFE are both reserved values
-                    if(strictConversion)
-                    {
-                        throw logic_error("Invalid UTF-32 code point");
-                        break;
-                    }
-                    else
-                    {
-                        codeUnits[0] = static_cast<char16_t>(UNICODE_REPLACEMENT_CHARACTER);
-                    }
-                }
-                else
-                {
-                    // OK, normal case
-                    codeUnits[0] = static_cast<char16_t>(charUtf32);
-                }
-
-                strRet.append(codeUnits);
-            }
-            else if(surrogate32)
-            {
-                // As Unicode 7.0, no UTF-32 surrogates exist
-            }
-            else
-            {
-                // UCS-4/UTF-32 code point needs to be converted to UTF-16 surrogate
-                char16_t codeUnits[3] = {
-                    0, 0, 0
-                };
-
-                if(charUtf32 > UNICODE_MAXIMUM)
-                {
-                    // UTF-32 code point is invalid, due to be hider than the maximum value of Unicode
-                    if(strictConversion)
-                    {
-                        throw logic_error("Invalid UTF-32 code point");
-                        break;
-                    }
-                    else
-                    {
-                        codeUnits[0] = static_cast<char16_t>(UNICODE_REPLACEMENT_CHARACTER);
-                        strRet.append(codeUnits);
-                    }
-                }
-                else
-                {
-                    // OK, UTF-32 code point in range 0x10000 - 0x10FFFF
-                    charUtf32 -= UTF16_HALF_BASE;
-                    codeUnits[0] = static_cast<wchar_t>((charUtf32 >> UTF16_HALF_SHIFT) + UNICODE_HIGH_SURROGATE_START);
-                    codeUnits[1] = static_cast<wchar_t>((charUtf32 & UTF16_HALF_MASK) + UNICODE_LOW_SURROGATE_START);
-                    strRet.append(codeUnits);
-                }
-            }
+            // 3 bytes sequence, surrogate pair or invalid code unit
+            char32_t codePoint = 0;
+            char utf8Sequence[4];
+            size_t sequenceLength = 0;
+            tryDecodeUtf16Char(utf16String, utf16Length, i, codePoint);
+            tryEncodeUtf8Char(codePoint, utf8Sequence, sequenceLength);
+            utf8Length += sequenceLength;
         }
     }
 
-    return strRet;
+    return utf8Length;
 }
 
 /**
- * Converts an UTF-16 encoded string to the equivalent UTF-8 encoded string.
+ * Gets the number of UTF-32 code points needed to convert an UTF-8 code units buffer, counting the
+ * invalid sequences as the replacement character. The valid leading part is measured by counting its
+ * leads, the rest is measured one sequence at a time.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	utf16String			the UTF-16 encoded string to be converted
- * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
- *                              invalid conversion, if 'false' replaces invalid character width the replacement character
- * @return	the equivalent UTF-8 encoded string
+ * @param	utf8String	the UTF-8 code units
+ * @param	utf8Length	the number of UTF-8 code units
+ * @return	the number of UTF-32 code points
  * @since	1.0
  */
-string CodePage2Unicode::convertStringUtf16_to_StringUtf8(const u16string& utf16String, const bool strictConversion)
+size_t CodePage2Unicode::getRequiredLengthUtf8_to_Utf32(const char* utf8String, const size_t utf8Length)
 {
-    // Validate parameters
-    assert(&utf16String != nullptr);
+    bool nonAsciiFound = false;
+    size_t validLength = validateUtf8Blocks(utf8String, utf8Length, nonAsciiFound);
+    if(validLength < utf8Length)
+    {
+        validLength = validateUtf8(utf8String, utf8Length, validLength);
+    }
+
+    // Each lead gives one UTF-32 code point
+    size_t utf32Length = 0;
+    for(size_t i = 0; i < validLength; ++i)
+    {
+        utf32Length += ((static_cast<unsigned char>(utf8String[i]) & 0xC0U) != 0x80U);
+    }
 
-    u32string utf32String = convertStringUtf16_to_StringUtf32(utf16String, strictConversion);
-    string utf8String = convertStringUtf32_to_StringUtf8(utf32String, strictConversion);
+    size_t i = validLength;
+    while(i < utf8Length)
+    {
+        char32_t codePoint = 0;
+        tryDecodeUtf8Char(utf8String, utf8Length, i, codePoint);
+        ++utf32Length;
+    }
 
-    return utf8String;
+    return utf32Length;
 }
 
 /**
- * Converts an UTF-8 encoded string to the equivalent UTF-16 encoded string.
+ * Gets the number of UTF-32 code points needed to convert an UTF-16 code units buffer, counting the
+ * invalid code units as the replacement character.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	utf8String			the UTF-8 encoded string to be converted
- * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
- *                              invalid conversion, if 'false' replaces invalid character width the replacement character
- * @return	the equivalent UTF-16 encoded string
+ * @param	utf16String	the UTF-16 code units
+ * @param	utf16Length	the number of UTF-16 code units
+ * @return	the number of UTF-32 code points
  * @since	1.0
  */
-u16string CodePage2Unicode::convertStringUtf8_to_StringUtf16(const string& utf8String, const bool strictConversion)
+size_t CodePage2Unicode::getRequiredLengthUtf16_to_Utf32(const char16_t* utf16String, const size_t utf16Length)
 {
-    u32string utf32String = convertStringUtf8_to_StringUtf32(utf8String, strictConversion);
-    u16string utf16String = convertStringUtf32_to_StringUtf16(utf32String, strictConversion);
+    // Each code unit gives one code point, but the low surrogates of the surrogate pairs
+    size_t utf32Length = utf16Length;
+    for(size_t i = 1; i < utf16Length; ++i)
+    {
+        utf32Length -= (isUtf16HighSurrogate(utf16String[i - 1]) && isUtf16LowSurrogate(utf16String[i]));
+    }
 
-    return utf16String;
+    return utf32Length;
 }
 
 /**
- * Converts an UTF-32 encoded string to the equivalent UTF-8 encoded string.
+ * Gets the number of UTF-16 code units needed to convert an UTF-32 code points buffer, counting the
+ * invalid code points as the replacement character.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	utf32String			the UTF-32 encoded string to be converted
- * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
- *                              invalid conversion, if 'false' replaces invalid character width the replacement character
- * @return	the equivalent UTF-8 encoded string
+ * @param	utf32String	the UTF-32 code points
+ * @param	utf32Length	the number of UTF-32 code points
+ * @return	the number of UTF-16 code units
  * @since	1.0
  */
-string CodePage2Unicode::convertStringUtf32_to_StringUtf8(const u32string& utf32String, const bool strictConversion)
+size_t CodePage2Unicode::getRequiredLengthUtf32_to_Utf16(const char32_t* utf32String, const size_t utf32Length)
 {
-    // Validate parameters
-    assert(&utf32String != nullptr);
-
-    static const char firstByteMark[6] = {
-        0x00, UTF8_LEAD_BYTES2, UTF8_LEAD_BYTES3, UTF8_LEAD_BYTES4, UTF8_LEAD_BYTES5, UTF8_LEAD_BYTES6
-    };
-
-    string utf8String;
-
-    size_t i = 0;
-
-    while(i < utf32String.length())
+    // The supplementary planes characters, but the non-characters, give a surrogate pair
+    size_t utf16Length = utf32Length;
+    for(size_t i = 0; i < utf32Length; ++i)
     {
-        try
-        {
-            // Maximum code points length is 6 bytes, but as Unicode 7.0, only 4 bytes are valid (plus one for null)
-            char codeUnits[7] = {
-                '\0', '\0', '\0', '\0', '\0', '\0', '\0'
-            };
-
-            char32_t codePoint = utf32String.at(i);
-            size_t sequenceBytes = getCodeUnitsForUtf8Char(codePoint);
-            ++i;
-
-            // Check if UTF-32 code point is valid
-            if(!isUnicodeInterchangeCharacter(codePoint) && !isUtf16Surrogate((char16_t)codePoint))
-            {
-                if(strictConversion)
-                {
-                    throw logic_error("Invalid UTF-32 code point");
-                }
-                else
-                {
-                    codeUnits[0] = static_cast<char>(0xEFU);
-                    codeUnits[1] = static_cast<char>(0xBFU);
-                    codeUnits[2] = static_cast<char>(0xBDU);
-                }
-            }
-            else if(isUtf32Surrogate(codePoint))
-            {
-                // UTF-32 surrogate don't exist as Unicode 7.0
-                if(strictConversion)
-                {
-                    throw logic_error("Invalid UTF-32 code point");
-                }
-                else
-                {
-                    codeUnits[0] = static_cast<char>(0xEFU);
-                    codeUnits[1] = static_cast<char>(0xBFU);
-                    codeUnits[2] = static_cast<char>(0xBDU);
-                }
-            }
-            else
-            {
-                if(sequenceBytes == 1)
-                {
-                    // OK, it's an ASCII, so no surrogate needed
-                    codeUnits[0] = static_cast<char>(codePoint);
-                }
-                else
-                {
-                    for(size_t j = sequenceBytes - 1; j >= 1; --j)
-                    {
-                        codeUnits[j] = static_cast<unsigned char>((codePoint | UTF8_NEXT) & 0xBFU);
-                        codePoint >>= UTF8_HALF_SHIFT;
-                    }
-                    codeUnits[0] = static_cast<unsigned char>((codePoint | firstByteMark[sequenceBytes - 1]));
-                }
-            }
-
-            // Add code point to UTF-32 string
-            utf8String.append((char*)&(codeUnits[0]));
-        }
-        catch(logic_error& ex)
-        {
-            // Invalid UTF-8 code unit
-            throw;
-			// Remove unreferenced local variable warning
-			ex;
-        }
-        catch(...)
-        {
-            // Invalid UTF-8 code unit or generic error
-            throw;
-        }
+        char32_t codePoint = utf32String[i];
+        utf16Length += ((codePoint > UNICODE_MAXIMUM_BMP) && (codePoint <= UNICODE_MAXIMUM) && ((codePoint & 0xFFFEUL) != 0xFFFEUL));
     }
 
-    return utf8String;
+    return utf16Length;
 }
 
 /**
- * Converts an UTF-8 encoded string to the equivalent UTF-32 encoded string.
+ * Gets the number of UTF-8 code units needed to convert a 8-bit extended ASCII characters buffer
+ * from a given code page.
  *
  * @author	Jos&eacute; Caetano Silva
  * @version	%I%, %G%
- * @param	utf8String			the UTF-8 encoded string to be converted
- * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
- *                              invalid conversion, if 'false' replaces invalid character width the replacement character
- * @return	the equivalent UTF-32 encoded string
+ * @param	narrowString		the ASCII characters
+ * @param	narrowLength		the number of ASCII characters
+ * @param	codePage			the code page from CodePage enumeration that the ASCII characters belong to
+ * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+ *                              also converts ASCII control codes [0; 31, 127] to Unicode
+ * @return	the number of UTF-8 code units
  * @since	1.0
  */
-u32string CodePage2Unicode::convertStringUtf8_to_StringUtf32(const string& utf8String, const bool strictConversion)
+size_t CodePage2Unicode::getRequiredLengthAscii_to_Utf8(const char* narrowString, const size_t narrowLength,
+                                                        const CodePage codePage, const bool convertAsciiControl)
 {
-    // Validate parameters
-    assert(&utf8String != nullptr);
-
-    u32string utf32String;
-    size_t i = 0;
+    const CodePageTables& objTables = getCodePageTables();
+    const unsigned char (*pTable)[4] = objTables.m_arrUtf8Tables[getCodePageTableIndex(codePage)][convertAsciiControl ? 1 : 0];
 
-    while(i < utf8String.length())
+    size_t utf8Length = 0;
+    for(size_t i = 0; i < narrowLength; ++i)
     {
-        try
-        {
-            char32_t codeUnits[2] = {
-#if defined(_WIN32)
-                L'\0', L'\0'
-#else
-				U'\0', U'\0'
-#endif
-            };
-
-            char codeUnit = utf8String.at(i);
-            size_t sequenceBytes = getCodeUnitsForUtf8Leads(codeUnit) - 1;
-            ++i;
-
-            if(isUtf8NextSurrogate(codeUnit))
-            {
-                // Invalid next lead surrogate
-                if(strictConversion)
-                {
-                    throw logic_error("Invalid UTF-8 sequence first surrogate");
-                }
-                else
-                {
-                    codeUnits[0] = static_cast<char32_t>(UNICODE_REPLACEMENT_CHARACTER);
-                }
-            }
-            else
-            {
-                if(sequenceBytes == 0)
-                {
-                    // OK, it's an ASCII, so no surrogate needed
-                    codeUnits[0] = static_cast<char32_t>(static_cast<unsigned char>(codeUnit));
-                }
-                else
-                {   // First surrogate sequence code unit
-                    switch(sequenceBytes)
-                    {
-                        case 1:
-                            codeUnits[0] = codeUnit & UTF8_LEAD_BYTES2_MASK;
-                            break;
-
-                        case 2:
-                            codeUnits[0] = codeUnit & UTF8_LEAD_BYTES3_MASK;
-                            break;
+        utf8Length += pTable[static_cast<unsigned char>(narrowString[i])][3];
+    }
 
-                        case 3:
-                            codeUnits[0] = codeUnit & UTF8_LEAD_BYTES4_MASK;
-                            break;
+    return utf8Length;
+}
 
-                        case 4:
-                            codeUnits[0] = codeUnit & UTF8_LEAD_BYTES5_MASK;
-                            break;
+/**
+ * Gets the number of 8-bit extended ASCII characters needed to convert an UTF-32 code points buffer to
+ * a given code page.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String			the UTF-32 code points
+ * @param	utf32Length			the number of UTF-32 code points
+ * @param	codePage			the code page from CodePage enumeration of the ASCII characters
+ * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+ *                              with the characters that can't be represented in the code page
+ * @return	the number of ASCII characters, 0 if the code page isn't supported
+ * @since	1.0
+ */
+size_t CodePage2Unicode::getRequiredLengthUtf32_to_Ascii(const char32_t* utf32String, const size_t utf32Length, const CodePage codePage,
+                                                         const UnmappableAction unmappableAction)
+{
+    switch(codePage)
+    {
+        case CodePage::UTF_8:
+            return getUtf8Length(utf32String, utf32Length);
 
-                        case 5:
-                            codeUnits[0] = codeUnit & UTF8_LEAD_BYTES6_MASK;
-                            break;
-                    }
+        case CodePage::UTF_7:
+        case CodePage::UCS_2:
+        case CodePage::UCS_4:
+        case CodePage::UTF_16:
+        case CodePage::UTF_32:
+            return 0;
 
-                    for(size_t j = 0; j < sequenceBytes; ++j)
-                    {
-                        // Read the next code unit of the surrogate sequence
-                        if(i >= utf8String.length())
-                        {
-                            // Error, the UTF-8 string ended to soon
-                            throw logic_error("Invalid UTF-8 size");
-                        }
-                        char codeUnitNext = utf8String.at(i);
-                        if(!isUtf8NextSurrogate(codeUnitNext))
-                        {
-                            // Error, not a next code unit of the surrogate sequence
-                            if(strictConversion)
-                            {
-                                throw logic_error("Invalid UTF-8 sequence");
-                            }
-                            else
-                            {
-                                codeUnits[0] = static_cast<char32_t>(UNICODE_REPLACEMENT_CHARACTER);
-                            }
-                        }
-                        else
-                        {
-                            // OK, build UTF-32 character from sequence
-                            codeUnits[0] = (codeUnits[0]) << UTF8_HALF_SHIFT;
-                            codeUnits[0] = (codeUnits[0]) + (codeUnitNext & UTF8_NEXT_MASK);
-                        }
-
-                        ++i;
-                    }
-                }
-            }
+        default:
+            break;
+    }
 
-            // Check if UTF-32 code point is valid
-            if(!isUnicodeInterchangeCharacter(codeUnits[0]) && !isUtf16Surrogate((char16_t)codeUnits[0]))
-            {
-                if(strictConversion)
-                {
-                    throw logic_error("Invalid UTF-32 code point");
-                }
-                else
-                {
-                    codeUnits[0] = static_cast<char32_t>(UNICODE_REPLACEMENT_CHARACTER);
-                }
-            }
+    if(unmappableAction != UnmappableAction::SKIP)
+    {
+        // One character for each code point, mapped or replaced
+        return utf32Length;
+    }
 
-            // Add code point to UTF-32 string
-            utf32String.append(codeUnits);
-        }
-        catch(logic_error& ex)
-        {
-            // Invalid UTF-8 code unit
-            throw;
-			// Remove unreferenced local variable warning
-			ex;
-        }
-        catch(...)
-        {
-            // Invalid UTF-8 code unit or generic error
-            throw;
-        }
+    // Only the mappable code points give a character
+    const CodePageEncodingTables& objTables = getCodePageEncodingTables();
+    size_t tableIndex = getCodePageTableIndex(codePage);
+    size_t narrowLength = 0;
+    char narrowChar = 0;
+    for(size_t i = 0; i < utf32Length; ++i)
+    {
+        narrowLength += objTables.lookup(tableIndex, utf32String[i], narrowChar);
     }
 
-    return utf32String;
+    return narrowLength;
 }
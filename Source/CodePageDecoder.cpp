@@ -0,0 +1,1141 @@
+/**
+ * CodePageDecoder.cpp
+ *
+ * ABSTRACT
+ *  Implementation of the incremental decoders that convert streamed chunks from ASCII to Unicode and vice versa,
+ *  carrying the sequences split across the chunk boundaries.
+ *
+ * CONTACTS
+ *  E-mail regarding any portion of the "CodePage2Unicode" project:
+ *      José Caetano Silva, jcaetano@users.sourceforge.net
+ *
+ * COPYRIGHT
+ *  This file is distributed under the terms of the GNU General Public
+ *  License (GPL) v3. Copies of the GPL can be obtained from:
+ *      ftp://prep.ai.mit.edu/pub/gnu/GPL
+ *  Each contributing author retains all rights to their own work.
+ *
+ *  (C) 20011 - 20015   José Caetano Silva
+ *
+ * HISTORY
+ *  2026-10-17: Created.
+ */
+
+#include "Include/StdAfx.h"
+
+#include "Include/CodePageDecoder.h"
+
+using namespace std;
+
+/* Incremental UTF-8 decoder */
+
+/**
+ * Gets the number of code units at the end of an UTF-8 buffer that start a well-formed sequence, but don't
+ * complete it. The ill-formed ones are left to the buffer conversion, that replaces them as in one buffer.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String	the UTF-8 code units
+ * @param	utf8Length	the number of UTF-8 code units
+ * @return	the number of code units of the incomplete sequence [0; 3]
+ * @since	1.0
+ */
+size_t Utf8Decoder::getIncompleteTailLength(const char* utf8String, const size_t utf8Length)
+{
+    // Look back for the lead of the last sequence, over its next code units
+    for(size_t k = 1; (k <= 3) && (k <= utf8Length); ++k)
+    {
+        char codeUnit = utf8String[utf8Length - k];
+        if(!CodePage2Unicode::isUtf8NextSurrogate(codeUnit))
+        {
+            size_t sequenceBytes = CodePage2Unicode::getCodeUnitsForUtf8Leads(codeUnit);
+            bool wellFormed = (k == 1) || CodePage2Unicode::isUtf8NextSurrogateOf(codeUnit, 1, utf8String[utf8Length - k + 1]);
+
+            return ((sequenceBytes > k) && wellFormed) ? k : 0;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Feeds an UTF-8 chunk to one of the buffer conversions.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String			the UTF-8 code units to be converted
+ * @param	utf8Length			the number of UTF-8 code units
+ * @param	outString			receives the converted code units
+ * @param	outRoom				the room for converted code units
+ * @param	convertFunction		the buffer conversion from UTF-8
+ * @param	replacementLength	the number of code units of the replacement character in the output
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+template<typename CharType>
+ConversionResult Utf8Decoder::feedTo(const char* utf8String, const size_t utf8Length, CharType* outString, const size_t outRoom,
+                                     ConversionResult (*convertFunction)(const char*, const size_t, CharType*, const size_t, const bool),
+                                     const size_t replacementLength)
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, CodePage2Unicode::NO_ERROR_OFFSET };
+    size_t i = 0;
+
+    if(m_pendingLength > 0)
+    {
+        // Complete the sequence split at the end of the last chunk
+        char sequence[4];
+        size_t sequenceLength = m_pendingLength;
+        for(size_t j = 0; j < m_pendingLength; ++j)
+        {
+            sequence[j] = m_arrPending[j];
+        }
+        size_t sequenceBytes = CodePage2Unicode::getCodeUnitsForUtf8Leads(sequence[0]);
+        while((sequenceLength < sequenceBytes) && (i < utf8Length) &&
+              CodePage2Unicode::isUtf8NextSurrogateOf(sequence[0], sequenceLength, utf8String[i]))
+        {
+            sequence[sequenceLength++] = utf8String[i++];
+        }
+
+        if(sequenceLength < sequenceBytes)
+        {
+            if(i >= utf8Length)
+            {
+                // This chunk is too short as well, keep waiting
+                for(size_t j = m_pendingLength; j < sequenceLength; ++j)
+                {
+                    m_arrPending[j] = sequence[j];
+                }
+                m_pendingLength = sequenceLength;
+                objResult.consumed = utf8Length;
+
+                return objResult;
+            }
+
+            // The sequence is broken by the code unit at 'i', that's left to start the next sequence:
+            // convert the sequence followed by it with only the room for the replacement character
+            sequence[sequenceLength] = utf8String[i];
+            ConversionResult objSequence = convertFunction(sequence, sequenceLength + 1, outString,
+                                                           min(outRoom, replacementLength), m_strictConversion);
+            if(objSequence.written == 0)
+            {
+                // No room or strict conversion, the pending sequence is kept
+                objResult.status = objSequence.status;
+                objResult.errorOffset = (objSequence.status == ConversionStatus::OUTPUT_TOO_SMALL) ? CodePage2Unicode::NO_ERROR_OFFSET : 0;
+
+                return objResult;
+            }
+            objResult.written = objSequence.written;
+            objResult.errorOffset = 0;
+        }
+        else
+        {
+            ConversionResult objSequence = convertFunction(sequence, sequenceLength, outString, outRoom, m_strictConversion);
+            if(objSequence.status != ConversionStatus::OK)
+            {
+                // No room or strict conversion, the pending sequence is kept
+                objResult.status = objSequence.status;
+                objResult.errorOffset = (objSequence.errorOffset == CodePage2Unicode::NO_ERROR_OFFSET) ? CodePage2Unicode::NO_ERROR_OFFSET : 0;
+
+                return objResult;
+            }
+            objResult.written = objSequence.written;
+            objResult.errorOffset = (objSequence.errorOffset == CodePage2Unicode::NO_ERROR_OFFSET) ? CodePage2Unicode::NO_ERROR_OFFSET : 0;
+        }
+        m_pendingLength = 0;
+    }
+
+    // Convert the chunk, but the sequence split at its end
+    size_t tailLength = getIncompleteTailLength(utf8String + i, utf8Length - i);
+    ConversionResult objChunk = convertFunction(utf8String + i, utf8Length - i - tailLength,
+                                                outString + objResult.written, outRoom - objResult.written, m_strictConversion);
+    if((objChunk.status == ConversionStatus::INCOMPLETE_SEQUENCE) && (tailLength > 0))
+    {
+        // The sequence isn't truncated, it's broken by the lead of the split sequence
+        objChunk.status = ConversionStatus::INVALID_SEQUENCE;
+    }
+    objResult.status = objChunk.status;
+    objResult.consumed = i + objChunk.consumed;
+    objResult.written += objChunk.written;
+    if((objResult.errorOffset == CodePage2Unicode::NO_ERROR_OFFSET) && (objChunk.errorOffset != CodePage2Unicode::NO_ERROR_OFFSET))
+    {
+        objResult.errorOffset = i + objChunk.errorOffset;
+    }
+
+    if(objChunk.status == ConversionStatus::OK)
+    {
+        // Keep the split sequence for the next chunk
+        for(size_t j = 0; j < tailLength; ++j)
+        {
+            m_arrPending[j] = utf8String[utf8Length - tailLength + j];
+        }
+        m_pendingLength = tailLength;
+        objResult.consumed = utf8Length;
+    }
+
+    return objResult;
+}
+
+/**
+ * Flushes the pending sequence to one of the buffer conversions.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	outString			receives the converted code units
+ * @param	outRoom				the room for converted code units
+ * @param	convertFunction		the buffer conversion from UTF-8
+ * @return	the conversion status and the number of code units written
+ * @since	1.0
+ */
+template<typename CharType>
+ConversionResult Utf8Decoder::finishTo(CharType* outString, const size_t outRoom,
+                                       ConversionResult (*convertFunction)(const char*, const size_t, CharType*, const size_t, const bool))
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, CodePage2Unicode::NO_ERROR_OFFSET };
+
+    if(m_pendingLength > 0)
+    {
+        // The stream ended in the middle of a sequence
+        objResult = convertFunction(m_arrPending, m_pendingLength, outString, outRoom, m_strictConversion);
+        objResult.consumed = 0;
+        if(objResult.status != ConversionStatus::OUTPUT_TOO_SMALL)
+        {
+            m_pendingLength = 0;
+        }
+    }
+
+    return objResult;
+}
+
+/**
+ * Converts the next UTF-8 chunk to UTF-16.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String	the UTF-8 code units to be converted
+ * @param	utf8Length	the number of UTF-8 code units
+ * @param	utf16String	receives the UTF-16 code units
+ * @param	utf16Room	the room for UTF-16 code units
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult Utf8Decoder::feed(const char* utf8String, const size_t utf8Length, char16_t* utf16String, const size_t utf16Room)
+{
+    return feedTo(utf8String, utf8Length, utf16String, utf16Room, CodePage2Unicode::convertUtf8_to_Utf16, 1);
+}
+
+/**
+ * Converts the next UTF-8 chunk to UTF-32.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String	the UTF-8 code units to be converted
+ * @param	utf8Length	the number of UTF-8 code units
+ * @param	utf32String	receives the UTF-32 code points
+ * @param	utf32Room	the room for UTF-32 code points
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult Utf8Decoder::feed(const char* utf8String, const size_t utf8Length, char32_t* utf32String, const size_t utf32Room)
+{
+    return feedTo(utf8String, utf8Length, utf32String, utf32Room, CodePage2Unicode::convertUtf8_to_Utf32, 1);
+}
+
+/**
+ * Ends the UTF-8 stream converted to UTF-16, a pending sequence is incomplete.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String	receives the UTF-16 code units
+ * @param	utf16Room	the room for UTF-16 code units
+ * @return	the conversion status and the number of code units written
+ * @since	1.0
+ */
+ConversionResult Utf8Decoder::finish(char16_t* utf16String, const size_t utf16Room)
+{
+    return finishTo(utf16String, utf16Room, CodePage2Unicode::convertUtf8_to_Utf16);
+}
+
+/**
+ * Ends the UTF-8 stream converted to UTF-32, a pending sequence is incomplete.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String	receives the UTF-32 code points
+ * @param	utf32Room	the room for UTF-32 code points
+ * @return	the conversion status and the number of code units written
+ * @since	1.0
+ */
+ConversionResult Utf8Decoder::finish(char32_t* utf32String, const size_t utf32Room)
+{
+    return finishTo(utf32String, utf32Room, CodePage2Unicode::convertUtf8_to_Utf32);
+}
+
+/* Incremental UTF-16 decoder */
+
+/**
+ * Feeds an UTF-16 chunk to one of the buffer conversions.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String			the UTF-16 code units to be converted
+ * @param	utf16Length			the number of UTF-16 code units
+ * @param	outString			receives the converted code units
+ * @param	outRoom				the room for converted code units
+ * @param	convertFunction		the buffer conversion from UTF-16
+ * @param	replacementLength	the number of code units of the replacement character in the output
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+template<typename CharType>
+ConversionResult Utf16Decoder::feedTo(const char16_t* utf16String, const size_t utf16Length, CharType* outString, const size_t outRoom,
+                                      ConversionResult (*convertFunction)(const char16_t*, const size_t, CharType*, const size_t, const bool),
+                                      const size_t replacementLength)
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, CodePage2Unicode::NO_ERROR_OFFSET };
+    size_t i = 0;
+
+    if(m_hasPending)
+    {
+        if(utf16Length == 0)
+        {
+            return objResult;
+        }
+
+        // Pair the high surrogate at the end of the last chunk, when this chunk starts with a low surrogate;
+        // otherwise the code unit is left to start the next character, converted with only the room for the
+        // replacement character
+        char16_t surrogatePair[2] = { m_pendingHighSurrogate, utf16String[0] };
+        size_t pairRoom = outRoom;
+        if(CodePage2Unicode::isUtf16LowSurrogate(utf16String[0]))
+        {
+            i = 1;
+        }
+        else
+        {
+            pairRoom = min(outRoom, replacementLength);
+        }
+        ConversionResult objPair = convertFunction(surrogatePair, 2, outString, pairRoom, m_strictConversion);
+        if(objPair.written == 0)
+        {
+            // No room or strict conversion, the pending high surrogate is kept
+            objResult.status = objPair.status;
+            objResult.errorOffset = (objPair.errorOffset == CodePage2Unicode::NO_ERROR_OFFSET) ? CodePage2Unicode::NO_ERROR_OFFSET : 0;
+
+            return objResult;
+        }
+        objResult.written = objPair.written;
+        objResult.errorOffset = (objPair.errorOffset == CodePage2Unicode::NO_ERROR_OFFSET) ? CodePage2Unicode::NO_ERROR_OFFSET : 0;
+        m_hasPending = false;
+    }
+
+    // Convert the chunk, but the high surrogate at its end
+    size_t tailLength = ((utf16Length > i) && CodePage2Unicode::isUtf16HighSurrogate(utf16String[utf16Length - 1])) ? 1 : 0;
+    ConversionResult objChunk = convertFunction(utf16String + i, utf16Length - i - tailLength,
+                                                outString + objResult.written, outRoom - objResult.written, m_strictConversion);
+    if((objChunk.status == ConversionStatus::INCOMPLETE_SEQUENCE) && (tailLength > 0))
+    {
+        // The sequence isn't truncated, it's broken by the lead of the split sequence
+        objChunk.status = ConversionStatus::INVALID_SEQUENCE;
+    }
+    objResult.status = objChunk.status;
+    objResult.consumed = i + objChunk.consumed;
+    objResult.written += objChunk.written;
+    if((objResult.errorOffset == CodePage2Unicode::NO_ERROR_OFFSET) && (objChunk.errorOffset != CodePage2Unicode::NO_ERROR_OFFSET))
+    {
+        objResult.errorOffset = i + objChunk.errorOffset;
+    }
+
+    if(objChunk.status == ConversionStatus::OK)
+    {
+        // Keep the high surrogate for the next chunk
+        if(tailLength > 0)
+        {
+            m_pendingHighSurrogate = utf16String[utf16Length - 1];
+            m_hasPending = true;
+        }
+        objResult.consumed = utf16Length;
+    }
+
+    return objResult;
+}
+
+/**
+ * Flushes the pending high surrogate to one of the buffer conversions.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	outString			receives the converted code units
+ * @param	outRoom				the room for converted code units
+ * @param	convertFunction		the buffer conversion from UTF-16
+ * @return	the conversion status and the number of code units written
+ * @since	1.0
+ */
+template<typename CharType>
+ConversionResult Utf16Decoder::finishTo(CharType* outString, const size_t outRoom,
+                                        ConversionResult (*convertFunction)(const char16_t*, const size_t, CharType*, const size_t, const bool))
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, CodePage2Unicode::NO_ERROR_OFFSET };
+
+    if(m_hasPending)
+    {
+        // The stream ended in the middle of a surrogate pair
+        objResult = convertFunction(&m_pendingHighSurrogate, 1, outString, outRoom, m_strictConversion);
+        objResult.consumed = 0;
+        if(objResult.status != ConversionStatus::OUTPUT_TOO_SMALL)
+        {
+            m_hasPending = false;
+        }
+    }
+
+    return objResult;
+}
+
+/**
+ * Converts the next UTF-16 chunk to UTF-8.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String	the UTF-16 code units to be converted
+ * @param	utf16Length	the number of UTF-16 code units
+ * @param	utf8String	receives the UTF-8 code units
+ * @param	utf8Room	the room for UTF-8 code units
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult Utf16Decoder::feed(const char16_t* utf16String, const size_t utf16Length, char* utf8String, const size_t utf8Room)
+{
+    // The replacement character is a 3 bytes UTF-8 sequence
+    return feedTo(utf16String, utf16Length, utf8String, utf8Room, CodePage2Unicode::convertUtf16_to_Utf8, 3);
+}
+
+/**
+ * Converts the next UTF-16 chunk to UTF-32.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf16String	the UTF-16 code units to be converted
+ * @param	utf16Length	the number of UTF-16 code units
+ * @param	utf32String	receives the UTF-32 code points
+ * @param	utf32Room	the room for UTF-32 code points
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult Utf16Decoder::feed(const char16_t* utf16String, const size_t utf16Length, char32_t* utf32String, const size_t utf32Room)
+{
+    return feedTo(utf16String, utf16Length, utf32String, utf32Room, CodePage2Unicode::convertUtf16_to_Utf32, 1);
+}
+
+/**
+ * Ends the UTF-16 stream converted to UTF-8, a pending high surrogate is incomplete.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf8String	receives the UTF-8 code units
+ * @param	utf8Room	the room for UTF-8 code units
+ * @return	the conversion status and the number of code units written
+ * @since	1.0
+ */
+ConversionResult Utf16Decoder::finish(char* utf8String, const size_t utf8Room)
+{
+    return finishTo(utf8String, utf8Room, CodePage2Unicode::convertUtf16_to_Utf8);
+}
+
+/**
+ * Ends the UTF-16 stream converted to UTF-32, a pending high surrogate is incomplete.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String	receives the UTF-32 code points
+ * @param	utf32Room	the room for UTF-32 code points
+ * @return	the conversion status and the number of code units written
+ * @since	1.0
+ */
+ConversionResult Utf16Decoder::finish(char32_t* utf32String, const size_t utf32Room)
+{
+    return finishTo(utf32String, utf32Room, CodePage2Unicode::convertUtf16_to_Utf32);
+}
+
+/* Incremental UTF-7 decoder */
+
+/**
+ * The base64 values of the UTF-7 7-bit characters, 0xFF if not a base64 character.
+ */
+const unsigned char Utf7Decoder::BASE64_VALUES[128] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+/**
+ * The base64 values of the modified UTF-7 7-bit characters, 0xFF if not a base64 character.
+ */
+const unsigned char Utf7Decoder::BASE64_VALUES_MODIFIED[128] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x3F, 0xFF, 0xFF, 0xFF,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+/**
+ * Class 'Utf7Decoder' constructor.
+ * Creates a mew object instance.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+ *                              sequence, if 'false' replaces invalid character width the replacement character
+ * @param	modifiedUtf7		optional parameter (default is 'false'), if 'true' decodes modified UTF-7
+ * @since	1.0
+ */
+Utf7Decoder::Utf7Decoder(const bool strictConversion, const bool modifiedUtf7)
+    : m_pBase64Values(modifiedUtf7 ? BASE64_VALUES_MODIFIED : BASE64_VALUES), m_shiftChar(modifiedUtf7 ? '&' : '+'),
+      m_modifiedUtf7(modifiedUtf7), m_strictConversion(strictConversion)
+{
+    reset();
+}
+
+/**
+ * Decodes an UTF-16 code unit of the base64 encoded characters, pairing the surrogates.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	codeUnit	the UTF-16 code unit
+ * @param	utf32String	receives the UTF-32 code points, must have room for 2 code points
+ * @param	status		receives the error, if any
+ * @return	the number of UTF-32 code points decoded [0; 2]
+ * @since	1.0
+ */
+size_t Utf7Decoder::decodeCodeUnit(const char16_t codeUnit, char32_t* utf32String, ConversionStatus& status)
+{
+    size_t count = 0;
+
+    char16_t highSurrogate = m_objState.highSurrogate;
+    if(highSurrogate != 0)
+    {
+        m_objState.highSurrogate = 0;
+        if(CodePage2Unicode::isUtf16LowSurrogate(codeUnit))
+        {
+            // UTF-16 surrogate pair, build the UTF-32 code point
+            char32_t codePoint = static_cast<char32_t>(((highSurrogate - CodePage2Unicode::UNICODE_HIGH_SURROGATE_START) << CodePage2Unicode::UTF16_HALF_SHIFT) +
+                                                       (codeUnit - CodePage2Unicode::UNICODE_LOW_SURROGATE_START) + CodePage2Unicode::UTF16_HALF_BASE);
+            if(!CodePage2Unicode::isUnicodeInterchangeCharacter(codePoint))
+            {
+                codePoint = static_cast<char32_t>(CodePage2Unicode::UNICODE_REPLACEMENT_CHARACTER);
+                status = ConversionStatus::INVALID_CODE_POINT;
+            }
+            utf32String[count++] = codePoint;
+
+            return count;
+        }
+
+        // The high surrogate isn't followed by a low surrogate
+        utf32String[count++] = static_cast<char32_t>(CodePage2Unicode::UNICODE_REPLACEMENT_CHARACTER);
+        status = ConversionStatus::INVALID_SEQUENCE;
+    }
+
+    if(CodePage2Unicode::isUtf16HighSurrogate(codeUnit))
+    {
+        // Wait for the low surrogate
+        m_objState.highSurrogate = codeUnit;
+    }
+    else if(CodePage2Unicode::isUtf16LowSurrogate(codeUnit))
+    {
+        utf32String[count++] = static_cast<char32_t>(CodePage2Unicode::UNICODE_REPLACEMENT_CHARACTER);
+        if(status == ConversionStatus::OK)
+        {
+            status = ConversionStatus::INVALID_LEAD_UNIT;
+        }
+    }
+    else if(!CodePage2Unicode::isUnicodeInterchangeCharacter(codeUnit))
+    {
+        utf32String[count++] = static_cast<char32_t>(CodePage2Unicode::UNICODE_REPLACEMENT_CHARACTER);
+        if(status == ConversionStatus::OK)
+        {
+            status = ConversionStatus::INVALID_CODE_POINT;
+        }
+    }
+    else
+    {
+        utf32String[count++] = static_cast<char32_t>(codeUnit);
+    }
+
+    return count;
+}
+
+/**
+ * Decodes a single UTF-7 character, in or out of the base64 encoded characters.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf7Char	the UTF-7 character
+ * @param	utf32String	receives the UTF-32 code points, must have room for 3 code points
+ * @param	consumed	receives 'false' if the character ends the base64 encoded characters and must
+ *                      be decoded again as a direct character
+ * @param	status		receives the error, if any
+ * @return	the number of UTF-32 code points decoded [0; 3]
+ * @since	1.0
+ */
+size_t Utf7Decoder::decodeChar(const char utf7Char, char32_t* utf32String, bool& consumed, ConversionStatus& status)
+{
+    unsigned char codeUnit = static_cast<unsigned char>(utf7Char);
+    consumed = true;
+
+    if(!m_objState.inBase64)
+    {
+        if(utf7Char == m_shiftChar)
+        {
+            // Start of the base64 encoded characters
+            m_objState.inBase64 = true;
+            m_objState.shiftOnly = true;
+            m_objState.bits = 0;
+            m_objState.bitCount = 0;
+
+            return 0;
+        }
+        if(codeUnit >= 0x80U)
+        {
+            // UTF-7 is a 7-bit encoding
+            utf32String[0] = static_cast<char32_t>(CodePage2Unicode::UNICODE_REPLACEMENT_CHARACTER);
+            status = ConversionStatus::INVALID_LEAD_UNIT;
+
+            return 1;
+        }
+        utf32String[0] = static_cast<char32_t>(codeUnit);
+
+        return 1;
+    }
+
+    unsigned char value = (codeUnit < 0x80U) ? m_pBase64Values[codeUnit] : 0xFFU;
+    if(value != 0xFFU)
+    {
+        // Next 6 bits, a code unit is decoded each 16 bits
+        m_objState.shiftOnly = false;
+        m_objState.bits = (m_objState.bits << 6) | value;
+        m_objState.bitCount += 6;
+        if(m_objState.bitCount < 16)
+        {
+            return 0;
+        }
+        m_objState.bitCount -= 16;
+        char16_t unit = static_cast<char16_t>(m_objState.bits >> m_objState.bitCount);
+        m_objState.bits &= (1U << m_objState.bitCount) - 1;
+
+        return decodeCodeUnit(unit, utf32String, status);
+    }
+
+    // Any other character ends the base64 encoded characters, that must have been padded with zero bits
+    size_t count = 0;
+    if(m_objState.highSurrogate != 0)
+    {
+        utf32String[count++] = static_cast<char32_t>(CodePage2Unicode::UNICODE_REPLACEMENT_CHARACTER);
+        status = ConversionStatus::INVALID_SEQUENCE;
+    }
+    if((m_objState.bitCount >= 6) || (m_objState.bits != 0))
+    {
+        utf32String[count++] = static_cast<char32_t>(CodePage2Unicode::UNICODE_REPLACEMENT_CHARACTER);
+        status = ConversionStatus::INVALID_SEQUENCE;
+    }
+    bool shiftOnly = m_objState.shiftOnly;
+    reset();
+
+    if(utf7Char == '-')
+    {
+        // The '-' is absorbed, right after the shift character it's the shift character itself
+        if(shiftOnly)
+        {
+            utf32String[count++] = static_cast<char32_t>(m_shiftChar);
+        }
+
+        return count;
+    }
+
+    consumed = false;
+    if(shiftOnly)
+    {
+        // A shift character alone
+        utf32String[count++] = static_cast<char32_t>(CodePage2Unicode::UNICODE_REPLACEMENT_CHARACTER);
+        status = ConversionStatus::INVALID_SEQUENCE;
+    }
+    else if(m_modifiedUtf7 && (status == ConversionStatus::OK))
+    {
+        // Modified UTF-7 always ends the base64 encoded characters with '-'
+        status = ConversionStatus::INVALID_SEQUENCE;
+    }
+
+    return count;
+}
+
+/**
+ * Converts the next UTF-7 chunk to UTF-32.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf7String	the UTF-7 characters to be converted
+ * @param	utf7Length	the number of UTF-7 characters
+ * @param	utf32String	receives the UTF-32 code points
+ * @param	utf32Room	the room for UTF-32 code points
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult Utf7Decoder::feed(const char* utf7String, const size_t utf7Length, char32_t* utf32String, const size_t utf32Room)
+{
+    ConversionStatus status = ConversionStatus::OK;
+    size_t errorOffset = CodePage2Unicode::NO_ERROR_OFFSET;
+    size_t count = 0;
+    size_t i = 0;
+
+    while(i < utf7Length)
+    {
+        if(!m_objState.inBase64)
+        {
+            // Zero-extend the directly encoded run, up to the next shift character
+            const char* pShift = static_cast<const char*>(memchr(utf7String + i, m_shiftChar, utf7Length - i));
+            size_t runEnd = (pShift != nullptr) ? static_cast<size_t>(pShift - utf7String) : utf7Length;
+            size_t chars = CodePage2Unicode::convertAsciiBlocks_to_Utf32(utf7String + i, min(runEnd - i, utf32Room - count), utf32String + count);
+            i += chars;
+            count += chars;
+            while((i < runEnd) && (count < utf32Room) && (static_cast<unsigned char>(utf7String[i]) < 0x80U))
+            {
+                utf32String[count++] = static_cast<char32_t>(utf7String[i++]);
+            }
+        }
+        else
+        {
+            // Decode the base64 run through the table, while there's room for the code points; the
+            // characters that end it, the invalid code units and the unpaired surrogates are left to 'decodeChar'
+            Utf7State& objState = m_objState;
+            while((i < utf7Length) && (utf32Room - count >= 2))
+            {
+                unsigned char codeUnit = static_cast<unsigned char>(utf7String[i]);
+                unsigned char value = (codeUnit < 0x80U) ? m_pBase64Values[codeUnit] : 0xFFU;
+                if(value == 0xFFU)
+                {
+                    break;
+                }
+                unsigned int bits = (objState.bits << 6) | value;
+                unsigned int bitCount = objState.bitCount + 6;
+                if(bitCount >= 16)
+                {
+                    bitCount -= 16;
+                    char16_t unit = static_cast<char16_t>(bits >> bitCount);
+                    bits &= (1U << bitCount) - 1;
+                    if(objState.highSurrogate == 0)
+                    {
+                        if(CodePage2Unicode::isUtf16HighSurrogate(unit))
+                        {
+                            objState.highSurrogate = unit;
+                        }
+                        else if(!CodePage2Unicode::isUtf16LowSurrogate(unit) && CodePage2Unicode::isUnicodeInterchangeCharacter(unit))
+                        {
+                            utf32String[count++] = static_cast<char32_t>(unit);
+                        }
+                        else
+                        {
+                            break;
+                        }
+                    }
+                    else
+                    {
+                        char32_t codePoint = static_cast<char32_t>(((objState.highSurrogate - CodePage2Unicode::UNICODE_HIGH_SURROGATE_START) << CodePage2Unicode::UTF16_HALF_SHIFT) +
+                                                                   (unit - CodePage2Unicode::UNICODE_LOW_SURROGATE_START) + CodePage2Unicode::UTF16_HALF_BASE);
+                        if(!CodePage2Unicode::isUtf16LowSurrogate(unit) || !CodePage2Unicode::isUnicodeInterchangeCharacter(codePoint))
+                        {
+                            break;
+                        }
+                        utf32String[count++] = codePoint;
+                        objState.highSurrogate = 0;
+                    }
+                }
+                objState.bits = bits;
+                objState.bitCount = bitCount;
+                objState.shiftOnly = false;
+                ++i;
+            }
+        }
+        if(i >= utf7Length)
+        {
+            break;
+        }
+
+        // Decode a single character aside, as it may not fit the room left
+        Utf7State objSaved = m_objState;
+        char32_t sequence[3];
+        bool consumed = true;
+        ConversionStatus charStatus = ConversionStatus::OK;
+        size_t sequenceLength = decodeChar(utf7String[i], sequence, consumed, charStatus);
+        if(count + sequenceLength > utf32Room)
+        {
+            m_objState = objSaved;
+            status = ConversionStatus::OUTPUT_TOO_SMALL;
+            break;
+        }
+        if(charStatus != ConversionStatus::OK)
+        {
+            if(m_strictConversion)
+            {
+                m_objState = objSaved;
+                status = charStatus;
+                errorOffset = i;
+                break;
+            }
+            if(errorOffset == CodePage2Unicode::NO_ERROR_OFFSET)
+            {
+                errorOffset = i;
+            }
+        }
+        for(size_t j = 0; j < sequenceLength; ++j)
+        {
+            utf32String[count++] = sequence[j];
+        }
+        if(consumed)
+        {
+            ++i;
+        }
+    }
+
+    ConversionResult objResult = { status, i, count, errorOffset };
+
+    return objResult;
+}
+
+/**
+ * Ends the UTF-7 stream, closing the base64 encoded characters.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String	receives the UTF-32 code points
+ * @param	utf32Room	the room for UTF-32 code points
+ * @return	the conversion status and the number of code units written
+ * @since	1.0
+ */
+ConversionResult Utf7Decoder::finish(char32_t* utf32String, const size_t utf32Room)
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, CodePage2Unicode::NO_ERROR_OFFSET };
+
+    if(!m_objState.inBase64)
+    {
+        return objResult;
+    }
+
+    // The stream may end the base64 encoded characters, but not in the middle of a character
+    char32_t sequence[2];
+    size_t sequenceLength = 0;
+    ConversionStatus charStatus = ConversionStatus::OK;
+    if((m_objState.highSurrogate != 0) || (m_objState.bitCount >= 6) || (m_objState.bits != 0) || m_objState.shiftOnly)
+    {
+        sequence[sequenceLength++] = static_cast<char32_t>(CodePage2Unicode::UNICODE_REPLACEMENT_CHARACTER);
+        charStatus = ConversionStatus::INCOMPLETE_SEQUENCE;
+    }
+    if(m_modifiedUtf7 && (charStatus == ConversionStatus::OK))
+    {
+        // Modified UTF-7 always ends the base64 encoded characters with '-'
+        charStatus = ConversionStatus::INVALID_SEQUENCE;
+    }
+
+    if((charStatus != ConversionStatus::OK) && m_strictConversion)
+    {
+        objResult.status = charStatus;
+        objResult.errorOffset = 0;
+    }
+    else if(sequenceLength > utf32Room)
+    {
+        objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+
+        return objResult;
+    }
+    else
+    {
+        for(size_t j = 0; j < sequenceLength; ++j)
+        {
+            utf32String[j] = sequence[j];
+        }
+        objResult.written = sequenceLength;
+        if(charStatus != ConversionStatus::OK)
+        {
+            objResult.errorOffset = 0;
+        }
+    }
+    reset();
+
+    return objResult;
+}
+
+/* Incremental UTF-7 encoder */
+
+/**
+ * The UTF-7 base64 alphabet.
+ */
+const char Utf7Encoder::BASE64_ALPHABET[64] = {
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+    'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
+};
+
+/**
+ * The modified UTF-7 base64 alphabet, with ',' instead of '/'.
+ */
+const char Utf7Encoder::BASE64_ALPHABET_MODIFIED[64] = {
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+    'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', ','
+};
+
+/**
+ * The 7-bit ASCII characters that UTF-7 encodes directly: 1 for set D and the white spaces,
+ * 2 for the base64 characters and '-' that need an explicit end of the base64 encoded characters.
+ */
+const unsigned char Utf7Encoder::DIRECT_CHARS[128] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/**
+ * The 7-bit ASCII characters that modified UTF-7 encodes directly, the printable ones but '&'.
+ */
+const unsigned char Utf7Encoder::DIRECT_CHARS_MODIFIED[128] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00
+};
+
+/**
+ * Class 'Utf7Encoder' constructor.
+ * Creates a mew object instance.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+ *                              code point, if 'false' replaces invalid character width the replacement character
+ * @param	modifiedUtf7		optional parameter (default is 'false'), if 'true' encodes modified UTF-7
+ * @since	1.0
+ */
+Utf7Encoder::Utf7Encoder(const bool strictConversion, const bool modifiedUtf7)
+    : m_bits(0), m_bitCount(0), m_inBase64(false),
+      m_pBase64Alphabet(modifiedUtf7 ? BASE64_ALPHABET_MODIFIED : BASE64_ALPHABET),
+      m_pDirectChars(modifiedUtf7 ? DIRECT_CHARS_MODIFIED : DIRECT_CHARS), m_shiftChar(modifiedUtf7 ? '&' : '+'),
+      m_modifiedUtf7(modifiedUtf7), m_strictConversion(strictConversion)
+{
+
+}
+
+/**
+ * Encodes a single code point.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	codePoint	the UTF-32 code point, a valid one
+ * @param	utf7String	receives the UTF-7 characters, must have room for 8 characters
+ * @return	the number of UTF-7 characters encoded [1; 7]
+ * @since	1.0
+ */
+size_t Utf7Encoder::encodeChar(const char32_t codePoint, char* utf7String)
+{
+    size_t count = 0;
+
+    bool direct = (codePoint < 0x80U) && (m_pDirectChars[codePoint] != 0);
+    if(direct || (codePoint == static_cast<char32_t>(m_shiftChar)))
+    {
+        if(m_inBase64)
+        {
+            // End the base64 encoded characters, padding the last 6 bits with zeros; the '-' is needed
+            // before a base64 character or '-', and always in modified UTF-7
+            if(m_bitCount > 0)
+            {
+                utf7String[count++] = m_pBase64Alphabet[(m_bits << (6 - m_bitCount)) & 0x3FU];
+            }
+            if(!direct || m_modifiedUtf7 || (m_pDirectChars[codePoint] == 2))
+            {
+                utf7String[count++] = '-';
+            }
+            reset();
+        }
+        utf7String[count++] = static_cast<char>(codePoint);
+        if(!direct)
+        {
+            // The shift character is encoded as itself followed by '-'
+            utf7String[count++] = '-';
+        }
+
+        return count;
+    }
+
+    if(!m_inBase64)
+    {
+        utf7String[count++] = m_shiftChar;
+        m_inBase64 = true;
+    }
+
+    // Base64 encode the UTF-16 code units, 6 bits at a time
+    char16_t utf16Sequence[2];
+    size_t sequenceLength = 1;
+    if(codePoint <= 0xFFFFU)
+    {
+        utf16Sequence[0] = static_cast<char16_t>(codePoint);
+    }
+    else
+    {
+        char32_t offset = codePoint - CodePage2Unicode::UTF16_HALF_BASE;
+        utf16Sequence[0] = static_cast<char16_t>((offset >> CodePage2Unicode::UTF16_HALF_SHIFT) + CodePage2Unicode::UNICODE_HIGH_SURROGATE_START);
+        utf16Sequence[1] = static_cast<char16_t>((offset & CodePage2Unicode::UTF16_HALF_MASK) + CodePage2Unicode::UNICODE_LOW_SURROGATE_START);
+        sequenceLength = 2;
+    }
+    for(size_t j = 0; j < sequenceLength; ++j)
+    {
+        m_bits = (m_bits << 16) | utf16Sequence[j];
+        m_bitCount += 16;
+        while(m_bitCount >= 6)
+        {
+            m_bitCount -= 6;
+            utf7String[count++] = m_pBase64Alphabet[(m_bits >> m_bitCount) & 0x3FU];
+        }
+        m_bits &= (1U << m_bitCount) - 1;
+    }
+
+    return count;
+}
+
+/**
+ * Converts the next UTF-32 chunk to UTF-7.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf32String	the UTF-32 code points to be converted
+ * @param	utf32Length	the number of UTF-32 code points
+ * @param	utf7String	receives the UTF-7 characters
+ * @param	utf7Room	the room for UTF-7 characters
+ * @return	the conversion status and the number of code units consumed and written
+ * @since	1.0
+ */
+ConversionResult Utf7Encoder::feed(const char32_t* utf32String, const size_t utf32Length, char* utf7String, const size_t utf7Room)
+{
+    ConversionStatus status = ConversionStatus::OK;
+    size_t errorOffset = CodePage2Unicode::NO_ERROR_OFFSET;
+    size_t count = 0;
+    size_t i = 0;
+
+    while(i < utf32Length)
+    {
+        if(!m_inBase64)
+        {
+            // Copy the directly encoded run
+            while((i < utf32Length) && (count < utf7Room) && (utf32String[i] < 0x80U) && (m_pDirectChars[utf32String[i]] != 0))
+            {
+                utf7String[count++] = static_cast<char>(utf32String[i++]);
+            }
+            if(i >= utf32Length)
+            {
+                break;
+            }
+        }
+
+        // Check if UTF-32 code point is valid: UTF-16 surrogate values are illegal in UTF-32,
+        // 0XFFFF and 0XFFFE are both reserved values, and nothing above the maximum value of Unicode
+        char32_t codePoint = utf32String[i];
+        bool valid = CodePage2Unicode::isUnicodeInterchangeCharacter(codePoint) &&
+                     !((codePoint <= CodePage2Unicode::UNICODE_MAXIMUM_BMP) && CodePage2Unicode::isUtf16Surrogate(static_cast<char16_t>(codePoint)));
+        if(!valid)
+        {
+            if(m_strictConversion)
+            {
+                status = ConversionStatus::INVALID_CODE_POINT;
+                errorOffset = i;
+                break;
+            }
+            codePoint = static_cast<char32_t>(CodePage2Unicode::UNICODE_REPLACEMENT_CHARACTER);
+        }
+
+        if(utf7Room - count >= 8)
+        {
+            // Encode straight into the output
+            count += encodeChar(codePoint, utf7String + count);
+        }
+        else
+        {
+            // Encode aside, as the characters may not fit the room left
+            unsigned int bits = m_bits;
+            unsigned int bitCount = m_bitCount;
+            bool inBase64 = m_inBase64;
+            char sequence[8];
+            size_t sequenceLength = encodeChar(codePoint, sequence);
+            if(count + sequenceLength > utf7Room)
+            {
+                m_bits = bits;
+                m_bitCount = bitCount;
+                m_inBase64 = inBase64;
+                status = ConversionStatus::OUTPUT_TOO_SMALL;
+                break;
+            }
+            for(size_t j = 0; j < sequenceLength; ++j)
+            {
+                utf7String[count++] = sequence[j];
+            }
+        }
+        if(!valid && (errorOffset == CodePage2Unicode::NO_ERROR_OFFSET))
+        {
+            errorOffset = i;
+        }
+        ++i;
+    }
+
+    ConversionResult objResult = { status, i, count, errorOffset };
+
+    return objResult;
+}
+
+/**
+ * Ends the UTF-7 stream, closing the base64 encoded characters.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	utf7String	receives the UTF-7 characters
+ * @param	utf7Room	the room for UTF-7 characters
+ * @return	the conversion status and the number of code units written
+ * @since	1.0
+ */
+ConversionResult Utf7Encoder::finish(char* utf7String, const size_t utf7Room)
+{
+    ConversionResult objResult = { ConversionStatus::OK, 0, 0, CodePage2Unicode::NO_ERROR_OFFSET };
+
+    if(m_inBase64)
+    {
+        // Pad the last 6 bits with zeros and end the base64 encoded characters with '-'
+        size_t count = (m_bitCount > 0) ? 2 : 1;
+        if(utf7Room < count)
+        {
+            objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
+
+            return objResult;
+        }
+        if(m_bitCount > 0)
+        {
+            utf7String[0] = m_pBase64Alphabet[(m_bits << (6 - m_bitCount)) & 0x3FU];
+        }
+        utf7String[count - 1] = '-';
+        objResult.written = count;
+        reset();
+    }
+
+    return objResult;
+}
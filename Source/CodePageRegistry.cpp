@@ -0,0 +1,799 @@
+/**
+ * CodePageRegistry.cpp
+ *
+ * ABSTRACT
+ *  Implementation of the registry of the single-byte and double-byte code pages loaded at run time, from binary table files
+ *  mapped read-only in memory and shared by all the processes that load them.
+ *
+ * CONTACTS
+ *  E-mail regarding any portion of the "CodePage2Unicode" project:
+ *      José Caetano Silva, jcaetano@users.sourceforge.net
+ *
+ * COPYRIGHT
+ *  This file is distributed under the terms of the GNU General Public
+ *  License (GPL) v3. Copies of the GPL can be obtained from:
+ *      ftp://prep.ai.mit.edu/pub/gnu/GPL
+ *  Each contributing author retains all rights to their own work.
+ *
+ *  (C) 20011 - 20015   José Caetano Silva
+ *
+ * HISTORY
+ *  2026-10-17: Created.
+ */
+
+#include "Include/StdAfx.h"
+
+#include "Include/CodePageRegistry.h"
+
+using namespace std;
+
+/* Registry */
+
+/**
+ * A table file mapped read-only in memory, so all the processes share the same physical pages.
+ * Without a memory mapping API the file is read to memory, and only shared between the threads.
+ */
+struct CodePageRegistry::MappedFile
+{
+    /**
+     * The file data.
+     */
+    const unsigned char* m_pData;
+
+    /**
+     * The file size in bytes.
+     */
+    size_t m_size;
+
+#if defined(__HAS_INCLUDE_WINDOWS)
+    /**
+     * The file mapping object.
+     */
+    HANDLE m_hMapping;
+#elif !defined(__HAS_INCLUDE_SYS_MMAN_H)
+    /**
+     * The file data read to memory.
+     */
+    vector<unsigned char> m_vecData;
+#endif
+
+    MappedFile() : m_pData(nullptr), m_size(0)
+#if defined(__HAS_INCLUDE_WINDOWS)
+        , m_hMapping(NULL)
+#endif
+    {
+
+    }
+
+    ~MappedFile()
+    {
+        if(m_pData == nullptr)
+        {
+            return;
+        }
+
+#if defined(__HAS_INCLUDE_WINDOWS)
+        UnmapViewOfFile(m_pData);
+        CloseHandle(m_hMapping);
+#elif defined(__HAS_INCLUDE_SYS_MMAN_H)
+        munmap(const_cast<unsigned char*>(m_pData), m_size);
+#endif
+    }
+
+    /**
+     * Maps a file read-only in memory.
+     *
+     * @param	path	the path of the file
+     * @return	'true' if the file was mapped, 'false' otherwise
+     */
+    bool mapFile(const string& path)
+    {
+#if defined(__HAS_INCLUDE_WINDOWS)
+        HANDLE hFile = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if(hFile == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if(!GetFileSizeEx(hFile, &fileSize) || (fileSize.QuadPart < (LONGLONG)sizeof(TableFileHeader)))
+        {
+            CloseHandle(hFile);
+            return false;
+        }
+
+        // The mapping keeps the file open
+        m_hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+        CloseHandle(hFile);
+        if(m_hMapping == NULL)
+        {
+            return false;
+        }
+
+        m_pData = static_cast<const unsigned char*>(MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0));
+        if(m_pData == nullptr)
+        {
+            CloseHandle(m_hMapping);
+            m_hMapping = NULL;
+            return false;
+        }
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+
+        return true;
+#elif defined(__HAS_INCLUDE_SYS_MMAN_H)
+        int file = open(path.c_str(), O_RDONLY);
+        if(file < 0)
+        {
+            return false;
+        }
+
+        struct stat fileStat;
+        if((fstat(file, &fileStat) != 0) || (fileStat.st_size < (off_t)sizeof(TableFileHeader)))
+        {
+            close(file);
+            return false;
+        }
+
+        // The mapping keeps the file referenced
+        void* pMapping = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_SHARED, file, 0);
+        close(file);
+        if(pMapping == MAP_FAILED)
+        {
+            return false;
+        }
+
+        m_pData = static_cast<const unsigned char*>(pMapping);
+        m_size = static_cast<size_t>(fileStat.st_size);
+
+        return true;
+#else
+        ifstream objFile(path.c_str(), ios::in | ios::binary);
+        m_vecData.assign(istreambuf_iterator<char>(objFile), istreambuf_iterator<char>());
+        if(!objFile.good() && !objFile.eof())
+        {
+            return false;
+        }
+        if(m_vecData.size() < sizeof(TableFileHeader))
+        {
+            return false;
+        }
+
+        m_pData = &m_vecData[0];
+        m_size = m_vecData.size();
+
+        return true;
+#endif
+    }
+};
+
+/**
+ * The loaded table files and code pages. The table files and the code page descriptors are only released
+ * when the process ends, so the handles stay valid after a code page is replaced.
+ */
+struct CodePageRegistry::RegistryState
+{
+#if defined(__HAS_INCLUDE_MUTEX)
+    /**
+     * Serializes the loads and lookups.
+     */
+    mutex m_mutex;
+#endif
+
+    /**
+     * The mapped table files.
+     */
+    vector<MappedFile*> m_vecFiles;
+
+    /**
+     * The descriptors of all the code pages loaded, in load order.
+     */
+    vector<CodePageMapping*> m_vecCodePages;
+
+    /**
+     * The registered code pages, by code page number.
+     */
+    map<unsigned int, CodePageHandle> m_mapCodePages;
+
+    ~RegistryState()
+    {
+        for(size_t i = 0; i < m_vecCodePages.size(); ++i)
+        {
+            delete m_vecCodePages[i];
+        }
+        for(size_t i = 0; i < m_vecFiles.size(); ++i)
+        {
+            delete m_vecFiles[i];
+        }
+    }
+};
+
+/**
+ * Gets the registry state, created on first use.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @return	the registry state
+ * @since	1.0
+ */
+CodePageRegistry::RegistryState& CodePageRegistry::getRegistryState(void)
+{
+    // Created on first use
+    static RegistryState objState;
+
+    return objState;
+}
+
+/**
+ * Parses an Unicode.org mapping file into an UTF-32 decoding table. Only the first two columns are read,
+ * the rest of the line after a '#' is a comment.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	mappingFile		the path of the mapping file
+ * @param	vecTable		receives the 65536 code points, by single-byte character or by double-byte character
+ *                          with the lead byte in the high byte, the unmapped ones as the replacement character
+ * @param	vecLeadBytes	receives the 256 flags of the lead bytes
+ * @return	'true' if the code page has double-byte characters, 'false' otherwise
+ * @since	1.0
+ */
+bool CodePageRegistry::parseMappingFile(const string& mappingFile, vector<char32_t>& vecTable, vector<bool>& vecLeadBytes)
+{
+    ifstream objFile(mappingFile.c_str());
+    if(!objFile.is_open())
+    {
+        throw runtime_error("Can't read the mapping file \"" + mappingFile + "\"");
+    }
+
+    const size_t tableSize = CodePage2Unicode::CODEPAGE_TABLE_SIZE;
+    vecTable.assign(tableSize * tableSize, (char32_t)CodePage2Unicode::UNICODE_REPLACEMENT_CHARACTER);
+    vecLeadBytes.assign(tableSize, false);
+
+    bool doubleByte = false;
+    string line;
+    size_t lineNumber = 0;
+    while(getline(objFile, line))
+    {
+        ++lineNumber;
+
+        // Strip the comment
+        string comment;
+        size_t commentStart = line.find('#');
+        if(commentStart != string::npos)
+        {
+            comment = line.substr(commentStart + 1);
+            line.erase(commentStart);
+        }
+
+        istringstream objLine(line);
+        string strCode;
+        string strCodePoint;
+        if(!(objLine >> strCode))
+        {
+            // Empty or comment line
+            continue;
+        }
+        objLine >> strCodePoint;
+
+        // A double-byte character has a lead byte of the extended range
+        char* pEnd = nullptr;
+        unsigned long code = strtoul(strCode.c_str(), &pEnd, 16);
+        bool valid = (strCode.size() > 2) && (strCode[0] == '0') && ((strCode[1] == 'x') || (strCode[1] == 'X')) &&
+                     (*pEnd == '\0') && ((code < tableSize) || ((code >= 0x8000UL) && (code <= 0xFFFFUL)));
+        unsigned long codePoint = CodePage2Unicode::UNICODE_REPLACEMENT_CHARACTER;
+        if(valid && !strCodePoint.empty())
+        {
+            // All the characters must be a single code point in the BMP, out of the surrogates
+            codePoint = strtoul(strCodePoint.c_str(), &pEnd, 16);
+            valid = (strCodePoint.size() > 2) && (strCodePoint[0] == '0') && ((strCodePoint[1] == 'x') || (strCodePoint[1] == 'X')) &&
+                    (*pEnd == '\0') && (codePoint <= CodePage2Unicode::UNICODE_MAXIMUM_BMP) &&
+                    ((codePoint < 0xD800UL) || (codePoint > 0xDFFFUL));
+        }
+        if(!valid)
+        {
+            ostringstream objMessage;
+            objMessage << "Invalid mapping at line " << lineNumber << " of the mapping file \"" << mappingFile << "\"";
+            throw runtime_error(objMessage.str());
+        }
+
+        if(code >= tableSize)
+        {
+            doubleByte = true;
+            vecLeadBytes[code >> 8] = true;
+        }
+        else if(strCodePoint.empty() && (comment.find("LEAD BYTE") != string::npos))
+        {
+            // A lead byte without defined characters
+            vecLeadBytes[code] = true;
+        }
+        vecTable[code] = (char32_t)codePoint;
+    }
+
+    return doubleByte;
+}
+
+/**
+ * Checks if a character takes the place of another one with the same code point in the encoding table.<br />
+ * The lowest character is kept, like in the Windows tables, except in Windows-950, where the Big5
+ * characters take the place of their lower compatibility duplicates, and in Windows-932, where the NEC
+ * selected IBM extensions (the 0xED and 0xEE lead bytes) give way to any other duplicate. The
+ * single-byte characters are always kept.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	codePage	the code page number
+ * @param	code		the higher character, by single-byte character or by double-byte character
+ * @param	mappedCode	the lower character already in the encoding table
+ * @return	'true' if the higher character takes the place of the lower one, 'false' otherwise
+ * @since	1.0
+ */
+bool CodePageRegistry::isDuplicatePreferred(const CodePage codePage, const size_t code, const size_t mappedCode)
+{
+    if(mappedCode < CodePage2Unicode::CODEPAGE_TABLE_SIZE)
+    {
+        // The single-byte characters take priority
+        return false;
+    }
+
+    switch(codePage)
+    {
+        case CodePage::WINDOWS_950:
+            // 0xA2CC and 0xA2CE duplicate 0xA451 and 0xA4CA, and 0xF9F9 - 0xF9FE some of the box drawings
+            return true;
+
+        case CodePage::WINDOWS_932:
+        {
+            size_t mappedLead = mappedCode >> 8;
+            size_t lead = code >> 8;
+
+            return ((mappedLead == 0xEDU) || (mappedLead == 0xEEU)) && (lead != 0xEDU) && (lead != 0xEEU);
+        }
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * Appends a table to the table file data, aligned to a cache line, so the lookups of a block never
+ * straddle two cache lines more than needed.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	vecData	the table file data
+ * @param	pTable	the table
+ * @param	size	the table size in bytes
+ * @return	the offset of the table from the start of the file
+ * @since	1.0
+ */
+uint32_t CodePageRegistry::appendTable(vector<unsigned char>& vecData, const void* pTable, const size_t size)
+{
+    vecData.resize((vecData.size() + TABLE_FILE_ALIGNMENT - 1) & ~(TABLE_FILE_ALIGNMENT - 1), 0);
+    uint32_t offset = static_cast<uint32_t>(vecData.size());
+    vecData.insert(vecData.end(), static_cast<const unsigned char*>(pTable), static_cast<const unsigned char*>(pTable) + size);
+
+    return offset;
+}
+
+/**
+ * Checks if a table lies entirely inside a table file, without wrapping around when the file is smaller
+ * than the table.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	offset		the offset of the table from the start of the file
+ * @param	tableSize	the table size in bytes
+ * @param	size		the table file size in bytes
+ * @return	'true' if the table is inside the file, 'false' otherwise
+ * @since	1.0
+ */
+bool CodePageRegistry::isTableInFile(const size_t offset, const size_t tableSize, const size_t size)
+{
+    return (tableSize <= size) && (offset <= size - tableSize);
+}
+
+/**
+ * Validates the header, the directory and the table offsets of a table file mapped in memory, so a
+ * truncated or corrupted file can't make the conversions read out of the mapping.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	pData	the table file data
+ * @param	size	the table file size in bytes
+ * @return	'true' if the table file is valid, 'false' otherwise
+ * @since	1.0
+ */
+bool CodePageRegistry::isTableFileValid(const unsigned char* pData, const size_t size)
+{
+    const TableFileHeader* pHeader = reinterpret_cast<const TableFileHeader*>(pData);
+    if((size < sizeof(TableFileHeader)) ||
+       (pHeader->magic != TABLE_FILE_MAGIC) ||
+       (pHeader->version != TABLE_FILE_VERSION) ||
+       (pHeader->byteOrder != TABLE_FILE_BYTE_ORDER) ||
+       (pHeader->fileSize != size) ||
+       (pHeader->entryCount > (size - sizeof(TableFileHeader)) / sizeof(TableFileEntry)))
+    {
+        return false;
+    }
+
+    const TableFileEntry* pEntries = reinterpret_cast<const TableFileEntry*>(pData + sizeof(TableFileHeader));
+    for(size_t i = 0; i < pHeader->entryCount; ++i)
+    {
+        const TableFileEntry& objEntry = pEntries[i];
+        const size_t tableSize = CodePage2Unicode::CODEPAGE_TABLE_SIZE;
+        const bool doubleByte = (objEntry.flags & TABLE_FILE_DOUBLE_BYTE) != 0;
+        const size_t leafSize = tableSize * (doubleByte ? sizeof(uint16_t) : sizeof(unsigned char));
+        if((memchr(objEntry.name, '\0', TABLE_FILE_NAME_SIZE) == nullptr) ||
+           (objEntry.leafCount == 0) || (objEntry.leafCount > tableSize) ||
+           ((objEntry.utf32Offset | objEntry.utf16Offset | objEntry.utf8Offset | objEntry.leavesOffset) % TABLE_FILE_ALIGNMENT != 0) ||
+           !isTableInFile(objEntry.utf32Offset, tableSize * sizeof(char32_t), size) ||
+           !isTableInFile(objEntry.utf16Offset, tableSize * sizeof(char16_t), size) ||
+           !isTableInFile(objEntry.utf8Offset, tableSize * 4, size) ||
+           !isTableInFile(objEntry.rootsOffset, tableSize, size) ||
+           !isTableInFile(objEntry.leavesOffset, objEntry.leafCount * leafSize, size))
+        {
+            return false;
+        }
+
+        // The lookups index the leaves by the roots and the UTF-8 copies by the sequence length
+        for(size_t j = 0; j < tableSize; ++j)
+        {
+            if((pData[objEntry.rootsOffset + j] >= objEntry.leafCount) ||
+               (pData[objEntry.utf8Offset + 4 * j + 3] > 3))
+            {
+                return false;
+            }
+        }
+
+        if(doubleByte)
+        {
+            // The double-byte characters index the trail blocks by the lead byte
+            if((objEntry.trailBlockCount == 0) || (objEntry.trailBlockCount > tableSize) ||
+               ((objEntry.leadBytesOffset | objEntry.trailIndexesOffset | objEntry.trailBlocksOffset) % TABLE_FILE_ALIGNMENT != 0) ||
+               !isTableInFile(objEntry.leadBytesOffset, tableSize / 8, size) ||
+               !isTableInFile(objEntry.trailIndexesOffset, tableSize * sizeof(uint16_t), size) ||
+               !isTableInFile(objEntry.trailBlocksOffset, objEntry.trailBlockCount * tableSize * sizeof(char16_t), size))
+            {
+                return false;
+            }
+
+            const uint16_t* pTrailIndexes = reinterpret_cast<const uint16_t*>(pData + objEntry.trailIndexesOffset);
+            for(size_t j = 0; j < tableSize; ++j)
+            {
+                if(pTrailIndexes[j] >= objEntry.trailBlockCount)
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Compiles Unicode.org mapping files to a binary table file, that can be loaded by 'loadTableFile'.<br />
+ * Each mapping file has a line by character, with the character and its Unicode code point in hex
+ * ("0x80	0x00C7	#LATIN CAPITAL LETTER C WITH CEDILLA", or "0x8140	0x3000	#IDEOGRAPHIC SPACE" for a
+ * double-byte character), the characters not listed or without code point are undefined. The lead bytes
+ * are the ones of the double-byte characters, or the ones commented as "DBCS LEAD BYTE". The code page
+ * name is the mapping file name without the extension.<br />
+ * The table file is written to a temporary file and renamed, so the processes that have the previous
+ * one mapped keep their tables unchanged.<br />
+ * Throws a 'runtime_error' if a file can't be read or written, or a mapping file is invalid.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	vecMappingFiles	the code page numbers and the paths of their mapping files
+ * @param	tableFile		the path of the table file to be written
+ * @since	1.0
+ */
+void CodePageRegistry::compileTableFile(const vector<pair<CodePage, string> >& vecMappingFiles, const string& tableFile)
+{
+    const size_t tableSize = CodePage2Unicode::CODEPAGE_TABLE_SIZE;
+
+    // The directory is followed by the tables of each code page
+    vector<unsigned char> vecData(sizeof(TableFileHeader) + vecMappingFiles.size() * sizeof(TableFileEntry), 0);
+    vector<TableFileEntry> vecEntries(vecMappingFiles.size());
+    vector<char32_t> vecTable;
+    vector<bool> vecLeadBytes;
+    for(size_t i = 0; i < vecMappingFiles.size(); ++i)
+    {
+        const string& mappingFile = vecMappingFiles[i].second;
+        bool doubleByte = parseMappingFile(mappingFile, vecTable, vecLeadBytes);
+
+        // The name is the file name without the path and the extension
+        size_t nameStart = mappingFile.find_last_of("/\\");
+        nameStart = (nameStart == string::npos) ? 0 : nameStart + 1;
+        size_t nameEnd = mappingFile.find('.', nameStart);
+        string name = mappingFile.substr(nameStart, (nameEnd == string::npos) ? string::npos : nameEnd - nameStart);
+        if(name.empty() || (name.size() >= TABLE_FILE_NAME_SIZE))
+        {
+            throw runtime_error("Invalid code page name of the mapping file \"" + mappingFile + "\"");
+        }
+
+        TableFileEntry& objEntry = vecEntries[i];
+        memset(&objEntry, 0, sizeof(TableFileEntry));
+        objEntry.codePage = static_cast<uint32_t>(vecMappingFiles[i].first);
+        memcpy(objEntry.name, name.c_str(), name.size());
+        objEntry.flags = TABLE_FILE_ASCII_IDENTITY | (doubleByte ? TABLE_FILE_DOUBLE_BYTE : 0);
+
+        // Decoding tables of the single-byte characters, the lead bytes alone are invalid
+        char32_t arrUtf32Table[CodePage2Unicode::CODEPAGE_TABLE_SIZE];
+        char16_t arrUtf16Table[CodePage2Unicode::CODEPAGE_TABLE_SIZE];
+        unsigned char arrUtf8Table[CodePage2Unicode::CODEPAGE_TABLE_SIZE][4];
+        memset(arrUtf8Table, 0, sizeof(arrUtf8Table));
+        for(size_t code = 0; code < tableSize; ++code)
+        {
+            char32_t charUtf32 = vecLeadBytes[code] ? (char32_t)CodePage2Unicode::UNICODE_REPLACEMENT_CHARACTER : vecTable[code];
+            if((code < 0x80) && (charUtf32 != (char32_t)code))
+            {
+                objEntry.flags &= ~TABLE_FILE_ASCII_IDENTITY;
+            }
+
+            arrUtf32Table[code] = charUtf32;
+            arrUtf16Table[code] = static_cast<char16_t>(charUtf32);
+
+            unsigned char* pSequence = arrUtf8Table[code];
+            if(charUtf32 < 0x80)
+            {
+                pSequence[0] = static_cast<unsigned char>(charUtf32);
+                pSequence[3] = 1;
+            }
+            else if(charUtf32 < 0x800)
+            {
+                pSequence[0] = static_cast<unsigned char>(CodePage2Unicode::UTF8_LEAD_BYTES2 | (charUtf32 >> CodePage2Unicode::UTF8_HALF_SHIFT));
+                pSequence[1] = static_cast<unsigned char>(CodePage2Unicode::UTF8_NEXT | (charUtf32 & CodePage2Unicode::UTF8_NEXT_MASK));
+                pSequence[3] = 2;
+            }
+            else
+            {
+                pSequence[0] = static_cast<unsigned char>(CodePage2Unicode::UTF8_LEAD_BYTES3 | (charUtf32 >> (2 * CodePage2Unicode::UTF8_HALF_SHIFT)));
+                pSequence[1] = static_cast<unsigned char>(CodePage2Unicode::UTF8_NEXT | ((charUtf32 >> CodePage2Unicode::UTF8_HALF_SHIFT) & CodePage2Unicode::UTF8_NEXT_MASK));
+                pSequence[2] = static_cast<unsigned char>(CodePage2Unicode::UTF8_NEXT | (charUtf32 & CodePage2Unicode::UTF8_NEXT_MASK));
+                pSequence[3] = 3;
+            }
+        }
+
+        // Encoding table, a two-level page table over the BMP like the built in code pages, the
+        // single-byte characters first so they take priority over the double-byte duplicates
+        unsigned char arrRoots[CodePage2Unicode::CODEPAGE_TABLE_SIZE];
+        memset(arrRoots, 0, sizeof(arrRoots));
+        vector<uint16_t> vecLeaves(tableSize, 0);
+        size_t codeCount = doubleByte ? tableSize * tableSize : tableSize;
+        for(size_t code = 0; code < codeCount; ++code)
+        {
+            char32_t charUtf32 = (code < tableSize) ? arrUtf32Table[code] : vecTable[code];
+            if((charUtf32 == (char32_t)0) || (charUtf32 == (char32_t)CodePage2Unicode::UNICODE_REPLACEMENT_CHARACTER) ||
+               ((code >= tableSize) && !vecLeadBytes[code >> 8]))
+            {
+                // U+0000 is implicit and undefined characters aren't mapped back
+                continue;
+            }
+
+            size_t leaf = arrRoots[charUtf32 >> 8];
+            if(leaf == 0)
+            {
+                // Allocate a new leaf
+                leaf = vecLeaves.size() / tableSize;
+                if(leaf >= tableSize)
+                {
+                    throw runtime_error("Too many code point blocks in the mapping file \"" + mappingFile + "\"");
+                }
+                vecLeaves.resize(vecLeaves.size() + tableSize, 0);
+                arrRoots[charUtf32 >> 8] = (unsigned char)leaf;
+            }
+
+            // On duplicates keep the preferred character of the code page
+            uint16_t& entry = vecLeaves[(leaf << 8) | (charUtf32 & 0xFF)];
+            if((entry == 0) || isDuplicatePreferred(vecMappingFiles[i].first, code, entry))
+            {
+                entry = (uint16_t)code;
+            }
+        }
+
+        // Append the tables
+        objEntry.utf32Offset = appendTable(vecData, arrUtf32Table, sizeof(arrUtf32Table));
+        objEntry.utf16Offset = appendTable(vecData, arrUtf16Table, sizeof(arrUtf16Table));
+        objEntry.utf8Offset = appendTable(vecData, arrUtf8Table, sizeof(arrUtf8Table));
+        objEntry.rootsOffset = appendTable(vecData, arrRoots, sizeof(arrRoots));
+        objEntry.leafCount = static_cast<uint32_t>(vecLeaves.size() / tableSize);
+        if(doubleByte)
+        {
+            objEntry.leavesOffset = appendTable(vecData, &vecLeaves[0], vecLeaves.size() * sizeof(uint16_t));
+        }
+        else
+        {
+            // The single-byte characters fit a byte
+            vector<unsigned char> vecByteLeaves(vecLeaves.begin(), vecLeaves.end());
+            objEntry.leavesOffset = appendTable(vecData, &vecByteLeaves[0], vecByteLeaves.size());
+        }
+
+        if(doubleByte)
+        {
+            // Lead bytes bitmap and a trail block of each lead byte, after the empty block 0
+            uint32_t arrLeadBytes[CodePage2Unicode::CODEPAGE_TABLE_SIZE / 32];
+            uint16_t arrTrailIndexes[CodePage2Unicode::CODEPAGE_TABLE_SIZE];
+            memset(arrLeadBytes, 0, sizeof(arrLeadBytes));
+            memset(arrTrailIndexes, 0, sizeof(arrTrailIndexes));
+            vector<char16_t> vecTrailBlocks(tableSize, (char16_t)CodePage2Unicode::UNICODE_REPLACEMENT_CHARACTER);
+            for(size_t lead = 0; lead < tableSize; ++lead)
+            {
+                if(!vecLeadBytes[lead])
+                {
+                    continue;
+                }
+
+                arrLeadBytes[lead >> 5] |= (uint32_t)1 << (lead & 31);
+                arrTrailIndexes[lead] = static_cast<uint16_t>(vecTrailBlocks.size() / tableSize);
+                for(size_t trail = 0; trail < tableSize; ++trail)
+                {
+                    vecTrailBlocks.push_back(static_cast<char16_t>(vecTable[(lead << 8) | trail]));
+                }
+            }
+
+            objEntry.leadBytesOffset = appendTable(vecData, arrLeadBytes, sizeof(arrLeadBytes));
+            objEntry.trailIndexesOffset = appendTable(vecData, arrTrailIndexes, sizeof(arrTrailIndexes));
+            objEntry.trailBlocksOffset = appendTable(vecData, &vecTrailBlocks[0], vecTrailBlocks.size() * sizeof(char16_t));
+            objEntry.trailBlockCount = static_cast<uint32_t>(vecTrailBlocks.size() / tableSize);
+        }
+    }
+
+    TableFileHeader objHeader;
+    objHeader.magic = TABLE_FILE_MAGIC;
+    objHeader.version = TABLE_FILE_VERSION;
+    objHeader.byteOrder = TABLE_FILE_BYTE_ORDER;
+    objHeader.entryCount = static_cast<uint32_t>(vecEntries.size());
+    objHeader.fileSize = static_cast<uint32_t>(vecData.size());
+    memcpy(&vecData[0], &objHeader, sizeof(TableFileHeader));
+    if(!vecEntries.empty())
+    {
+        memcpy(&vecData[sizeof(TableFileHeader)], &vecEntries[0], vecEntries.size() * sizeof(TableFileEntry));
+    }
+
+    // Replace the table file at once, never overwrite a mapped one
+    string temporaryFile = tableFile + ".tmp";
+    {
+        ofstream objFile(temporaryFile.c_str(), ios::out | ios::binary | ios::trunc);
+        objFile.write(reinterpret_cast<const char*>(&vecData[0]), static_cast<streamsize>(vecData.size()));
+        objFile.close();
+        if(objFile.fail())
+        {
+            remove(temporaryFile.c_str());
+            throw runtime_error("Can't write the table file \"" + tableFile + "\"");
+        }
+    }
+#if defined(__HAS_INCLUDE_WINDOWS)
+    // The rename doesn't replace an existing file on Windows
+    remove(tableFile.c_str());
+#endif
+    if(rename(temporaryFile.c_str(), tableFile.c_str()) != 0)
+    {
+        remove(temporaryFile.c_str());
+        throw runtime_error("Can't write the table file \"" + tableFile + "\"");
+    }
+}
+
+/**
+ * Loads a binary table file, mapping it read-only in memory, and registers all its code pages.<br />
+ * A code page already registered is replaced for the next lookups, but its handles stay valid.<br />
+ * Throws a 'runtime_error' if the file can't be mapped or isn't a valid table file.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	tableFile	the path of the table file
+ * @return	the number of code pages registered
+ * @since	1.0
+ */
+size_t CodePageRegistry::loadTableFile(const string& tableFile)
+{
+    MappedFile* pFile = new MappedFile();
+    if(!pFile->mapFile(tableFile))
+    {
+        delete pFile;
+        throw runtime_error("Can't map the table file \"" + tableFile + "\"");
+    }
+    if(!isTableFileValid(pFile->m_pData, pFile->m_size))
+    {
+        delete pFile;
+        throw runtime_error("Invalid table file \"" + tableFile + "\"");
+    }
+
+    const unsigned char* pData = pFile->m_pData;
+    const TableFileHeader* pHeader = reinterpret_cast<const TableFileHeader*>(pData);
+    const TableFileEntry* pEntries = reinterpret_cast<const TableFileEntry*>(pData + sizeof(TableFileHeader));
+
+    RegistryState& objState = getRegistryState();
+#if defined(__HAS_INCLUDE_MUTEX)
+    lock_guard<mutex> objLock(objState.m_mutex);
+#endif
+    objState.m_vecFiles.push_back(pFile);
+    for(size_t i = 0; i < pHeader->entryCount; ++i)
+    {
+        const TableFileEntry& objEntry = pEntries[i];
+        const bool doubleByte = (objEntry.flags & TABLE_FILE_DOUBLE_BYTE) != 0;
+
+        // Only the descriptor is allocated, all the tables point to the mapping
+        CodePageMapping* pCodePage = new CodePageMapping();
+        pCodePage->codePage = static_cast<CodePage>(objEntry.codePage);
+        pCodePage->name = objEntry.name;
+        pCodePage->asciiIdentity = (objEntry.flags & TABLE_FILE_ASCII_IDENTITY) != 0;
+        pCodePage->doubleByte = doubleByte;
+        pCodePage->utf32Table = reinterpret_cast<const char32_t*>(pData + objEntry.utf32Offset);
+        pCodePage->utf16Table = reinterpret_cast<const char16_t*>(pData + objEntry.utf16Offset);
+        pCodePage->utf8Table = reinterpret_cast<const unsigned char (*)[4]>(pData + objEntry.utf8Offset);
+        pCodePage->leadBytes = doubleByte ? reinterpret_cast<const uint32_t*>(pData + objEntry.leadBytesOffset) : nullptr;
+        pCodePage->trailIndexes = doubleByte ? reinterpret_cast<const uint16_t*>(pData + objEntry.trailIndexesOffset) : nullptr;
+        pCodePage->trailBlocks = doubleByte ? reinterpret_cast<const char16_t*>(pData + objEntry.trailBlocksOffset) : nullptr;
+        pCodePage->encodingRoots = pData + objEntry.rootsOffset;
+        pCodePage->encodingLeaves = doubleByte ? nullptr : pData + objEntry.leavesOffset;
+        pCodePage->encodingDoubleLeaves = doubleByte ? reinterpret_cast<const uint16_t*>(pData + objEntry.leavesOffset) : nullptr;
+
+        objState.m_vecCodePages.push_back(pCodePage);
+        objState.m_mapCodePages[objEntry.codePage] = pCodePage;
+    }
+
+    return pHeader->entryCount;
+}
+
+/**
+ * Gets the handle of a registered code page.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	codePage	the code page number
+ * @return	the code page handle, or 'nullptr' if the code page isn't registered
+ * @since	1.0
+ */
+CodePageHandle CodePageRegistry::getCodePage(const CodePage codePage)
+{
+    RegistryState& objState = getRegistryState();
+#if defined(__HAS_INCLUDE_MUTEX)
+    lock_guard<mutex> objLock(objState.m_mutex);
+#endif
+    map<unsigned int, CodePageHandle>::const_iterator it = objState.m_mapCodePages.find(static_cast<unsigned int>(codePage));
+
+    return (it != objState.m_mapCodePages.end()) ? it->second : nullptr;
+}
+
+/**
+ * Gets the handle of a registered code page by its name, or by any charset name of its number
+ * known to 'CodePage2Unicode::getCodePageFromCharsetName'. The last code page loaded with the
+ * name takes priority.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @param	name	the code page name, like "CP869" or "ibm869" (case insensitive)
+ * @return	the code page handle, or 'nullptr' if the code page isn't registered
+ * @since	1.0
+ */
+CodePageHandle CodePageRegistry::getCodePage(const char* name)
+{
+    if(name == nullptr)
+    {
+        return nullptr;
+    }
+
+    {
+        RegistryState& objState = getRegistryState();
+#if defined(__HAS_INCLUDE_MUTEX)
+        lock_guard<mutex> objLock(objState.m_mutex);
+#endif
+        for(size_t i = objState.m_vecCodePages.size(); i > 0; --i)
+        {
+            const char* pName = objState.m_vecCodePages[i - 1]->name;
+            size_t j = 0;
+            while((pName[j] != '\0') && (tolower((unsigned char)pName[j]) == tolower((unsigned char)name[j])))
+            {
+                ++j;
+            }
+            if((pName[j] == '\0') && (name[j] == '\0'))
+            {
+                return objState.m_vecCodePages[i - 1];
+            }
+        }
+    }
+
+    CodePage codePage = CodePage2Unicode::getCodePageFromCharsetName(name);
+
+    return (codePage != CodePage::UNKNOWN) ? getCodePage(codePage) : nullptr;
+}
@@ -70,7 +70,7 @@ using namespace std;
 	 */
     DOS_CP850 = 850, 
 	/**
-	 *  CP851: IBM/OEM/MS-DOS Greek 1
+	 *  CP851: IBM/OEM/MS-DOS Greek 1 (no built in map, loaded by the 'CodePageRegistry')
 	 */
 	DOS_CP851 = 851, 
 	/**
@@ -86,7 +86,7 @@ using namespace std;
 	 */
     DOS_CP860 = 860, 
 	/**
-	 *  CP869: IBM/OEM/MS-DOS Greek 2
+	 *  CP869: IBM/OEM/MS-DOS Greek 2 (no built in map, loaded by the 'CodePageRegistry')
 	 */
 	DOS_CP869 = 869, 
 	/**
@@ -105,6 +105,22 @@ using namespace std;
 	 *  Windows-1253: Windows ANSI Greek + €
 	 */
     WINDOWS_1253 = 1253, 
+	/**
+	 *  Windows-932: Windows ANSI/OEM Japanese, Shift_JIS (double-byte, loaded by the 'CodePageRegistry')
+	 */
+    WINDOWS_932 = 932, 
+	/**
+	 *  Windows-936: Windows ANSI/OEM Simplified Chinese, GBK (double-byte, loaded by the 'CodePageRegistry')
+	 */
+    WINDOWS_936 = 936, 
+	/**
+	 *  Windows-949: Windows ANSI/OEM Korean, Unified Hangul Code/EUC-KR (double-byte, loaded by the 'CodePageRegistry')
+	 */
+    WINDOWS_949 = 949, 
+	/**
+	 *  Windows-950: Windows ANSI/OEM Traditional Chinese, Big5 (double-byte, loaded by the 'CodePageRegistry')
+	 */
+    WINDOWS_950 = 950, 
 	/**
 	 *  ISO-8859-1: ISO/IEC Latin 1/Western European
 	 */
@@ -117,6 +133,22 @@ using namespace std;
 	 *  ISO-8859-15: ISO/IEC Latin 9/Western European + Finnish + French + €
 	 */
     ISO_8859_15 = 28605, 
+	/**
+	 *  CP037: IBM EBCDIC US/Canada, the same characters as ISO-8859-1 in another order
+	 */
+    EBCDIC_CP037 = 37, 
+	/**
+	 *  CP500: IBM EBCDIC International, the same characters as ISO-8859-1 in another order
+	 */
+    EBCDIC_CP500 = 500, 
+	/**
+	 *  CP875: IBM EBCDIC Greek
+	 */
+    EBCDIC_CP875 = 875, 
+	/**
+	 *  CP1047: IBM EBCDIC Open Systems Latin 1 (z/OS UNIX), the same characters as ISO-8859-1 in another order
+	 */
+    EBCDIC_CP1047 = 1047, 
 	/**
 	 *  UCS-2: Unicode (2 bytes Universal Character Set), maps to UTF-16 BMP (Basic Multilingual Plane)
 	 */
@@ -143,6 +175,184 @@ using namespace std;
 	UTF_32 = 12000
 };
 
+/**
+ * Defines how the encoders handle Unicode characters that can't be represented in the
+ * destination code page.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+#ifdef __cpp_strong_enums
+    // C++11 standard compliment
+    enum class UnmappableAction : unsigned int
+#else
+    // Not C++11 standard compliment
+    enum UnmappableAction
+#endif
+{
+	/**
+	 *  Replaces the unmappable character with the replacement character
+	 */
+	REPLACE = 0, 
+	/**
+	 *  Drops the unmappable character from the encoded string
+	 */
+	SKIP = 1, 
+	/**
+	 *  Throws an exception on the first unmappable character
+	 */
+	STRICT = 2
+};
+
+/**
+ * Defines the outcome of the conversions between code unit buffers.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+#ifdef __cpp_strong_enums
+    // C++11 standard compliment
+    enum class ConversionStatus : unsigned int
+#else
+    // Not C++11 standard compliment
+    enum ConversionStatus
+#endif
+{
+	/**
+	 *  All the input was converted
+	 */
+	OK = 0, 
+	/**
+	 *  The output buffer is full, the conversion can be resumed from the consumed input
+	 */
+	OUTPUT_TOO_SMALL = 1, 
+	/**
+	 *  The input ends in the middle of a multi code unit sequence
+	 */
+	INCOMPLETE_SEQUENCE = 2, 
+	/**
+	 *  A code unit that can't start a sequence (an UTF-8 next code unit or an UTF-16 low surrogate)
+	 */
+	INVALID_LEAD_UNIT = 3, 
+	/**
+	 *  A sequence lead that isn't followed by the expected code units
+	 */
+	INVALID_SEQUENCE = 4, 
+	/**
+	 *  A code point that isn't an Unicode interchange character or that can't be encoded
+	 */
+	INVALID_CODE_POINT = 5, 
+	/**
+	 *  A character that can't be represented in the destination code page
+	 */
+	UNMAPPABLE_CHARACTER = 6, 
+	/**
+	 *  The code page isn't supported by the conversion
+	 */
+	UNSUPPORTED_CODE_PAGE = 7
+};
+
+/**
+ * Holds the outcome of a conversion between code unit buffers.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+struct ConversionResult
+{
+	/**
+	 *  The conversion status, 'ConversionStatus::OK' if all the input was converted
+	 */
+	ConversionStatus status;
+	/**
+	 *  The number of input code units converted, where a stopped conversion can be resumed
+	 */
+	size_t consumed;
+	/**
+	 *  The number of output code units written
+	 */
+	size_t written;
+	/**
+	 *  The offset of the first invalid input code unit (replaced, unless the conversion is strict),
+	 *  or 'CodePage2Unicode::NO_ERROR_OFFSET' if none was found
+	 */
+	size_t errorOffset;
+};
+
+/**
+ * Holds the encoding detected at the start of a byte buffer.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+struct EncodingDetectionResult
+{
+	/**
+	 *  The detected code page: 'UTF_7', 'UTF_8', 'UTF_16' or 'UTF_32' from a BOM, 'UTF_8' or 'US_ASCII'
+	 *  from the UTF-8 validation, or 'UNKNOWN' if the buffer isn't UTF-8 and has no BOM
+	 */
+	CodePage codePage;
+	/**
+	 *  The length in bytes of the BOM, where the payload starts
+	 */
+	size_t headerLength;
+	/**
+	 *  'true' if the UTF-16 or UTF-32 code units are big endian, 'false' otherwise
+	 */
+	bool bigEndian;
+};
+
+/**
+ * Holds a candidate 8-bit code page of the statistical code page detection.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+struct CodePageCandidate
+{
+	/**
+	 *  The candidate code page
+	 */
+	CodePage codePage;
+	/**
+	 *  How well the extended ASCII characters fit the code page model, from 0.0 (not at all) to 1.0
+	 *  (only the most frequent letters)
+	 */
+	double confidence;
+};
+
+/**
+ * A single-byte or double-byte code page loaded at run time by the 'CodePageRegistry', defined in "CodePageRegistry.h".
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+struct CodePageMapping;
+
+/**
+ * Opaque handle of a code page loaded by the 'CodePageRegistry', accepted in place of a 'CodePage' by the
+ * buffer conversions.
+ */
+typedef const CodePageMapping* CodePageHandle;
+
+/**
+ * Compile time properties of an 8-bit code page, specialized for each code page with a map in
+ * "CodePageTraits.h": if it's ASCII compatible, the extended ASCII range mapped to the same code points,
+ * the base table and the patches over it.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+template<CodePage CP>
+struct CodePageTraits;
+
 /**
  * Implements the necessary functionality to convert strings from/to ASCII, UTF-8, UTF-16,
  * UTF-32.
@@ -153,6 +363,25 @@ using namespace std;
  */
 class CodePage2Unicode
 {
+    /**
+     * The incremental decoders share the UTF-8 sequence rules and the special characters.
+     */
+    friend class Utf8Decoder;
+    friend class Utf7Decoder;
+    friend class Utf7Encoder;
+    friend class SbcsEncoder;
+
+    /**
+     * The code page registry builds the tables of the code pages loaded at run time the same way.
+     */
+    friend class CodePageRegistry;
+
+    /**
+     * The code page traits point to the code page maps.
+     */
+    template<CodePage CP>
+    friend struct CodePageTraits;
+
 private:
     /* Unicode UTF BOMs (Byte Order Markers) */
 
@@ -461,1513 +690,3772 @@ private:
     // static const char32_t m_arrISO_8859_15[128];
 
     /**
-     * Converts a 7-bit ISO/ANSI ASCII character to the equivalent UTF-32 code point.
+     * EBCDIC code page IBM 037: EBCDIC US/Canada, all the 256 characters.<br />
+     * Suitable for writing in: Latin-1, Western Europe, English, etc. .<br />
+     * Script:	Latin<br />
+     * IANA/MIME: IBM037, cp037, ebcdic-cp-us<br />
+     * C/C++ locale options: <br />
+     * Win32 CP: 37
+     */
+    static const char32_t m_arrEBCDIC_CP037[256];
+
+    /**
+     * EBCDIC code page IBM 500: EBCDIC International, all the 256 characters.<br />
+     * Suitable for writing in: Latin-1, Western Europe, etc. .<br />
+     * Script:	Latin<br />
+     * IANA/MIME: IBM500, cp500, ebcdic-cp-be, ebcdic-cp-ch<br />
+     * C/C++ locale options: <br />
+     * Win32 CP: 500
+     */
+    static const char32_t m_arrEBCDIC_CP500[256];
+
+    /**
+     * EBCDIC code page IBM 875: EBCDIC Greek, all the 256 characters.<br />
+     * Suitable for writing in: Greek, English, etc. .<br />
+     * Script:	Greek<br />
+     * IANA/MIME: IBM875, cp875<br />
+     * C/C++ locale options: <br />
+     * Win32 CP: 875
+     */
+    static const char32_t m_arrEBCDIC_CP875[256];
+
+    /**
+     * EBCDIC code page IBM 1047: EBCDIC Open Systems Latin-1, all the 256 characters.<br />
+     * Suitable for writing in: Latin-1, Western Europe, etc. .<br />
+     * Script:	Latin<br />
+     * IANA/MIME: IBM1047, cp1047<br />
+     * C/C++ locale options: <br />
+     * Win32 CP: 1047 (20924 with €)
+     */
+    static const char32_t m_arrEBCDIC_CP1047[256];
+
+
+    /* Flattened 8-bit Code Page Maps to Unicode */
+
+    /**
+     * Number of entries of a flattened 8-bit code page decoding table (one for each byte value).
+     */
+    static const size_t CODEPAGE_TABLE_SIZE = 256;
+
+    /**
+     * Number of flattened decoding tables: one for each 8-bit code page with a map, plus one
+     * shared by the code pages without a map (decoded as 7-bit ASCII).
+     */
+    static const size_t CODEPAGE_TABLE_COUNT = 19;
+
+    /**
+     * The code pages of the flattened decoding tables, in table index order
+     * (the table 0 is for the code pages without a map).
+     */
+    static const CodePage m_arrTableCodePages[CODEPAGE_TABLE_COUNT];
+
+    /**
+     * Flattened 8-bit code page decoding tables, with the 7-bit ASCII and the extended ASCII
+     * halves already resolved, so the decoding of a character is a single indexed load.
+     * Built once, on first use.
+     */
+    struct CodePageTables;
+
+    /**
+     * Gets the flattened 8-bit code page decoding tables.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [0; 127] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @return	the flattened decoding tables
      * @since	1.0
      */
-    inline static char32_t convertASCII_To_Unicode(const char narrowChar)
-    {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
-
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 0) && (code <= 127));
-#endif
-
-        return code;
-    }
+    static const CodePageTables& getCodePageTables(void);
 
     /**
-     * Converts a 7-bit MS-DOS/Windows ASCII (width extensions) character to
-     * the equivalent UTF-32 code point.
+     * Gets the index of the flattened decoding table of a given code page.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [0; 127] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @param	codePage	the code page from CodePage enumeration
+     * @return	the index of the code page table, or 0 if the code page doesn't have a map
      * @since	1.0
      */
-    inline static char32_t convertDOS_ASCII_To_Unicode(const char narrowChar)
-    {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
-
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 0) && (code <= 127));
-#endif
-
-        if(((code >= 0) && (code <= 31)) || (code == 127))
-        {
-            // 7-bit MS-DOS/Windows ASCII (width extensions)
-            return m_arrDOS_ASCII[code];
-        }
-        // else
-        return code;
-    }
+    static size_t getCodePageTableIndex(const CodePage codePage);
 
     /**
-     * Converts a 7-bit Apple Macintosh ASCII (width extensions) character to
-     * the equivalent UTF-32 code point.
+     * Converts an 8-bit extended ASCII character from a given code page to the equivalent UTF-32 code point,
+     * walking the code page maps. Only used to build the flattened decoding tables.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [0; 127] to be converted
+     * @param	narrowChar			the ASCII character [0; 255] to be converted
+     * @param	codePage			the code page from CodePage enumeration that the narrow character belongs to
+     * @param	convertAsciiControl	if 'true', also converts ASCII control codes [0; 31, 127] to Unicode
      * @return	the equivalent UTF-32 code point
      * @since	1.0
      */
-    inline static char32_t convertMac_ASCII_To_Unicode(const char narrowChar)
-    {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
-
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 0) && (code <= 127));
-#endif
+    static char32_t decodeCharAscii(const char narrowChar, const CodePage codePage, const bool convertAsciiControl);
 
-        if((code >= 17) && (code <= 20))
-        {
-            // 7-bit Apple Macintosh ASCII (width extensions)
-            switch(code)
-            {
-                case 17:
-                    // "⌘" - Command key
-                    return (char32_t)0x2318;
-                    break;
+    /* 8-bit Code Page Detection */
 
-                case 18:
-                    // "⇧" - Shift key
-                    return (char32_t)0x21E7;
-                    break;
+    /**
+     * Number of 8-bit code pages told apart by the statistical code page detection.
+     */
+    static const size_t DETECTION_CODEPAGE_COUNT = 11;
 
-                case 19:
-                    // "⌥"  - Option key
-                    return (char32_t)0x2325;
-                    break;
+    /**
+     * The code pages of the statistical code page detection, by preference order of the candidates
+     * with the same score.
+     */
+    static const CodePage m_arrDetectionCodePages[DETECTION_CODEPAGE_COUNT];
 
-                case 20:
-                    // "⎈" - Control key
-                    return (char32_t)0x2388;
-                    break;
-            }
-            // return (m_arrMac_ASCII[code]);
-        }
-        // else
-        return code;
-    }
+    /**
+     * Size in bytes of each sample of a large input to the statistical code page detection.
+     */
+    static const size_t DETECTION_SAMPLE_SIZE = 4096;
 
-	/**
-     * Converts a 8-bit IBM/OEM/MS-DOS extended ASCII character from code page 367 to
-     * the equivalent UTF-32 code point.
+    /**
+     * Number of evenly spaced samples of a large input to the statistical code page detection
+     * (the inputs up to the size of all the samples are fully scanned).
+     */
+    static const size_t DETECTION_SAMPLE_COUNT = 64;
+
+    /**
+     * Weight of the most frequent letters in the code page models, the confidence of a code page is
+     * the average weight of the extended ASCII characters relative to it.
+     */
+    static const int DETECTION_MAXIMUM_WEIGHT = 16;
+
+    /**
+     * Letter frequency and box drawing range models of the detected code pages, with the weight of
+     * each extended ASCII character, its letters and its script. Built once, on first use, from the
+     * flattened decoding tables.
+     */
+    struct CodePageModels;
+
+    /**
+     * Gets the models of the detected code pages.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [128; 255] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @return	the code page models
      * @since	1.0
      */
-    inline static char32_t convertDOS_CP367_To_Unicode(const char narrowChar)
-    {
-#if defined(_DEBUG)
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
-        // Validate parameters
-        assert((code >= 128) && (code <= 255));
-#endif
-
-        return (char32_t)UNICODE_REPLACEMENT_CHARACTER;
-    }
+    static const CodePageModels& getCodePageModels(void);
 
     /**
-     * Converts a 8-bit IBM/OEM/MS-DOS extended ASCII character from code page 437 to
-     * the equivalent UTF-32 code point.
+     * Gets the weight of a character in the model of a code page: the frequent lowercase letters of
+     * the code page script weight the most, followed by the other letters, the box drawing characters
+     * and the common punctuation, while the control codes and unmapped characters are penalized.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [128; 255] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @param	codePoint	the decoded extended ASCII character
+     * @param	greekScript	'true' if the code page is for the Greek script, 'false' for the Latin script
+     * @return	the weight of the character, from -2 to 1 times 'DETECTION_MAXIMUM_WEIGHT'
      * @since	1.0
      */
-    inline static char32_t convertDOS_CP437_To_Unicode(const char narrowChar)
-    {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
-
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 128) && (code <= 255));
-#endif
-
-        return m_arrDOS_CP437[code - 128];
-    }
+    static int getDetectionWeight(const char32_t codePoint, const bool greekScript);
 
     /**
-     * Converts a 8-bit IBM/OEM/MS-DOS extended ASCII character from code page 737 to
-     * the equivalent UTF-32 code point.
+     * Checks if a character is a letter of the Greek script (in the Greek and Coptic block) or of the
+     * Latin script (in the Latin-1 Supplement and Latin Extended blocks).
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [128; 255] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @param	codePoint	the character to be tested
+     * @param	greekScript	'true' to test for a Greek letter, 'false' to test for a Latin letter
+     * @return	'true' if the character is a letter of the script, 'false' otherwise
      * @since	1.0
      */
-    inline static char32_t convertDOS_CP737_To_Unicode(const char narrowChar)
-    {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
-
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 128) && (code <= 255));
-#endif
-
-        return m_arrDOS_CP737[code - 128];
-    }
+    static bool isDetectionLetter(const char32_t codePoint, const bool greekScript);
 
     /**
-     * Converts a 8-bit IBM/OEM/MS-DOS extended ASCII character from code page 850 to
-     * the equivalent UTF-32 code point.
+     * Adds the occurrences of each extended ASCII character [128; 255] of a buffer to a histogram, and
+     * the number of 7-bit ASCII letters, that are the same in all the code pages. The letters are counted
+     * with SIMD instructions when available, and the extended ASCII characters are counted into 4
+     * interleaved tables, so repeated characters don't serialize the increments.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [128; 255] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @param	buffer			the bytes to be counted
+     * @param	length			the number of bytes
+     * @param	histogram		the 128 counters of the extended ASCII characters to be incremented
+     * @param	asciiLetters	the counter of the 7-bit ASCII letters to be incremented
      * @since	1.0
      */
-    inline static char32_t convertDOS_CP850_To_Unicode(const char narrowChar)
-    {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+    static void countCharacters(const char* buffer, const size_t length, size_t* histogram, size_t& asciiLetters);
 
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 128) && (code <= 255));
+    /* Default Code Page */
+
+    /**
+     * Marks the cached default narrow code page as not resolved yet.
+     */
+    static const unsigned int DEFAULT_CODEPAGE_UNRESOLVED = 0xFFFFFFFFU;
+
+    /**
+     * The cached code page of the narrow character strings, resolved on first use and by
+     * 'refreshDefaultNarrowCodePage'.
+     */
+#if defined(__HAS_INCLUDE_ATOMIC)
+    static atomic<unsigned int> m_defaultNarrowCodePage;
+#else
+    static volatile unsigned int m_defaultNarrowCodePage;
 #endif
 
-        return m_arrDOS_CP850[code - 128];
-    }
+    /**
+     * Maximum length of a normalized character set name.
+     */
+    static const size_t CHARSET_NAME_MAXIMUM_LENGTH = 15;
 
     /**
-     * Converts a 8-bit IBM/OEM/MS-DOS extended ASCII character from code page 858 to
-     * the equivalent UTF-32 code point.
+     * Number of known character set names.
+     */
+    static const size_t CHARSET_NAME_COUNT = 91;
+
+    /**
+     * Number of slots of the character set names perfect hash table.
+     */
+    static const size_t CHARSET_HASH_TABLE_SIZE = 256;
+
+    /**
+     * FNV-1a offset basis of the character set names hash, chosen so the known names don't collide.
+     */
+    static const uint32_t CHARSET_HASH_SEED = 0xB0F9352BU;
+
+    /**
+     * A normalized character set name (lowercase, without separators) and its code page.
+     */
+    struct CharsetName
+    {
+        const char* m_name;
+        CodePage m_codePage;
+    };
+
+    /**
+     * The known character set names.
+     */
+    static const CharsetName m_arrCharsetNames[CHARSET_NAME_COUNT];
+
+    /**
+     * Perfect hash table of the known character set names, with the index of the name in each slot.
+     * Built once, on first use.
+     */
+    struct CharsetHashTable;
+
+    /**
+     * Gets the perfect hash table of the known character set names.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [128; 255] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @return	the character set names hash table
      * @since	1.0
      */
-    inline static char32_t convertDOS_CP858_To_Unicode(const char narrowChar)
-    {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
-
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 128) && (code <= 255));
-#endif
+    static const CharsetHashTable& getCharsetHashTable(void);
 
-        // Same as CP850 except for character 213, "ı" changed to "€"
-        if(code == 213)
-        {
-            // "ı" changed to "€"
-            return (char32_t)0x20AC;
-        }
-        // else
-        return m_arrDOS_CP850[code - 128];
-    }
+    /**
+     * Gets the slot of a normalized character set name in the perfect hash table.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	normalizedName	the null terminated normalized character set name
+     * @return	the slot of the name, in [0; CHARSET_HASH_TABLE_SIZE - 1]
+     * @since	1.0
+     */
+    static size_t getCharsetNameSlot(const char* normalizedName);
 
     /**
-     * Converts a 8-bit IBM/OEM/MS-DOS extended ASCII character from code page 859 to
-     * the equivalent UTF-32 code point.
+     * Resolves the code page of the narrow character strings from the current locale.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [128; 255] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @return	the code page from CodePage enumeration of the narrow character strings
      * @since	1.0
      */
-    inline static char32_t convertDOS_CP859_To_Unicode(const char narrowChar)
-    {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+    static CodePage resolveDefaultNarrowCodePage(void);
 
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 128) && (code <= 255));
-#endif
+    /* 8-bit Code Page Maps from Unicode */
 
-        return m_arrDOS_CP859[code - 128];
-    }
+    /**
+     * Reverse lookup tables of the 8-bit code pages, organized as a two-level page table
+     * over the BMP: the high byte of the code point selects a leaf, the low byte indexes it.
+     * Built once, on first use, from the flattened decoding tables.
+     */
+    struct CodePageEncodingTables;
 
     /**
-     * Converts a 8-bit IBM/OEM/MS-DOS extended ASCII character from code page 860 to
-     * the equivalent UTF-32 code point.
+     * Gets the reverse lookup tables of the 8-bit code pages.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [128; 255] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @return	the reverse lookup tables
      * @since	1.0
      */
-    inline static char32_t convertDOS_CP860_To_Unicode(const char narrowChar)
-    {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+    static const CodePageEncodingTables& getCodePageEncodingTables(void);
 
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 128) && (code <= 255));
-#endif
+    /* 8-bit Code Page Translation Tables */
 
-        return m_arrDOS_CP860[code - 128];
-    }
+    /**
+     * Byte to byte translation tables between the 8-bit code pages, composed from the flattened decoding
+     * table of the source code page and the reverse lookup table of the target code page, with the
+     * characters that the target code page can't represent flagged as lossy.
+     * Built once, on first use.
+     */
+    struct CodePageTranslationTables;
 
     /**
-     * Converts a 8-bit Apple Macintosh extended ASCII character from code page MacRoman to
-     * the equivalent UTF-32 code point.
+     * Gets the translation tables between the 8-bit code pages.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [128; 255] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @return	the translation tables
      * @since	1.0
      */
-    inline static char32_t convertMac_Roman_To_Unicode(const char narrowChar)
-    {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
-
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 128) && (code <= 255));
-#endif
-
-        return m_arrMac_Roman[code - 128];
-    }
+    static const CodePageTranslationTables& getCodePageTranslationTables(void);
 
     /**
-     * Converts a 8-bit Apple Macintosh extended ASCII character from code page MacGreek to
-     * the equivalent UTF-32 code point.
+     * Checks if a code page is one of the Unicode encodings, that can't be translated byte to byte.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [128; 255] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @param	codePage	the code page from CodePage enumeration
+     * @return	'true' if it's a Unicode encoding, 'false' otherwise
      * @since	1.0
      */
-    inline static char32_t convertMac_Greek_To_Unicode(const char narrowChar)
+    inline static bool isCodePageUnicode(const CodePage codePage)
     {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
-
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 128) && (code <= 255));
-#endif
+        bool bRet = ((codePage == CodePage::UTF_7) ||
+                     (codePage == CodePage::UTF_8) ||
+                     (codePage == CodePage::UCS_2) ||
+                     (codePage == CodePage::UCS_4) ||
+                     (codePage == CodePage::UTF_16) ||
+                     (codePage == CodePage::UTF_32));
 
-        return m_arrMac_Greek[code - 128];
+        return bRet;
     }
 
     /**
-     * Converts a 8-bit Microsoft Windows extended ASCII character from code page 1252 to
-     * the equivalent UTF-32 code point.
+     * Checks if a code page is ISO-8859-1 (Latin-1) or one of the code pages based on it, that only replace
+     * a few of it's characters, so their conversions are the Latin-1 ones patched.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [128; 255] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @param	codePage	the code page from CodePage enumeration
+     * @return	'true' if it's a Latin-1 based code page, 'false' otherwise
      * @since	1.0
      */
-    inline static char32_t convertWindows_1252_To_Unicode(const char narrowChar)
+    inline static bool isCodePageLatin1Based(const CodePage codePage)
     {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
-
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 128) && (code <= 255));
-#endif
+        bool bRet = ((codePage == CodePage::ISO_8859_1) ||
+                     (codePage == CodePage::ISO_8859_15) ||
+                     (codePage == CodePage::WINDOWS_1252));
 
-        return m_arrWindows_1252[code - 128];
+        return bRet;
     }
 
+    /* Scalar Code Points Codecs */
+
     /**
-     * Converts a 8-bit Microsoft Windows extended ASCII character from code page 1253 to
-     * the equivalent UTF-32 code point.
+     * Decodes the UTF-8 sequence of a code point without throwing exceptions. An ill-formed sequence is
+     * decoded as the replacement character and only its code units before the first unexpected one are
+     * consumed, so each error is replaced once.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [128; 255] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @param	utf8String	the UTF-8 code units
+     * @param	length		the number of UTF-8 code units
+     * @param	index		the index of the first code unit of the sequence, receives the index of the next one
+     * @param	codePoint	receives the UTF-32 code point, or the replacement character
+     * @return	'ConversionStatus::OK' if the sequence is valid, otherwise the error found
      * @since	1.0
      */
-    inline static char32_t convertWindows_1253_To_Unicode(const char narrowChar)
-    {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
-
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 128) && (code <= 255));
-#endif
-
-        return m_arrWindows_1253[code - 128];
-    }
+    static ConversionStatus tryDecodeUtf8Char(const char* utf8String, const size_t length, size_t& index, char32_t& codePoint);
 
     /**
-     * Converts a 8-bit ISO/IEC extended ASCII character from code page 8859-1 to
-     * the equivalent UTF-32 code.
+     * Encodes a code point as an UTF-8 sequence without throwing exceptions. An invalid code point is
+     * encoded as the replacement character.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [128; 255] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @param	codePoint		the UTF-32 code point to be encoded
+     * @param	utf8Sequence	receives the UTF-8 sequence, must have room for 4 code units
+     * @param	sequenceLength	receives the number of UTF-8 code units of the sequence
+     * @return	'ConversionStatus::OK' if the code point is valid, otherwise 'ConversionStatus::INVALID_CODE_POINT'
      * @since	1.0
      */
-    inline static char32_t convertISO_8859_1_To_Unicode(const char narrowChar)
-    {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+    static ConversionStatus tryEncodeUtf8Char(const char32_t codePoint, char* utf8Sequence, size_t& sequenceLength);
 
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 128) && (code <= 255));
-#endif
+    /**
+     * Decodes the UTF-16 code unit or surrogate pair of a code point without throwing exceptions. An unpaired
+     * surrogate is decoded as the replacement character.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf16String	the UTF-16 code units
+     * @param	length		the number of UTF-16 code units
+     * @param	index		the index of the code unit, receives the index of the next one
+     * @param	codePoint	receives the UTF-32 code point, or the replacement character
+     * @return	'ConversionStatus::OK' if the code unit or surrogate pair is valid, otherwise the error found
+     * @since	1.0
+     */
+    static ConversionStatus tryDecodeUtf16Char(const char16_t* utf16String, const size_t length, size_t& index, char32_t& codePoint);
 
-        return code;
-    }
+    /**
+     * Encodes a code point as an UTF-16 code unit or surrogate pair without throwing exceptions. An invalid
+     * code point is encoded as the replacement character.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	codePoint		the UTF-32 code point to be encoded
+     * @param	utf16Sequence	receives the UTF-16 code units, must have room for 2 code units
+     * @param	sequenceLength	receives the number of UTF-16 code units
+     * @return	'ConversionStatus::OK' if the code point is valid, otherwise 'ConversionStatus::INVALID_CODE_POINT'
+     * @since	1.0
+     */
+    static ConversionStatus tryEncodeUtf16Char(const char32_t codePoint, char16_t* utf16Sequence, size_t& sequenceLength);
 
     /**
-     * Converts a 8-bit ISO/IEC extended ASCII character from code page 8859-7 to
-     * the equivalent UTF-32 code.
+     * Gets the message of the exception thrown by the string conversions for a conversion error.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [128; 255] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @param	status		the conversion status of the error
+     * @param	codePage	the code page from CodePage enumeration of the input where the error was found
+     * @return	the exception message
      * @since	1.0
      */
-    inline static char32_t convertISO_8859_7_To_Unicode(const char narrowChar)
-    {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+    static const char* getConversionErrorMessage(const ConversionStatus status, const CodePage codePage);
 
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 128) && (code <= 255));
-#endif
+    /* SIMD Kernels */
 
-        return m_arrISO_8859_7[code - 128];
-    }
+    /**
+     * Granularity, in code units, of the 7-bit ASCII block skipping: the blocks with non-ASCII
+     * characters are left to the scalar decoders, one block at a time.
+     */
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE2)
+    static const size_t ASCII_BLOCK_SIZE = 16;
+#else
+    static const size_t ASCII_BLOCK_SIZE = 8;
+#endif
 
     /**
-     * Converts a 8-bit ISO/IEC extended ASCII character from code page 8859-15 to
-     * the equivalent UTF-32 code point.
+     * Zero-extends the leading 7-bit ASCII blocks of a narrow string straight to UTF-32, using
+     * SIMD instructions when available, and stops at the first block with a non-ASCII character.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar	the ASCII character [128; 255] to be converted
-     * @return	the equivalent UTF-32 code point
+     * @param	narrowString	the narrow characters to be converted
+     * @param	length			the number of narrow characters
+     * @param	utf32String		receives the UTF-32 code points, must have room for 'length' code points
+     * @return	the number of characters converted, a multiple of ASCII_BLOCK_SIZE
      * @since	1.0
      */
-    inline static char32_t convertISO_8859_15_To_Unicode(const char narrowChar)
+    static size_t convertAsciiBlocks_to_Utf32(const char* narrowString, const size_t length, char32_t* utf32String);
+
+    /**
+     * Gets the length of the leading 7-bit ASCII blocks of a narrow string, using SIMD instructions
+     * when available.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowString	the narrow characters to be checked
+     * @param	length			the number of narrow characters
+     * @return	the number of leading characters in 7-bit ASCII blocks, a multiple of ASCII_BLOCK_SIZE
+     * @since	1.0
+     */
+    static size_t getAsciiBlocksLength(const char* narrowString, const size_t length);
+
+    /**
+     * Zero-extends the leading 7-bit ASCII blocks of a narrow string straight to UTF-16, using
+     * SIMD instructions when available, and stops at the first block with a non-ASCII character.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowString	the narrow characters to be converted
+     * @param	length			the number of narrow characters
+     * @param	utf16String		receives the UTF-16 code units, must have room for 'length' code units
+     * @return	the number of characters converted, a multiple of ASCII_BLOCK_SIZE
+     * @since	1.0
+     */
+    static size_t convertAsciiBlocks_to_Utf16(const char* narrowString, const size_t length, char16_t* utf16String);
+
+    /**
+     * Translates a narrow string byte by byte through a 256-entry table, using SIMD instructions when
+     * available (AVX2): the table is split in 16 rows of 16 bytes, looked up with byte shuffles, otherwise byte by byte.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	source			the bytes to be translated
+     * @param	length			the number of bytes
+     * @param	table			the 256-entry translation table
+     * @param	destination		receives the translated bytes, can be the source itself
+     * @since	1.0
+     */
+    static void translateBytes(const char* source, const size_t length, const unsigned char* table, char* destination);
+
+    /**
+     * Translates the leading blocks of a narrow string through a 256-entry table, using SIMD instructions
+     * when available (AVX2), and stops at the first block translated to a non-ASCII character.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	source			the bytes to be translated
+     * @param	length			the number of bytes
+     * @param	table			the 256-entry translation table
+     * @param	destination		receives the translated 7-bit ASCII characters, must have room for 'length' bytes
+     * @return	the number of bytes translated, a multiple of ASCII_BLOCK_SIZE
+     * @since	1.0
+     */
+    static size_t translateAsciiBlocks(const char* source, const size_t length, const unsigned char* table, char* destination);
+
+    /**
+     * Converts a characters buffer of a double-byte code page loaded by the 'CodePageRegistry' to an UTF-32
+     * code points buffer, skipping the 7-bit ASCII blocks with SIMD instructions when available.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowString	the single-byte and double-byte characters to be converted
+     * @param	narrowLength	the number of bytes
+     * @param	utf32String		receives the UTF-32 code points
+     * @param	utf32Room		the room for UTF-32 code points
+     * @param	codePage		the handle of the double-byte code page
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    static ConversionResult convertDoubleByte_to_Utf32(const char* narrowString, const size_t narrowLength,
+                                                       char32_t* utf32String, const size_t utf32Room,
+                                                       const CodePageHandle codePage);
+
+    /**
+     * Converts a characters buffer of a double-byte code page loaded by the 'CodePageRegistry' to an UTF-8
+     * code units buffer, copying the 7-bit ASCII blocks with SIMD instructions when available.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowString	the single-byte and double-byte characters to be converted
+     * @param	narrowLength	the number of bytes
+     * @param	utf8String		receives the UTF-8 code units
+     * @param	utf8Room		the room for UTF-8 code units
+     * @param	codePage		the handle of the double-byte code page
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    static ConversionResult convertDoubleByte_to_Utf8(const char* narrowString, const size_t narrowLength,
+                                                      char* utf8String, const size_t utf8Room,
+                                                      const CodePageHandle codePage);
+
+    /**
+     * Converts a characters buffer of a double-byte code page loaded by the 'CodePageRegistry' to an UTF-16
+     * code units buffer, skipping the 7-bit ASCII blocks with SIMD instructions when available.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowString	the single-byte and double-byte characters to be converted
+     * @param	narrowLength	the number of bytes
+     * @param	utf16String		receives the UTF-16 code units
+     * @param	utf16Room		the room for UTF-16 code units
+     * @param	codePage		the handle of the double-byte code page
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    static ConversionResult convertDoubleByte_to_Utf16(const char* narrowString, const size_t narrowLength,
+                                                       char16_t* utf16String, const size_t utf16Room,
+                                                       const CodePageHandle codePage);
+
+    /**
+     * Narrows the leading 7-bit ASCII blocks of an UTF-16 string straight to UTF-8, using SIMD
+     * instructions when available, and stops at the first block with a non-ASCII character.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf16String		the UTF-16 code units to be converted
+     * @param	length			the number of UTF-16 code units
+     * @param	utf8String		receives the UTF-8 code units, must have room for 'length' code units
+     * @return	the number of code units converted, a multiple of 16
+     * @since	1.0
+     */
+    static size_t convertUtf16AsciiBlocks_to_Utf8(const char16_t* utf16String, const size_t length, char* utf8String);
+
+    /**
+     * Splits the leading blocks of an UTF-16 string with only 2 bytes UTF-8 characters [U+0080; U+07FF]
+     * straight to UTF-8, using SIMD instructions when available, and stops at the first block with
+     * other characters.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf16String		the UTF-16 code units to be converted
+     * @param	length			the number of UTF-16 code units
+     * @param	utf8String		receives the UTF-8 code units, must have room for twice 'length' code units
+     * @return	the number of UTF-16 code units converted, a multiple of 8
+     * @since	1.0
+     */
+    static size_t convertUtf16TwoBytesBlocks_to_Utf8(const char16_t* utf16String, const size_t length, char* utf8String);
+
+    /**
+     * Joins the leading blocks of an UTF-8 string with only 2 bytes sequences straight to UTF-16,
+     * using SIMD instructions when available, and stops at the first block with other sequences.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf8String		the UTF-8 code units to be converted, starting at a sequence boundary
+     * @param	length			the number of UTF-8 code units
+     * @param	utf16String		receives the UTF-16 code units, must have room for half 'length' code units
+     * @return	the number of UTF-8 code units converted, a multiple of 16
+     * @since	1.0
+     */
+    static size_t convertUtf8TwoBytesBlocks_to_Utf16(const char* utf8String, const size_t length, char16_t* utf16String);
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSSE3)
+    struct Latin1PackTables;
+
+    /**
+     * Gets the Latin-1 packing lookup tables, built on the first call.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	the Latin-1 packing lookup tables
+     * @since	1.0
+     */
+    static const Latin1PackTables& getLatin1PackTables();
+#endif
+
+    /**
+     * Expands the leading blocks of a Latin-1 based string straight to UTF-8, using SIMD instructions when
+     * available (SSSE3), and stops at the first block with a character of the code page that isn't the Latin-1
+     * character of the same value, or when the room left for the UTF-8 code units is too small for a block.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	latin1String	the Latin-1 based characters to be converted
+     * @param	length			the number of characters
+     * @param	utf8String		receives the UTF-8 code units
+     * @param	utf8Room		the room for UTF-8 code units
+     * @param	patches			the nibble classification tables of the characters that aren't Latin-1
+     * @param	utf8Length		receives the number of UTF-8 code units
+     * @return	the number of characters converted
+     * @since	1.0
+     */
+    static size_t convertLatin1Blocks_to_Utf8(const char* latin1String, const size_t length, char* utf8String, const size_t utf8Room,
+                                              const unsigned char* patches, size_t& utf8Length);
+
+    /**
+     * Narrows the leading blocks of an UTF-8 string with only 7-bit ASCII and Latin-1 characters, starting
+     * at a sequence boundary, to a Latin-1 based string, using SIMD instructions when available (SSSE3), and
+     * stops at the first block with other sequences or with a character that the code page has elsewhere, or
+     * when the room left for the characters is too small for a block.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf8String		the UTF-8 code units to be converted
+     * @param	length			the number of UTF-8 code units
+     * @param	latin1String	receives the Latin-1 based characters
+     * @param	latin1Room		the room for characters
+     * @param	patches			the nibble classification tables of the characters that aren't Latin-1
+     * @param	latin1Length	receives the number of characters
+     * @return	the number of UTF-8 code units converted
+     * @since	1.0
+     */
+    static size_t convertUtf8Blocks_to_Latin1(const char* utf8String, const size_t length, char* latin1String, const size_t latin1Room,
+                                              const unsigned char* patches, size_t& latin1Length);
+
+    /**
+     * Zero-extends the leading blocks of a Latin-1 based string straight to UTF-16, using SIMD instructions
+     * when available (SSSE3 or AVX2), and stops at the first block with a character of the code page that
+     * isn't the Latin-1 character of the same value.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	latin1String	the Latin-1 based characters to be converted
+     * @param	length			the number of characters
+     * @param	utf16String		receives the UTF-16 code units, must have room for 'length' code units
+     * @param	patches			the nibble classification tables of the characters that aren't Latin-1
+     * @return	the number of characters converted, a multiple of 16
+     * @since	1.0
+     */
+    static size_t convertLatin1Blocks_to_Utf16(const char* latin1String, const size_t length, char16_t* utf16String,
+                                               const unsigned char* patches);
+
+    /**
+     * Narrows the leading blocks of an UTF-16 string with only 7-bit ASCII and Latin-1 characters straight to
+     * a Latin-1 based string, using SIMD instructions when available (SSSE3 or AVX2), and stops at the first
+     * block with other characters or with a character that the code page has elsewhere.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf16String		the UTF-16 code units to be converted
+     * @param	length			the number of UTF-16 code units
+     * @param	latin1String	receives the Latin-1 based characters, must have room for 'length' characters
+     * @param	patches			the nibble classification tables of the characters that aren't Latin-1
+     * @return	the number of code units converted, a multiple of 16
+     * @since	1.0
+     */
+    static size_t convertUtf16Blocks_to_Latin1(const char16_t* utf16String, const size_t length, char* latin1String,
+                                               const unsigned char* patches);
+
+    /**
+     * Granularity, in code units, of the UTF-8 blocks decoding: the blocks with 4 bytes or invalid
+     * sequences are left to the scalar decoder, one block at a time.
+     */
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    static const size_t UTF8_BLOCK_SIZE = 32;
+#elif (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE4_1)
+    static const size_t UTF8_BLOCK_SIZE = 16;
+#else
+    static const size_t UTF8_BLOCK_SIZE = ASCII_BLOCK_SIZE;
+#endif
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE4_1)
+    struct LeftPackTables;
+
+    /**
+     * Gets the left-pack lookup tables, built on the first call.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	the left-pack lookup tables
+     * @since	1.0
+     */
+    static const LeftPackTables& getLeftPackTables();
+
+    /**
+     * Classifies the code units of an UTF-8 block and gets the leads of the complete sequences.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	nonAscii	the mask of the code units with the high bit set
+     * @param	nexts		the mask of the next code units (10xxxxxx)
+     * @param	leads3		the mask of the 3 bytes sequences leads (1110xxxx)
+     * @param	leads4		the mask of the 4 (or more) bytes sequences leads (1111xxxx)
+     * @param	blockSize	the number of code units of the block
+     * @param	leads		receives the mask of the leads of the complete sequences
+     * @return	the number of code units of the complete sequences, or 0 if the block has 4 bytes
+     *          sequences or isn't well structured
+     * @since	1.0
+     */
+    static size_t getUtf8BlockLeads(const uint64_t nonAscii, const uint64_t nexts, const uint64_t leads3, const uint64_t leads4, const size_t blockSize, uint64_t& leads);
+#endif
+
+    /**
+     * Decodes the leading blocks of an UTF-8 string with only 1, 2 and 3 bytes sequences, starting at
+     * a sequence boundary, to UTF-32, using SIMD instructions when available (SSE4.1 or AVX2), and stops
+     * at the first block with 4 bytes or invalid sequences, or with Unicode non-characters.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf8String		the UTF-8 code units to be converted
+     * @param	length			the number of UTF-8 code units
+     * @param	utf32String		receives the UTF-32 code points, must have room for 'length' code points
+     * @param	utf32Length		receives the number of UTF-32 code points
+     * @return	the number of UTF-8 code units converted
+     * @since	1.0
+     */
+    static size_t convertUtf8Blocks_to_Utf32(const char* utf8String, const size_t length, char32_t* utf32String, size_t& utf32Length);
+
+    /**
+     * Granularity, in code points, of the UTF-32 blocks encoding: the blocks with invalid code points
+     * are left to the scalar encoder, one block at a time.
+     */
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    static const size_t UTF32_BLOCK_SIZE = 16;
+#else
+    static const size_t UTF32_BLOCK_SIZE = 8;
+#endif
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_SSE4_1)
+    struct Utf8PackTables;
+
+    /**
+     * Gets the UTF-8 packing lookup tables, built on the first call.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	the UTF-8 packing lookup tables
+     * @since	1.0
+     */
+    static const Utf8PackTables& getUtf8PackTables();
+#endif
+
+    /**
+     * Gets the number of UTF-8 code units needed to encode an UTF-32 string, counting the invalid
+     * code points as the replacement character, using SIMD instructions when available.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf32String		the UTF-32 code points
+     * @param	length			the number of UTF-32 code points
+     * @return	the number of UTF-8 code units
+     * @since	1.0
+     */
+    static size_t getUtf8Length(const char32_t* utf32String, const size_t length);
+
+    /**
+     * Encodes the leading blocks of valid code points of an UTF-32 string to UTF-8, using SIMD
+     * instructions when available (SSE4.1 or AVX2), and stops at the first block with invalid code
+     * points or when the room left for the UTF-8 code units is too small for a block.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf32String		the UTF-32 code points to be converted
+     * @param	length			the number of UTF-32 code points
+     * @param	utf8String		receives the UTF-8 code units
+     * @param	utf8Room		the room for UTF-8 code units
+     * @param	utf8Length		receives the number of UTF-8 code units
+     * @return	the number of UTF-32 code points converted
+     * @since	1.0
+     */
+    static size_t convertUtf32Blocks_to_Utf8(const char32_t* utf32String, const size_t length, char* utf8String, const size_t utf8Room, size_t& utf8Length);
+
+    /**
+     * Granularity, in code units, of the UTF-16 and UTF-32 BMP blocks conversion: the blocks with
+     * surrogate pairs or invalid characters are left to the scalar codecs, one block at a time.
+     */
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    static const size_t UTF16_BLOCK_SIZE = 16;
+#else
+    static const size_t UTF16_BLOCK_SIZE = 8;
+#endif
+
+    /**
+     * Widens the leading UTF-16 code units of BMP characters, other than surrogates and non-characters,
+     * straight to UTF-32, using SIMD instructions when available, and stops at the first surrogate or
+     * non-character.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf16String		the UTF-16 code units to be converted
+     * @param	length			the number of UTF-16 code units
+     * @param	utf32String		receives the UTF-32 code points, must have room for 'length' code points
+     * @return	the number of UTF-16 code units converted
+     * @since	1.0
+     */
+    static size_t convertUtf16Blocks_to_Utf32(const char16_t* utf16String, const size_t length, char32_t* utf32String);
+
+    /**
+     * Narrows the leading UTF-32 code points of BMP characters, other than surrogates and non-characters,
+     * straight to UTF-16, using SIMD instructions when available, and stops at the first code point that
+     * needs a surrogate pair or is invalid.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf32String		the UTF-32 code points to be converted
+     * @param	length			the number of UTF-32 code points
+     * @param	utf16String		receives the UTF-16 code units, must have room for 'length' code units
+     * @return	the number of UTF-32 code points converted
+     * @since	1.0
+     */
+    static size_t convertUtf32Blocks_to_Utf16(const char32_t* utf32String, const size_t length, char16_t* utf16String);
+
+    /**
+     * 'true' if the host byte order is little endian, resolved at compile time.
+     */
+    static const bool HOST_LITTLE_ENDIAN = (__COMPILER_CPU_BYTE_ORDER != __COMPILER_CPU_BYTE_ORDER_BIG_ENDIAN);
+
+    /**
+     * Swaps the byte order of 16-bit code units, using SIMD instructions when available.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	source			the code units to be swapped
+     * @param	length			the number of code units
+     * @param	destination		receives the swapped code units, can be the source itself
+     * @since	1.0
+     */
+    static void swapByteOrder16(const char* source, const size_t length, char* destination);
+
+    /**
+     * Swaps the byte order of 32-bit code units, using SIMD instructions when available.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	source			the code units to be swapped
+     * @param	length			the number of code units
+     * @param	destination		receives the swapped code units, can be the source itself
+     * @since	1.0
+     */
+    static void swapByteOrder32(const char* source, const size_t length, char* destination);
+
+    /**
+     * Copies whole code units between a byte buffer and a code units buffer, swapping their byte order
+     * if asked.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	source				the code units to be copied
+     * @param	sourceBytes			the number of bytes of the code units to be copied
+     * @param	destination			receives the code units
+     * @param	destinationBytes	the room in bytes for code units
+     * @param	unitSize			the code unit size in bytes, 2 or 4
+     * @param	swapBytes			if 'true' swaps the byte order of the code units
+     * @return	the conversion status and the number of bytes consumed and written
+     * @since	1.0
+     */
+    static ConversionResult convertByteOrder(const char* source, const size_t sourceBytes, char* destination,
+                                             const size_t destinationBytes, const size_t unitSize, const bool swapBytes);
+
+    /**
+     * Validates an UTF-8 string, one sequence at a time, following the well-formed UTF-8 byte
+     * sequences table of the Unicode Standard (no overlong forms, no surrogates, nothing above U+10FFFF).
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf8String	the UTF-8 code units to be validated
+     * @param	length		the number of UTF-8 code units
+     * @param	start		the offset of a sequence boundary where to start the validation
+     * @return	the offset of the first invalid UTF-8 sequence, or 'length' if the string is valid
+     * @since	1.0
+     */
+    static size_t validateUtf8(const char* utf8String, const size_t length, const size_t start);
+
+    /**
+     * Validates the leading blocks of an UTF-8 string with SIMD instructions, classifying each code unit
+     * and the one before it by nibble with byte shuffle lookup tables (SSSE3 or AVX2), and stops at the
+     * first block with an error.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf8String		the UTF-8 code units to be validated
+     * @param	length			the number of UTF-8 code units
+     * @param	nonAsciiFound	receives 'true' if non-ASCII code units were found in the validated blocks
+     * @return	'length' if the string is valid, otherwise the offset of a sequence boundary at most 3 code
+     *          units before the block with the first error (0 without SIMD instructions)
+     * @since	1.0
+     */
+    static size_t validateUtf8Blocks(const char* utf8String, const size_t length, bool& nonAsciiFound);
+
+#if (__COMPILER_CPU_SIMD >= __COMPILER_CPU_SIMD_AVX2)
+    /**
+     * Decodes the leading 16 characters blocks of an 8-bit string to UTF-32 through a flattened
+     * decoding table, widening the characters to 32-bit indexes and gathering the code points
+     * from the table with AVX2.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowString	the 8-bit characters to be converted
+     * @param	length			the number of 8-bit characters
+     * @param	table			the flattened 256-entry decoding table
+     * @param	utf32String		receives the UTF-32 code points, must have room for 'length' code points
+     * @return	the number of characters converted, a multiple of 16
+     * @since	1.0
+     */
+    static size_t convertTableBlocks_to_Utf32(const char* narrowString, const size_t length, const char32_t* table, char32_t* utf32String);
+
+    /**
+     * Checks if the 8-bit strings of a code page are decoded with the AVX2 gather kernel,
+     * instead of the 7-bit ASCII block skipping. True for the Greek code pages, where most
+     * letters are in the extended ASCII half, and for the EBCDIC code pages, that don't have
+     * 7-bit ASCII blocks.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	codePage	the code page from CodePage enumeration
+     * @return	'true' if the code page is decoded with the gather kernel, 'false' otherwise
+     * @since	1.0
+     */
+    inline static bool isCodePageGatherDecoded(const CodePage codePage)
+    {
+        bool bRet = ((codePage == CodePage::DOS_CP737) ||
+                     (codePage == CodePage::MAC_GREEK) ||
+                     (codePage == CodePage::WINDOWS_1253) ||
+                     (codePage == CodePage::ISO_8859_7) ||
+                     isCodePageEbcdic(codePage));
+
+        return bRet;
+    }
+#endif
+
+    /**
+     * Converts a 7-bit ISO/ANSI ASCII character to the equivalent UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [0; 127] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertASCII_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 0) && (code <= 127));
+#endif
+
+        return code;
+    }
+
+    /**
+     * Converts a 7-bit MS-DOS/Windows ASCII (width extensions) character to
+     * the equivalent UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [0; 127] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertDOS_ASCII_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 0) && (code <= 127));
+#endif
+
+        if(((code >= 0) && (code <= 31)) || (code == 127))
+        {
+            // 7-bit MS-DOS/Windows ASCII (width extensions)
+            return m_arrDOS_ASCII[code];
+        }
+        // else
+        return code;
+    }
+
+    /**
+     * Converts a 7-bit Apple Macintosh ASCII (width extensions) character to
+     * the equivalent UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [0; 127] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertMac_ASCII_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 0) && (code <= 127));
+#endif
+
+        if((code >= 17) && (code <= 20))
+        {
+            // 7-bit Apple Macintosh ASCII (width extensions)
+            switch(code)
+            {
+                case 17:
+                    // "⌘" - Command key
+                    return (char32_t)0x2318;
+                    break;
+
+                case 18:
+                    // "⇧" - Shift key
+                    return (char32_t)0x21E7;
+                    break;
+
+                case 19:
+                    // "⌥"  - Option key
+                    return (char32_t)0x2325;
+                    break;
+
+                case 20:
+                    // "⎈" - Control key
+                    return (char32_t)0x2388;
+                    break;
+            }
+            // return (m_arrMac_ASCII[code]);
+        }
+        // else
+        return code;
+    }
+
+	/**
+     * Converts a 8-bit IBM/OEM/MS-DOS extended ASCII character from code page 367 to
+     * the equivalent UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [128; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertDOS_CP367_To_Unicode(const char narrowChar)
+    {
+#if defined(_DEBUG)
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+        // Validate parameters
+        assert((code >= 128) && (code <= 255));
+#endif
+
+        return (char32_t)UNICODE_REPLACEMENT_CHARACTER;
+    }
+
+    /**
+     * Converts a 8-bit IBM/OEM/MS-DOS extended ASCII character from code page 437 to
+     * the equivalent UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [128; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertDOS_CP437_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 128) && (code <= 255));
+#endif
+
+        return m_arrDOS_CP437[code - 128];
+    }
+
+    /**
+     * Converts a 8-bit IBM/OEM/MS-DOS extended ASCII character from code page 737 to
+     * the equivalent UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [128; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertDOS_CP737_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 128) && (code <= 255));
+#endif
+
+        return m_arrDOS_CP737[code - 128];
+    }
+
+    /**
+     * Converts a 8-bit IBM/OEM/MS-DOS extended ASCII character from code page 850 to
+     * the equivalent UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [128; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertDOS_CP850_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 128) && (code <= 255));
+#endif
+
+        return m_arrDOS_CP850[code - 128];
+    }
+
+    /**
+     * Converts a 8-bit IBM/OEM/MS-DOS extended ASCII character from code page 858 to
+     * the equivalent UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [128; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertDOS_CP858_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 128) && (code <= 255));
+#endif
+
+        // Same as CP850 except for character 213, "ı" changed to "€"
+        if(code == 213)
+        {
+            // "ı" changed to "€"
+            return (char32_t)0x20AC;
+        }
+        // else
+        return m_arrDOS_CP850[code - 128];
+    }
+
+    /**
+     * Converts a 8-bit IBM/OEM/MS-DOS extended ASCII character from code page 859 to
+     * the equivalent UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [128; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertDOS_CP859_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 128) && (code <= 255));
+#endif
+
+        return m_arrDOS_CP859[code - 128];
+    }
+
+    /**
+     * Converts a 8-bit IBM/OEM/MS-DOS extended ASCII character from code page 860 to
+     * the equivalent UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [128; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertDOS_CP860_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 128) && (code <= 255));
+#endif
+
+        return m_arrDOS_CP860[code - 128];
+    }
+
+    /**
+     * Converts a 8-bit Apple Macintosh extended ASCII character from code page MacRoman to
+     * the equivalent UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [128; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertMac_Roman_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 128) && (code <= 255));
+#endif
+
+        return m_arrMac_Roman[code - 128];
+    }
+
+    /**
+     * Converts a 8-bit Apple Macintosh extended ASCII character from code page MacGreek to
+     * the equivalent UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [128; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertMac_Greek_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 128) && (code <= 255));
+#endif
+
+        return m_arrMac_Greek[code - 128];
+    }
+
+    /**
+     * Converts a 8-bit Microsoft Windows extended ASCII character from code page 1252 to
+     * the equivalent UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [128; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertWindows_1252_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 128) && (code <= 255));
+#endif
+
+        return m_arrWindows_1252[code - 128];
+    }
+
+    /**
+     * Converts a 8-bit Microsoft Windows extended ASCII character from code page 1253 to
+     * the equivalent UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [128; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertWindows_1253_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 128) && (code <= 255));
+#endif
+
+        return m_arrWindows_1253[code - 128];
+    }
+
+    /**
+     * Converts a 8-bit ISO/IEC extended ASCII character from code page 8859-1 to
+     * the equivalent UTF-32 code.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [128; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertISO_8859_1_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 128) && (code <= 255));
+#endif
+
+        return code;
+    }
+
+    /**
+     * Converts a 8-bit ISO/IEC extended ASCII character from code page 8859-7 to
+     * the equivalent UTF-32 code.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [128; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertISO_8859_7_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 128) && (code <= 255));
+#endif
+
+        return m_arrISO_8859_7[code - 128];
+    }
+
+    /**
+     * Converts a 8-bit ISO/IEC extended ASCII character from code page 8859-15 to
+     * the equivalent UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the ASCII character [128; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertISO_8859_15_To_Unicode(const char narrowChar)
+    {
+        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+
+        // Validate parameters
+#if defined(_DEBUG)
+        assert((code >= 128) && (code <= 255));
+#endif
+
+        switch(code)
+        {
+            case 164:
+                // "¤" changed to "€"
+                return (char32_t)0x20AC;
+
+                break;
+
+            case 166:
+                // "¦" changed to "Š"
+                return (char32_t)0x0160;
+
+                break;
+
+            case 168:
+                // "¨" changed to "š"
+                return (char32_t)0x0161;
+
+                break;
+
+            case 180:
+                // "´" changed to "Ž"
+                return (char32_t)0x017D;
+
+                break;
+
+            case 184:
+                // "¸" changed to "ž"
+                return (char32_t)0x017E;
+
+                break;
+
+            case 188:
+                // "¼" changed to "Œ"
+                return (char32_t)0x0152;
+
+                break;
+
+            case 189:
+                // "½" changed to "œ"
+                return (char32_t)0x0153;
+
+                break;
+
+            case 190:
+                // "¾" changed to "Ÿ"
+                return (char32_t)0x0178;
+
+                break;
+        }
+
+        return code;
+    }
+
+    /**
+     * Converts a 8-bit IBM EBCDIC character from code page 037 (EBCDIC US/Canada) to the equivalent
+     * UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the EBCDIC character [0; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertEBCDIC_CP037_To_Unicode(const char narrowChar)
+    {
+        return m_arrEBCDIC_CP037[static_cast<unsigned char>(narrowChar)];
+    }
+
+    /**
+     * Converts a 8-bit IBM EBCDIC character from code page 500 (EBCDIC International) to the equivalent
+     * UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the EBCDIC character [0; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertEBCDIC_CP500_To_Unicode(const char narrowChar)
+    {
+        return m_arrEBCDIC_CP500[static_cast<unsigned char>(narrowChar)];
+    }
+
+    /**
+     * Converts a 8-bit IBM EBCDIC character from code page 875 (EBCDIC Greek) to the equivalent
+     * UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the EBCDIC character [0; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertEBCDIC_CP875_To_Unicode(const char narrowChar)
+    {
+        return m_arrEBCDIC_CP875[static_cast<unsigned char>(narrowChar)];
+    }
+
+    /**
+     * Converts a 8-bit IBM EBCDIC character from code page 1047 (EBCDIC Open Systems Latin-1) to the equivalent
+     * UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar	the EBCDIC character [0; 255] to be converted
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    inline static char32_t convertEBCDIC_CP1047_To_Unicode(const char narrowChar)
+    {
+        return m_arrEBCDIC_CP1047[static_cast<unsigned char>(narrowChar)];
+    }
+
+    /**
+     * Converts an UTF-16 encoded string to the equivalent 2 bytes system wide character encoded string.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf16String			the UTF-16 encoded string to be converted
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+     * @return	the equivalent 2 bytes system wide character encoded string
+     * @since	1.0
+     */
+    static wstring convertStringUtf16_to_StringWide2(const u16string& utf16String, const bool strictConversion = false);
+
+    /**
+     * Converts a 2 bytes system wide character encoded string to the equivalent UTF-16 encoded string.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	wideString			the 2 bytes system wide character encoded string to be converted
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+     *                          invalid conversion, if 'false' replaces invalid character width the replacement character
+     * @return	the equivalent UTF-16 encoded string
+     * @since	1.0
+     */
+    static u16string convertStringWide2_to_StringUtf16(const wstring& wideString, const bool strictConversion = false);
+
+    /**
+     * Converts an UTF-16 encoded string to the equivalent 4 bytes system wide character encoded string.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf16String			the UTF-16 encoded string to be converted
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+     * @return	the equivalent 4 bytes system wide character encoded string
+     * @since	1.0
+     */
+    static wstring convertStringUtf16_to_StringWide4(const u16string& utf16String, const bool strictConversion = false);
+
+    /**
+     * Converts a 4 bytes system wide character encoded string to the equivalent UTF-16 encoded string.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	wideString			the 4 bytes system wide character encoded string to be converted
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+     *                          invalid conversion, if 'false' replaces invalid character width the replacement character
+     * @return	the equivalent UTF-16 encoded string
+     * @since	1.0
+     */
+    static u16string convertStringWide4_to_StringUtf16(const wstring& wideString, const bool strictConversion = false);
+
+    /**
+     * Converts an UTF-32 encoded string to the equivalent 2 bytes system wide character encoded string.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf32String			the UTF-32 encoded string to be converted
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+     * @return	the equivalent 2 bytes system wide character encoded string
+     * @since	1.0
+     */
+    static wstring convertStringUtf32_to_StringWide2(const u32string& utf32String, const bool strictConversion = false);
+
+    /**
+     * Converts an 2 bytes system wide character encoded string to the equivalent UTF-32 encoded string.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	wideString			the 2 bytes system wide character encoded string to be converted
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+     * @return	the equivalent UTF-32 string
+     * @since	1.0
+     */
+    static u32string convertStringWide2_to_StringUtf32(const wstring& wideString, const bool strictConversion = false);
+
+    /**
+     * Converts an UTF-32 encoded string to the equivalent 4 bytes system wide character encoded string.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf32String			the UTF-32 encoded string to be converted
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+     * @return	the equivalent 4 bytes system wide character encoded string
+     * @since	1.0
+     */
+    static wstring convertStringUtf32_to_StringWide4(const u32string& utf32String, const bool strictConversion = false);
+
+    /**
+     * Converts an 4 bytes system wide character encoded string to the equivalent UTF-32 encoded string.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	wideString			the 4 bytes system wide character encoded string to be converted
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+     * @return	the equivalent UTF-32 string
+     * @since	1.0
+     */
+    static u32string convertStringWide4_to_StringUtf32(const wstring& wideString, const bool strictConversion = false);
+
+    /**
+     * Get the number of code units in bytes to decode a given UTF-8 encoded character to an Unicode code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf8	the UTF-8 lead character/byte
+     * @return	the number of code units in bytes needed to decode an UTF-8 sequence, or 0 if the code unit
+     *          isn't a lead of an UTF-8 sequence up to 4 code units
+     * @since	1.0
+     */
+    static inline size_t getCodeUnitsForUtf8Leads(char charUtf8)
+    {
+        size_t sequenceBytes = 0;
+
+        if(!(charUtf8 & UTF8_NEXT))
+        {
+            sequenceBytes = 1;
+        }
+        else if((char)(charUtf8 & (~UTF8_LEAD_BYTES2_MASK)) == UTF8_LEAD_BYTES2)
+        {
+            sequenceBytes = 2;
+        }
+        else if((char)(charUtf8 & (~UTF8_LEAD_BYTES3_MASK)) == UTF8_LEAD_BYTES3)
+        {
+            sequenceBytes = 3;
+        }
+        else if((char)(charUtf8 & (~UTF8_LEAD_BYTES4_MASK)) == UTF8_LEAD_BYTES4)
+        {
+            sequenceBytes = 4;
+        }
+        else if((char)(charUtf8 & (~UTF8_LEAD_BYTES5_MASK)) == UTF8_LEAD_BYTES5)
+        {
+            sequenceBytes = 5;
+        }
+        else if((char)(charUtf8 & (~UTF8_LEAD_BYTES6_MASK)) == UTF8_LEAD_BYTES6)
+        {
+            sequenceBytes = 6;
+        }
+
+        if(sequenceBytes > 4)
+        {
+            // 5 and 6 bytes sequences are no longer UTF-8
+            sequenceBytes = 0;
+        }
+
+        return sequenceBytes;
+    }
+
+    /**
+     * Get the number of code units in bytes need to encode a Unicode code point to UTF-8 sequence.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf32	the UTF-32 code point
+     * @return	the number of code units in bytes needed to encode the character in UTF-8, or 0 if the
+     *          code point doesn't fit an UTF-8 sequence up to 4 code units
+     * @since	1.0
+     */
+    static inline size_t getCodeUnitsForUtf8Char(char32_t charUtf32)
+    {
+        size_t sequenceBytes = 0;
+
+        if(!(charUtf32 & (~0x0000007FUL)))
+        {
+            sequenceBytes = 1;
+        }
+        else if(!(charUtf32 & (~0x000007FFUL)))
+        {
+            sequenceBytes = 2;
+        }
+        else if(!(charUtf32 & (~0x0000FFFFUL)))
+        {
+            sequenceBytes = 3;
+        }
+        else if(!(charUtf32 & (~0x001FFFFFUL)))
+        {
+            sequenceBytes = 4;
+        }
+        else if(!(charUtf32 & (~0x03FFFFFFUL)))
+        {
+            sequenceBytes = 5;
+        }
+        else if(!(charUtf32 & (~0x7FFFFFFFUL)))
+        {
+            sequenceBytes = 6;
+        }
+
+        if(sequenceBytes > 4)
+        {
+            // 5 and 6 bytes sequences are no longer UTF-8
+            sequenceBytes = 0;
+        }
+
+        return sequenceBytes;
+    }
+
+public:
+    /**
+     * Error offset of the conversions that found no invalid input.
+     */
+    static const size_t NO_ERROR_OFFSET = static_cast<size_t>(-1);
+
+    /**
+     * Default class 'CodePage2Unicode' constructor.
+     * Creates a mew object instance.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @since	1.0
+     */
+    explicit CodePage2Unicode()
+    {
+	
+	}
+
+    /**
+     * Default class 'CodePage2Unicode' destructor.
+     * Destroys this object instance.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @since	1.0
+     */
+    ~CodePage2Unicode()
+    {
+	
+	}
+
+    /**
+     * Gets the narrow character size in bytes.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	the size in bytes of a 'char'
+     * @since	1.0
+     */
+    inline static size_t getNarrowCharByteSize(void)
+    {
+        return sizeof(char);
+    }
+
+    /**
+     * Gets the wide character size in bytes.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	the size in bytes of a 'wchar_t'
+     * @since	1.0
+     */
+    inline static size_t getWideCharByteSize(void)
+    {
+        return sizeof(wchar_t);
+    }
+
+    /**
+     * Gets the narrow/wide character size in bytes, according the compile time definition.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	the size in bytes of a '_TCHAR'
+     * @since	1.0
+     */
+    inline static size_t getTCharByteSize(void)
+    {
+        return sizeof(_TCHAR);
+    }
+
+    /**
+     * Gets the code page of the narrow character strings, from the character set of the current locale.<br />
+     * The code page is resolved on first use and cached, so later calls are a single atomic load, until
+     * it's refreshed with 'refreshDefaultNarrowCodePage' after the locale is changed.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	the code page from CodePage enumeration of the narrow character strings, or 'UNKNOWN' if
+     *          the locale character set isn't supported
+     * @since	1.0
+     */
+    static CodePage getDefaultNarrowCodePage(void);
+
+    /**
+     * Resolves again the code page of the narrow character strings, after the locale was changed with
+     * 'setlocale', and caches it.<br />
+     * On POSIX systems the code page is resolved from 'nl_langinfo(CODESET)', and on Windows from the
+     * C runtime locale name, or from the Windows ANSI or OEM (console programs) code page for the "C" locale.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	the code page from CodePage enumeration of the narrow character strings, or 'UNKNOWN' if
+     *          the locale character set isn't supported
+     * @since	1.0
+     */
+    static CodePage refreshDefaultNarrowCodePage(void);
+
+    /**
+     * Gets the code page of a character set name, like the ones of the IANA registry, of 'nl_langinfo(CODESET)'
+     * or after the dot of a locale name ("UTF-8", "ISO-8859-15", "CP1252", "IBM850", "ANSI_X3.4-1968", "1252", ...).<br />
+     * The names are case insensitive, the '-', '_' and ' ' separators and the '@' modifiers are ignored.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charsetName	the null terminated character set name
+     * @return	the code page from CodePage enumeration, or 'UNKNOWN' if the character set isn't supported
+     * @since	1.0
+     */
+    static CodePage getCodePageFromCharsetName(const char* charsetName);
+
+    /**
+     * Checks if a code page is one of the EBCDIC code pages, that aren't ASCII compatible.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	codePage	the code page from CodePage enumeration
+     * @return	'true' if it's an EBCDIC code page, 'false' otherwise
+     * @since	1.0
+     */
+    inline static bool isCodePageEbcdic(const CodePage codePage)
+    {
+        bool bRet = ((codePage == CodePage::EBCDIC_CP037) ||
+                     (codePage == CodePage::EBCDIC_CP500) ||
+                     (codePage == CodePage::EBCDIC_CP875) ||
+                     (codePage == CodePage::EBCDIC_CP1047));
+
+        return bRet;
+    }
+
+    /**
+     * Checks if every character of a code page can be represented in another code page, so the translation
+     * between them never loses characters.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	fromCodePage	the code page from CodePage enumeration of the characters to be translated
+     * @param	toCodePage		the code page from CodePage enumeration of the translated characters
+     * @return	'true' if the translation is lossless, 'false' otherwise or if any of the code pages is a Unicode encoding
+     * @since	1.0
+     */
+    static bool isCodePageTranslationLossless(const CodePage fromCodePage, const CodePage toCodePage);
+
+    /**
+     * Checks if the narrow character set code page is UTF-8, according the compile time definition.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	'true' if the default narrow character set code page is UTF-8, 'false' otherwise
+     * @since	1.0
+     */
+    // inline static bool isNarrowCharUtf8(void)
+    // {
+    // return (__CHAR_NARROW_TYPE == __CHAR_NARROW_TYPE_UTF8);
+    // };
+
+    /**
+     * Checks if the narrow character set code page is UCS-2/UTF-16,
+     * according the compile time definition.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	'true' if the default narrow character set code page is UTF-16, 'false' otherwise
+     * @since	1.0
+     */
+    inline static bool isWideCharUtf16(void)
+    {
+        // return (__CHAR_WIDE_TYPE == __CHAR_WIDE_TYPE_UTF16);
+        return sizeof(wchar_t) == 2;
+    }
+
+    /**
+     * Checks if the narrow character set code page is UCS-4/UTF-32, according the compile time definition.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	'true' if the default narrow character set code page is UTF-32, 'false' otherwise
+     * @since	1.0
+     */
+    inline static bool isWideCharUtf32(void)
+    {
+        // return (__CHAR_WIDE_TYPE == __CHAR_WIDE_TYPE_UTF32);
+        return sizeof(wchar_t) == 4;
+    }
+
+    /**
+     * Checks if the application preferable wide character set is Unicode UCS-2/UCS-4/UTF-16/UTF-32,
+     * according the compile time definition.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	'true' if the preferable character set is Unicode UTF-16/UTF-32,
+     *          'false' if is ASCII, UTF-8, MBCS or otherwise
+     * @since	1.0
+     */
+    inline static bool isApplicationApiWideUnicode(void)
+    {
+        // return (__CHAR_API_TYPE == __CHAR_API_TYPE_WIDE);
+#if defined(_UNICODE)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Checks if the application preferable character set API is MBCS,
+     * according the compile time definition.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	'true' if the preferable character set is MBCS,
+     *          'false' if is Unicode, ASCII or otherwise
+     * @since	1.0
+     */
+    inline static bool isApplicationApiMbcs(void)
+    {
+        // return (__CHAR_API_TYPE == __CHAR_API_TYPE_WIDE);
+#if defined(_MBCS) && !defined(_UNICODE)
+            return true;
+#else
+            return false;
+#endif
+    }
+
+    /**
+     * Checks if the application preferable narrow character set API is ASCII,
+     * according the compile time definition.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	'true' if the preferable character set is ASCII,
+     *          'false' if is Unicode, MBCS or otherwise
+     * @since	1.0
+     */
+    inline static bool isApplicationApiNarrowAscii(void)
+    {
+        // return (__CHAR_API_TYPE == __CHAR_API_TYPE_WIDE);
+#if !defined(_MBCS) && !defined(_UNICODE)
+#   if defined(_WIN32)
+        // Windows narrow character is ASCII, and the console doesn't support UTF-8 for compatibility with DOS
+        return true;
+#   else
+        // Mac OS X, Linux and other UNIX and POSIX based OS are UTF-8 nowadays
+        return false;
+#   endif
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Checks if the application preferable narrow character set API is UTF-8,
+     * according the compile time definition.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	'true' if the preferable character set is UTF-8,
+     *          'false' if is UTF-16, UTF-32, ASCII, MBCS or otherwise
+     * @since	1.0
+     */
+    inline static bool isApplicationApiNarrowUtf8(void)
+    {
+        // return (__CHAR_API_TYPE == __CHAR_API_TYPE_WIDE);
+#if !defined(_MBCS) && !defined(_UNICODE)
+#   if !defined(_WIN32)
+        // Mac OS X, Linux and other UNIX and POSIX based OS are UTF-8 nowadays
+        return true;
+#   else
+        // Windows narrow character is ASCII, and the console doesn't support UTF-8 for compatibility with DOS
+        return false;
+#   endif
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Checks if the supplied UTF-32 character is a scalar,
+     * according to the Unicode 6.3 .
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf32	the UTF-32 character to be tested
+     * @return	'true' if the character is a scalar,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUnicodeScalar(const char32_t charUtf32)
+    {
+        bool bRet = (((charUtf32 >= UNICODE_MINIMUM) && (charUtf32 < UNICODE_HIGH_SURROGATE_START)) ||
+                     ((charUtf32 > UNICODE_LOW_SURROGATE_END) && (charUtf32 <= UNICODE_MAXIMUM)));
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-32 character is a sentinel (a end of string, list, etc.),
+     * according to the Unicode 6.3 .
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf32	the UTF-32 character to be tested
+     * @return	'true' if the character is a sentinel,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUnicodeSentinel(const char32_t charUtf32)
+    {
+        bool bRet = ((charUtf32 == UNICODE_MINIMUM) || (charUtf32 == 0xFFFFUL) ||
+                     (charUtf32 == UNICODE_MAXIMUM));
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-32 character is a non-character (used internal for the application),
+     * according to the Unicode 6.3 .
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf32	the UTF-32 character to be tested
+     * @return	'true' if the character is a non-character,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUnicodeNonCharacter(const char32_t charUtf32)
+    {
+        // BMP U+FDD0 to U+FDEF, 0xFFFE and 0xFFFF are non-characters,
+        // the last two code points of each of the 16 supplementary planes: U+1FFFE, U+1FFFF, U+2FFFE, U+2FFFF, ... U+10FFFE, U+10FFFF
+        bool bRet = (((charUtf32 >= 0xFDD0UL) && (charUtf32 <= 0xFDEFUL)) ||
+                     ((charUtf32 & 0xFFFEUL) == 0xFFFEUL) ||
+                     ((charUtf32 & 0xFFFFUL) == 0xFFFFUL));
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-32 character from the Private Use Area (PUA), normally used by IME input systems,
+     * according to the Unicode 6.3 .
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf32	the UTF-32 character to be tested
+     * @return	'true' if the character is a PUA,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUnicodePrivateUseCharacter(const char32_t charUtf32)
+    {
+        // BMP U+E000 to U+F8FF, U+F0000 to U+FFFFD and U+100000 to U+10FFFD are Private Use Area (PUA)
+        bool bRet = (((charUtf32 >= 0xE000UL) && (charUtf32 <= 0xF8FFUL)) ||
+                     ((charUtf32 >= 0xF0000UL) && (charUtf32 <= 0xFFFFDUL)) ||
+                     ((charUtf32 >= 0x100000UL) && (charUtf32 <= 0x10FFFDUL)));
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-32 character is C0 control code,
+     * according to the Unicode 6.3 .
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf32	the UTF-32 character to be tested
+     * @return	'true' if the character is a C0 control code,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUnicodeC0ControlCharacter(const char32_t charUtf32)
+    {
+        bool bRet = (((charUtf32 >= UNICODE_MINIMUM) && (charUtf32 <= 0x001FUL)) ||
+                     (charUtf32 >= 0x007FUL));
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-32 character is C1 control code,
+     * according to the Unicode 6.3 .
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf32	the UTF-32 character to be tested
+     * @return	'true' if the character is a C1 control code,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUnicodeC1ControlCharacter(const char32_t charUtf32)
+    {
+        bool bRet = ((charUtf32 >= 0x0080UL) && (charUtf32 <= 0x009FUL));
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-32 character is a C0 or C1 control code,
+     * according to the Unicode 6.3 .
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf32	the UTF-32 character to be tested
+     * @return	'true' if the character is a control code,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUnicodeControlCharacter(const char32_t charUtf32)
+    {
+        bool bRet = (isUnicodeC0ControlCharacter(charUtf32) || isUnicodeC1ControlCharacter(charUtf32));
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-32 character is a interchangeable code point,
+     * according to the Unicode 6.3 .
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf32	the UTF-32 character to be tested
+     * @return	'true' if the character is a interchangeable code point,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUnicodeInterchangeCharacter(const char32_t charUtf32)
+    {
+        // FIXME: Is OK to consider Unicode surrogates interchangeable?
+        bool bRet = ((charUtf32 <= UNICODE_MAXIMUM) && !isUnicodeNonCharacter(charUtf32));
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-8 code unit is a first in sequence surrogate.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf8	the UTF-8 code unit to be tested
+     * @return	'true' if the UTF-8 code unit is a first in sequence surrogate,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUtf8FirstSurrogate(const char charUtf8)
+    {
+        unsigned char _charUtf8 = static_cast<unsigned char>(charUtf8);
+        bool bRet = false;
+
+        if((_charUtf8 >= (unsigned char)UTF8_LEAD_BYTES2) && (_charUtf8 < (unsigned char)UTF8_LEAD_BYTES3))
+        {
+            bRet = true;
+        }
+        else if((_charUtf8 >= (unsigned char)UTF8_LEAD_BYTES3) && (_charUtf8 < (unsigned char)UTF8_LEAD_BYTES4))
+        {
+            bRet = true;
+        }
+        else if((_charUtf8 >= (unsigned char)UTF8_LEAD_BYTES4) && (_charUtf8 < (unsigned char)UTF8_LEAD_BYTES5))
+        {
+            bRet = true;
+        }
+        else if((_charUtf8 >= (unsigned char)UTF8_LEAD_BYTES5) && (_charUtf8 < (unsigned char)UTF8_LEAD_BYTES6))
+        {
+            bRet = true;
+        }
+        else if(_charUtf8 == ((unsigned char)UTF8_LEAD_BYTES6))
+        {
+            bRet = true;
+        }
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-8 code unit is a next in sequence surrogate.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf8	the UTF-8 code unit to be tested
+     * @return	'true' if the UTF-8 code unit is a next in sequence surrogate,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUtf8NextSurrogate(const char charUtf8)
+    {
+        bool bRet = ((charUtf8 >= (char)UTF8_NEXT) && (charUtf8 <= (char)0xBFU));
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-8 code unit is a next in sequence surrogate that continues a well-formed
+     * sequence, following the well-formed UTF-8 byte sequences table of the Unicode Standard: the second code
+     * unit can't make an overlong form, an UTF-16 surrogate or a code point above U+10FFFF, and the overlong
+     * 2 bytes leads (0xC0, 0xC1) and the leads above U+10FFFF can't be continued.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf8Lead	the UTF-8 lead code unit of the sequence
+     * @param	position		the position of the code unit in the sequence, after the lead [1; 3]
+     * @param	charUtf8		the UTF-8 code unit to be tested
+     * @return	'true' if the UTF-8 code unit continues the sequence,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUtf8NextSurrogateOf(const char charUtf8Lead, const size_t position, const char charUtf8)
+    {
+        unsigned char _charUtf8Lead = static_cast<unsigned char>(charUtf8Lead);
+        unsigned char _charUtf8 = static_cast<unsigned char>(charUtf8);
+        unsigned char nextMin = 0x80U;
+        unsigned char nextMax = 0xBFU;
+        if(position == 1)
+        {
+            if(_charUtf8Lead == 0xE0U)
+            {
+                nextMin = 0xA0U;
+            }
+            else if(_charUtf8Lead == 0xEDU)
+            {
+                nextMax = 0x9FU;
+            }
+            else if(_charUtf8Lead == 0xF0U)
+            {
+                nextMin = 0x90U;
+            }
+            else if(_charUtf8Lead == 0xF4U)
+            {
+                nextMax = 0x8FU;
+            }
+        }
+        bool bRet = ((_charUtf8Lead >= 0xC2U) && (_charUtf8Lead <= 0xF4U) && (position < getCodeUnitsForUtf8Leads(charUtf8Lead)) &&
+                     (_charUtf8 >= nextMin) && (_charUtf8 <= nextMax));
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-8 code unit is a surrogate.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf8	the UTF-8 code unit to be tested
+     * @return	'true' if the UTF-8 code unit is a surrogate,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUtf8Surrogate(const char charUtf8)
+    {
+        unsigned char _charUtf8 = static_cast<unsigned char>(charUtf8);
+        bool bRet = ((_charUtf8 & 0x80U) != 0);
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-16 code unit is a high surrogate.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf16	the UTF-16 code unit to be tested
+     * @return	'true' if the UTF-16 code unit is a high surrogate,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUtf16HighSurrogate(const char16_t charUtf16)
+    {
+        bool bRet = ((charUtf16 >= UNICODE_HIGH_SURROGATE_START) && (charUtf16 <= UNICODE_HIGH_SURROGATE_END));
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-16 code unit is a low surrogate.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf16	the UTF-16 code unit to be tested
+     * @return	'true' if the UTF-16 code unit is a low surrogate,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUtf16LowSurrogate(const char16_t charUtf16)
+    {
+        bool bRet = ((charUtf16 >= UNICODE_LOW_SURROGATE_START) && (charUtf16 <= UNICODE_LOW_SURROGATE_END));
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-16 code unit is a surrogate.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf16	the UTF-16 code unit to be tested
+     * @return	'true' if the UTF-16 code unit is a surrogate,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUtf16Surrogate(const char16_t charUtf16)
+    {
+        bool bRet = (isUtf16HighSurrogate(charUtf16) || isUtf16LowSurrogate(charUtf16));
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-32 code point is in the UTF-16 surrogates range [U+D800; U+DFFF],
+     * which are not Unicode scalar values and can't be encoded.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf32	the UTF-32 code point to be tested
+     * @return	'true' if the UTF-32 code point is a surrogate code point,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUnicodeSurrogateCodePoint(const char32_t charUtf32)
+    {
+        bool bRet = ((charUtf32 >= UNICODE_HIGH_SURROGATE_START) && (charUtf32 <= UNICODE_LOW_SURROGATE_END));
+
+        return bRet;
+    }
+
+    /**
+     * Checks if the supplied UTF-32 code unit is a surrogate.<br />
+     * As Unicode 6.3, there aren't UTF-32 surrogates because the higher code point in use is 21-bit.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf32	the UTF-32 code unit to be tested
+     * @return	'true' if the UTF-32 code unit is a surrogate,
+     *          'false' if isn't
+     * @since	1.0
+     */
+    inline static bool isUtf32Surrogate(const char32_t charUtf32)
+    {
+        bool bRet = false;
+        // As Unicode 7.0, no UTF-32 surrogates exist
+        return bRet;
+    }
+
+    /**
+     * Check if the given string is a valid UTF-8 sequence.
+     *
+     * Valid UTF-8 code point units sequences look like this (RFC 3629):
+     *      0xxxxxxx<br />
+     *      110xxxxx 10xxxxxx<br />
+     *      1110xxxx 10xxxxxx 10xxxxxx<br />
+     *      11110xxx 10xxxxxx 10xxxxxx 10xxxxxx<br />
+     * The overlong forms, the UTF-16 surrogates [U+D800; U+DFFF], the code points above U+10FFFF and
+     * the patterns of the first specification (5 and 6 bytes sequences) are rejected.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf8String      the UTF-8 encoded character string to be tested
+     * @param	utf8Lenght      the length in bytes of the UTF-8 encoded character string
+     * @param	unicodeFound	optional out parameter (defaults to NULL) that if not NULL,
+     *                          the value 'true' means that at least one UTF-8 surrogate has found,
+     *                          and 'false' that the string only contains ANSI ASCII values
+     * @param	errorOffset		optional out parameter (defaults to NULL) that if not NULL, receives the offset
+     *                          of the first invalid UTF-8 sequence, or the length of the string if it's valid
+     * @return	'true' if it's a valid UTF-8 string, 'false' otherwise
+     * @since	1.0
+     */
+    static bool isUtf8(const char* utf8String, const size_t utf8Lenght, bool* unicodeFound = nullptr, size_t* errorOffset = nullptr);
+
+    inline static bool isUtf8(const string& utf8String, bool* unicodeFound = nullptr, size_t* errorOffset = nullptr)
     {
-        char32_t code = static_cast<char32_t>(static_cast<unsigned char>(narrowChar));
+        return isUtf8(utf8String.c_str(), utf8String.length(), unicodeFound, errorOffset);
+    }
 
-        // Validate parameters
-#if defined(_DEBUG)
-        assert((code >= 128) && (code <= 255));
-#endif
+    static bool hasUtf7Bom(const string& str);
 
-        switch(code)
-        {
-            case 164:
-                // "¤" changed to "€"
-                return (char32_t)0x20AC;
+    static bool hasUtf8Bom(const string& str);
 
-                break;
+    static bool hasUtf16BeBom(const u16string& str);
 
-            case 166:
-                // "¦" changed to "Š"
-                return (char32_t)0x0160;
+    static bool hasUtf16LeBom(const u16string& str);
 
-                break;
+    inline static bool hasUtf16Bom(const u16string& str)
+    {
+        return hasUtf16LeBom(str) || hasUtf16BeBom(str);
+    }
 
-            case 168:
-                // "¨" changed to "š"
-                return (char32_t)0x0161;
+    static bool hasUtf32BeBom(const u32string& str);
 
-                break;
+    static bool hasUtf32LeBom(const u32string& str);
 
-            case 180:
-                // "´" changed to "Ž"
-                return (char32_t)0x017D;
+    inline static bool hasUtf32Bom(const u32string& str)
+    {
+        return hasUtf32LeBom(str) || hasUtf32BeBom(str);
+    }
 
-                break;
+    string removeUtf8Bom(const string& str);
 
-            case 184:
-                // "¸" changed to "ž"
-                return (char32_t)0x017E;
+    /**
+     * Detects the encoding of a byte buffer, checking the BOMs (Byte Order Markers) of all the Unicode
+     * encodings against its first bytes and, when there's none, validating the buffer as UTF-8 with
+     * SIMD instructions when available.<br />
+     * The BOM isn't copied nor removed, the payload is the view that starts at the header length.
+     * An UTF-7 BOM shares its last base64 character with the text, unless it's closed by a '-', so
+     * only the "+/v8-" form is counted in the header length.<br />
+     * The buffer may be the prefix of a longer stream, so an incomplete UTF-8 sequence at its end
+     * doesn't prevent the detection.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	buffer	the bytes to be checked
+     * @param	length	the number of bytes
+     * @return	the detected code page, the BOM length and the byte order of the code units
+     * @since	1.0
+     */
+    static EncodingDetectionResult detectEncoding(const void* buffer, const size_t length);
 
-                break;
+    /**
+     * Detects the 8-bit code page of a buffer without BOM that isn't valid UTF-8, scoring the histogram
+     * of its extended ASCII characters against the letter frequency and box drawing range models of
+     * the DOS, Macintosh, Windows and ISO/IEC Latin 1 and Greek code pages.<br />
+     * Large inputs are sampled in evenly spaced blocks instead of fully scanned.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	buffer	the bytes to be checked
+     * @param	length	the number of bytes
+     * @return	the candidate code pages, from the best to the worst fit, or only 'US_ASCII' (with
+     *          confidence 1.0) if the buffer doesn't have extended ASCII characters
+     * @since	1.0
+     */
+    static vector<CodePageCandidate> detectCodePage(const void* buffer, const size_t length);
 
-            case 188:
-                // "¼" changed to "Œ"
-                return (char32_t)0x0152;
+    /**
+     * Gets the flattened 256-entry decoding table of a given 8-bit code page, that maps every byte
+     * value directly to the equivalent UTF-32 code point.<br />
+     * Code pages without a map are decoded as 7-bit ASCII, with the extended ASCII characters
+     * [128; 255] mapped to the Unicode replacement character.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	codePage			the code page from CodePage enumeration
+     * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+     *                              also converts ASCII control codes [0; 31, 127] to Unicode
+     * @return	the 256-entry decoding table of the code page
+     * @since	1.0
+     */
+    static const char32_t* getCodePageTable(const CodePage codePage, const bool convertAsciiControl = false);
 
-                break;
+    /**
+     * Converts an 8-bit extended ASCII character from a given code page to the equivalent UTF-32 code point,
+     * based on it's' code page and if control codes less or equal to 127 are to be converted.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowChar			the ASCII character [0; 255] to be converted
+     * @param	codePage			the code page from CodePage enumeration that the narrow character belongs to
+     * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+     *                              also converts ASCII control codes [0; 31, 127] to Unicode
+     * @return	the equivalent UTF-32 code point
+     * @since	1.0
+     */
+    static char32_t convertCharAscii_to_CharUtf32(const char narrowChar, const CodePage codePage, const bool convertAsciiControl = false);
 
-            case 189:
-                // "½" changed to "œ"
-                return (char32_t)0x0153;
+    /**
+     * Converts an 8-bit extended ASCII encoded string from a given code page to the equivalent UTF-32 encoded string,
+     * based on it's code page and if control codes less or equal to 127 are to be converted.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowString		the ASCII encoded string to be converted
+     * @param	codePage			the code page from CodePage enumeration that the ASCII string belongs to
+     * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+     *                              also converts ASCII control codes [0; 31, 127] to Unicode
+     * @return	the equivalent UTF-32 encoded string
+     * @since	1.0
+     */
+    static u32string convertStringAscii_to_StringUtf32(const string& narrowString, const CodePage codePage, const bool convertAsciiControl = false);
 
-                break;
+    /**
+     * Converts an 8-bit extended ASCII encoded string from a given code page directly to the equivalent UTF-8 encoded string,
+     * based on it's code page and if control codes less or equal to 127 are to be converted.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowString		the ASCII encoded string to be converted
+     * @param	codePage			the code page from CodePage enumeration that the ASCII string belongs to
+     * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+     *                              also converts ASCII control codes [0; 31, 127] to Unicode
+     * @return	the equivalent UTF-8 encoded string
+     * @since	1.0
+     */
+    static string convertStringAscii_to_StringUtf8(const string& narrowString, const CodePage codePage, const bool convertAsciiControl = false);
 
-            case 190:
-                // "¾" changed to "Ÿ"
-                return (char32_t)0x0178;
+    /**
+     * Converts an 8-bit extended ASCII encoded string from a given code page directly to the equivalent UTF-16 encoded string,
+     * based on it's code page and if control codes less or equal to 127 are to be converted.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowString		the ASCII encoded string to be converted
+     * @param	codePage			the code page from CodePage enumeration that the ASCII string belongs to
+     * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+     *                              also converts ASCII control codes [0; 31, 127] to Unicode
+     * @return	the equivalent UTF-16 encoded string
+     * @since	1.0
+     */
+    static u16string convertStringAscii_to_StringUtf16(const string& narrowString, const CodePage codePage, const bool convertAsciiControl = false);
+
+    /**
+     * Converts an UTF-32 code point to the equivalent 8-bit extended ASCII character of a given code page.<br />
+     * Both the characters and the control code glyphs of the code page are mapped back.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf32			the UTF-32 code point to be converted
+     * @param	codePage			the code page from CodePage enumeration of the ASCII character
+     * @param	narrowChar			receives the equivalent ASCII character, if the code point is mappable
+     * @return	'true' if the code point can be represented in the code page, 'false' otherwise
+     * @since	1.0
+     */
+    static bool convertCharUtf32_to_CharAscii(const char32_t charUtf32, const CodePage codePage, char& narrowChar);
+
+    /**
+     * Converts an UTF-32 encoded string to the equivalent 8-bit extended ASCII encoded string of a given code page.<br />
+     * The 8-bit code pages without a map only represent the 7-bit ASCII characters, UTF-8 is
+     * encoded directly and the code pages with 16-bit or 32-bit code units aren't narrow encodings.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf32String			the UTF-32 encoded string to be converted
+     * @param	codePage			the code page from CodePage enumeration of the ASCII string
+     * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+     *                              with the characters that can't be represented in the code page
+     * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+     *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+     * @return	the equivalent ASCII encoded string
+     * @since	1.0
+     */
+    static string convertStringUtf32_to_StringAscii(const u32string& utf32String, const CodePage codePage,
+                                                    const UnmappableAction unmappableAction = UnmappableAction::REPLACE,
+                                                    const char replacementChar = ASCII_REPLACEMENT_CHARACTER);
+
+    /**
+     * Converts an UTF-8 encoded string directly to the equivalent 8-bit extended ASCII encoded string of a given
+     * code page, without going through UTF-32.<br />
+     * ISO-8859-1 (Latin-1) and the code pages based on it (ISO-8859-15 and Windows-1252) are narrowed with
+     * SIMD instructions when available, with their own characters handled separately. The 8-bit code pages
+     * without a map only represent the 7-bit ASCII characters, and the Unicode encodings aren't narrow 8-bit
+     * code pages. The invalid UTF-8 sequences are unmappable characters.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf8String			the UTF-8 encoded string to be converted
+     * @param	codePage			the code page from CodePage enumeration of the ASCII string
+     * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+     *                              with the characters that can't be represented in the code page
+     * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+     *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+     * @return	the equivalent ASCII encoded string
+     * @since	1.0
+     */
+    static string convertStringUtf8_to_StringAscii(const string& utf8String, const CodePage codePage,
+                                                   const UnmappableAction unmappableAction = UnmappableAction::REPLACE,
+                                                   const char replacementChar = ASCII_REPLACEMENT_CHARACTER);
+
+    /**
+     * Converts an UTF-16 encoded string directly to the equivalent 8-bit extended ASCII encoded string of a given
+     * code page, without going through UTF-32.<br />
+     * ISO-8859-1 (Latin-1) and the code pages based on it (ISO-8859-15 and Windows-1252) are narrowed with
+     * SIMD instructions when available, with their own characters handled separately, and the other 8-bit
+     * code pages through their encoding tables. The 8-bit code pages without a map only represent the 7-bit
+     * ASCII characters, and the Unicode encodings aren't narrow 8-bit code pages. The unpaired surrogates
+     * are unmappable characters.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf16String			the UTF-16 encoded string to be converted
+     * @param	codePage			the code page from CodePage enumeration of the ASCII string
+     * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+     *                              with the characters that can't be represented in the code page
+     * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+     *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+     * @return	the equivalent ASCII encoded string
+     * @since	1.0
+     */
+    static string convertStringUtf16_to_StringAscii(const u16string& utf16String, const CodePage codePage,
+                                                    const UnmappableAction unmappableAction = UnmappableAction::REPLACE,
+                                                    const char replacementChar = ASCII_REPLACEMENT_CHARACTER);
+
+    /**
+     * Translates an 8-bit extended ASCII encoded string of a given code page to the equivalent encoded string
+     * of another code page, byte to byte, without going through UTF-32.<br />
+     * The 8-bit code pages without a map only represent the 7-bit ASCII characters, and the Unicode
+     * encodings aren't translated.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowString		the ASCII encoded string to be translated
+     * @param	fromCodePage		the code page from CodePage enumeration of the string to be translated
+     * @param	toCodePage			the code page from CodePage enumeration of the translated string
+     * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+     *                              with the characters that can't be represented in the target code page
+     * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+     *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+     * @return	the equivalent ASCII encoded string of the target code page
+     * @since	1.0
+     */
+    static string translateStringCodePage(const string& narrowString, const CodePage fromCodePage, const CodePage toCodePage,
+                                         const UnmappableAction unmappableAction = UnmappableAction::REPLACE,
+                                         const char replacementChar = ASCII_REPLACEMENT_CHARACTER);
+
+    /**
+     * Converts a system narrow character encoded string to the equivalent system wide character encoded string.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowString		the system narrow character encoded string to be converted
+     * @return	the equivalent system wide character string
+     * @since	1.0
+     */
+    static wstring convertStringNarrow_to_StringWide(const string& narrowString);
+
+    /**
+     * Converts a system wide character encoded string to the equivalent system narrow character encoded string.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	wideString		the system wide character encoded string to be converted
+     * @return	the equivalent system narrow character string
+     * @since	1.0
+     */
+    static string convertStringWide_to_StringNarrow(const wstring& wideString);
+
+    /**
+     * Converts an UTF-16 encoded string to the equivalent UTF-32 encoded string.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf16String			the UTF-16 encoded string to be converted
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+     * @return	the equivalent UTF-32 encoded string
+     * @since	1.0
+     */
+    static u32string convertStringUtf16_to_StringUtf32(const u16string& utf16String, const bool strictConversion);
+
+    /**
+     * Converts an UTF-32 encoded string to the equivalent UTF-16 encoded string.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf32String			the UTF-32 encoded string to be converted
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+     * @return	the equivalent UTF-16 encoded string
+     * @since	1.0
+     */
+    static u16string convertStringUtf32_to_StringUtf16(const u32string& utf32String, const bool strictConversion = false);
+
+    /**
+     * Converts an UTF-16 encoded string to the equivalent system wide character encoded string.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf16String			the UTF-16 encoded string to be converted
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+     * @return	the equivalent wide character encoded string
+     * @since	1.0
+     */
+    inline static wstring convertStringUtf16_to_StringWide(const u16string& utf16String, const bool strictConversion = false)
+    {
+        wstring strRet;
+
+        if(isWideCharUtf16())
+        {
+            // wchar_t is UCS-2/UTF-16
+            strRet = convertStringUtf16_to_StringWide2(utf16String, strictConversion);
+        }
+        else
+        {
+            // wchar_t is UCS-4/UTF-32
+            strRet = convertStringUtf16_to_StringWide4(utf16String, strictConversion);
+        }
+
+        return strRet;
+    }
+
+    /**
+     * Converts a system wide character encoded string to the equivalent UTF-16 encoded string.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	wideString			the system wide character encoded string to be converted
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+     * @return	the equivalent UTF-16 encoded string
+     * @since	1.0
+     */
+    inline static u16string convertStringWide_to_StringUtf16(const wstring& wideString, const bool strictConversion = false)
+    {
+        u16string strRet;
 
-                break;
+        if(isWideCharUtf16())
+        {
+            // wchar_t is UCS-2/UTF-16
+            strRet = convertStringWide2_to_StringUtf16(wideString, strictConversion);
+        }
+        else
+        {
+            // wchar_t is UCS-4/UTF-32
+            strRet = convertStringWide4_to_StringUtf16(wideString, strictConversion);
         }
 
-        return code;
+        return strRet;
     }
 
     /**
-     * Converts an UTF-16 encoded string to the equivalent 2 bytes system wide character encoded string.
+     * Converts an UTF-32 encoded string to the equivalent system wide character encoded string.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	utf16String			the UTF-16 encoded string to be converted
+     * @param	utf32String			the UTF-32 encoded string to be converted
      * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
      *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent 2 bytes system wide character encoded string
+     * @return	the equivalent wide character encoded string
      * @since	1.0
      */
-    static wstring convertStringUtf16_to_StringWide2(const u16string& utf16String, const bool strictConversion = false);
+    inline static wstring convertStringUtf32_to_StringWide(const u32string& utf32String, const bool strictConversion = false)
+    {
+        wstring strRet;
+
+        if(isWideCharUtf16())
+        {
+            // wchar_t is UCS-2/UTF-16
+            strRet = convertStringUtf32_to_StringWide2(utf32String, strictConversion);
+        }
+        else
+        {
+            // wchar_t is UCS-4/UTF-32
+            strRet = convertStringUtf32_to_StringWide4(utf32String, strictConversion);
+        }
+
+        return strRet;
+    }
 
     /**
-     * Converts a 2 bytes system wide character encoded string to the equivalent UTF-16 encoded string.
+     * Converts a system wide character encoded string to the equivalent UTF-32 encoded string.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	wideString			the 2 bytes system wide character encoded string to be converted
+     * @param	wideString			the system wide character encoded string to be converted
      * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
-     *                          invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent UTF-16 encoded string
+     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+     * @return	the equivalent UTF-32 encoded string
      * @since	1.0
      */
-    static u16string convertStringWide2_to_StringUtf16(const wstring& wideString, const bool strictConversion = false);
+    inline static u32string convertStringWide_to_StringUtf32(const wstring& wideString, const bool strictConversion = false)
+    {
+        u32string strRet;
+
+        if(isWideCharUtf16())
+        {
+            // wchar_t is UCS-2/UTF-16
+            strRet = convertStringWide2_to_StringUtf32(wideString, strictConversion);
+        }
+        else
+        {
+            // wchar_t is UCS-4/UTF-32
+            strRet = convertStringWide4_to_StringUtf32(wideString, strictConversion);
+        }
+
+        return strRet;
+    }
 
     /**
-     * Converts an UTF-16 encoded string to the equivalent 4 bytes system wide character encoded string.
+     * Converts an UTF-16 encoded string to the equivalent UTF-8 encoded string.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
      * @param	utf16String			the UTF-16 encoded string to be converted
      * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
      *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent 4 bytes system wide character encoded string
+     * @return	the equivalent UTF-8 encoded string
      * @since	1.0
      */
-    static wstring convertStringUtf16_to_StringWide4(const u16string& utf16String, const bool strictConversion = false);
+    static string convertStringUtf16_to_StringUtf8(const u16string& utf16String, const bool strictConversion = false);
 
     /**
-     * Converts a 4 bytes system wide character encoded string to the equivalent UTF-16 encoded string.
+     * Converts an UTF-8 encoded string to the equivalent UTF-16 encoded string.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	wideString			the 4 bytes system wide character encoded string to be converted
+     * @param	utf8String			the UTF-8 encoded string to be converted
      * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
-     *                          invalid conversion, if 'false' replaces invalid character width the replacement character
+     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
      * @return	the equivalent UTF-16 encoded string
      * @since	1.0
      */
-    static u16string convertStringWide4_to_StringUtf16(const wstring& wideString, const bool strictConversion = false);
+    static u16string convertStringUtf8_to_StringUtf16(const string& utf8String, const bool strictConversion = false);
 
     /**
-     * Converts an UTF-32 encoded string to the equivalent 2 bytes system wide character encoded string.
+     * Converts an UTF-32 encoded string to the equivalent UTF-8 encoded string.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
      * @param	utf32String			the UTF-32 encoded string to be converted
      * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
      *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent 2 bytes system wide character encoded string
+     * @return	the equivalent UTF-8 encoded string
      * @since	1.0
      */
-    static wstring convertStringUtf32_to_StringWide2(const u32string& utf32String, const bool strictConversion = false);
+    static string convertStringUtf32_to_StringUtf8(const u32string& utf32String, const bool strictConversion = false);
 
     /**
-     * Converts an 2 bytes system wide character encoded string to the equivalent UTF-32 encoded string.
+     * Converts an UTF-8 encoded string to the equivalent UTF-32 encoded string.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	wideString			the 2 bytes system wide character encoded string to be converted
+     * @param	utf8String			the UTF-8 encoded string to be converted
      * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
      *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent UTF-32 string
+     * @return	the equivalent UTF-32 encoded string
      * @since	1.0
      */
-    static u32string convertStringWide2_to_StringUtf32(const wstring& wideString, const bool strictConversion = false);
+    static u32string convertStringUtf8_to_StringUtf32(const string& utf8String, const bool strictConversion = false);
 
     /**
-     * Converts an UTF-32 encoded string to the equivalent 4 bytes system wide character encoded string.
+     * Converts an UTF-32 encoded string to the equivalent UTF-7 encoded string.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
      * @param	utf32String			the UTF-32 encoded string to be converted
      * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
      *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent 4 bytes system wide character encoded string
+     * @param	modifiedUtf7		optional parameter (default is 'false'), if 'true' encodes modified UTF-7 (RFC 3501)
+     * @return	the equivalent UTF-7 encoded string
      * @since	1.0
      */
-    static wstring convertStringUtf32_to_StringWide4(const u32string& utf32String, const bool strictConversion = false);
+    static string convertStringUtf32_to_StringUtf7(const u32string& utf32String, const bool strictConversion = false, const bool modifiedUtf7 = false);
 
     /**
-     * Converts an 4 bytes system wide character encoded string to the equivalent UTF-32 encoded string.
+     * Converts an UTF-7 encoded string to the equivalent UTF-32 encoded string.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	wideString			the 4 bytes system wide character encoded string to be converted
+     * @param	utf7String			the UTF-7 encoded string to be converted
      * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
      *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent UTF-32 string
+     * @param	modifiedUtf7		optional parameter (default is 'false'), if 'true' decodes modified UTF-7 (RFC 3501)
+     * @return	the equivalent UTF-32 encoded string
      * @since	1.0
      */
-    static u32string convertStringWide4_to_StringUtf32(const wstring& wideString, const bool strictConversion = false);
+    static u32string convertStringUtf7_to_StringUtf32(const string& utf7String, const bool strictConversion = false, const bool modifiedUtf7 = false);
 
-    /**
-     * Get the number of code units in bytes to decode a given UTF-8 encoded character to an Unicode code point.
-     *
-     * @author	Jos&eacute; Caetano Silva
-     * @version	%I%, %G%
-     * @param	charUtf8	the UTF-8 lead character/byte
-     * @return	the number of code units in bytes needed to decode an UTF-8 sequence
-     * @since	1.0
-     */
-    static inline size_t getCodeUnitsForUtf8Leads(char charUtf8)
+    inline static string convertStringWide_to_StringUtf8(const wstring& wideString, const bool strictConversion = false)
     {
-        size_t sequenceBytes = 0;
+        string utf8String;
+        u32string utf32String;
 
-        if(!(charUtf8 & UTF8_NEXT))
-        {
-            sequenceBytes = 1;
-        }
-        else if((char)(charUtf8 & (~UTF8_LEAD_BYTES2_MASK)) == UTF8_LEAD_BYTES2)
-        {
-            sequenceBytes = 2;
-        }
-        else if((char)(charUtf8 & (~UTF8_LEAD_BYTES3_MASK)) == UTF8_LEAD_BYTES3)
-        {
-            sequenceBytes = 3;
-        }
-        else if((char)(charUtf8 & (~UTF8_LEAD_BYTES4_MASK)) == UTF8_LEAD_BYTES4)
-        {
-            sequenceBytes = 4;
-        }
-        else if((char)(charUtf8 & (~UTF8_LEAD_BYTES5_MASK)) == UTF8_LEAD_BYTES5)
-        {
-            sequenceBytes = 5;
-        }
-        else if((char)(charUtf8 & (~UTF8_LEAD_BYTES6_MASK)) == UTF8_LEAD_BYTES6)
+        if(isWideCharUtf16())
         {
-            sequenceBytes = 6;
+            // wchar_t is UCS-2/UTF-16
+            utf32String = convertStringWide2_to_StringUtf32(wideString, strictConversion);
         }
-
-        if((sequenceBytes <= 0) || (sequenceBytes > 4))
+        else
         {
-            throw logic_error("Invalid UTF-8 sequence header value");
+            // wchar_t is UCS-4/UTF-32
+            utf32String = convertStringWide4_to_StringUtf32(wideString, strictConversion);
         }
+        utf8String = convertStringUtf32_to_StringUtf8(utf32String, strictConversion);
 
-        return sequenceBytes;
+        return utf8String;
     }
 
     /**
-     * Get the number of code units in bytes need to encode a Unicode code point to UTF-8 sequence.
+     * Converts an UTF-8 encoded string to the equivalent system wide character encoded string.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf32	the UTF-8 lead character/byte
-     * @return	the number of code units in bytes needed to encode the character in UTF-8
+     * @param	utf8String			the UTF-8 encoded string to be converted
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
+     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
+     * @return	the equivalent wide character encoded string
      * @since	1.0
      */
-    static inline size_t getCodeUnitsForUtf8Char(char32_t charUtf32)
+    inline static wstring convertStringUtf8_to_StringWide(const string& utf8String, const bool strictConversion = false)
     {
-        size_t sequenceBytes = 0;
+        wstring wideString;
+        u32string utf32String = convertStringUtf8_to_StringUtf32(utf8String, strictConversion);
 
-        if(!(charUtf32 & (~0x0000007FUL)))
-        {
-            sequenceBytes = 1;
-        }
-        else if(!(charUtf32 & (~0x000007FFUL)))
-        {
-            sequenceBytes = 2;
-        }
-        else if(!(charUtf32 & (~0x0000FFFFUL)))
-        {
-            sequenceBytes = 3;
-        }
-        else if(!(charUtf32 & (~0x001FFFFFUL)))
-        {
-            sequenceBytes = 4;
-        }
-        else if(!(charUtf32 & (~0x03FFFFFFUL)))
-        {
-            sequenceBytes = 5;
-        }
-        else if(!(charUtf32 & (~0x7FFFFFFFUL)))
+        if(isWideCharUtf16())
         {
-            sequenceBytes = 6;
+            // wchar_t is UCS-2/UTF-16
+            wideString = convertStringUtf32_to_StringWide2(utf32String, strictConversion);
         }
-
-        if((sequenceBytes < 1) || (sequenceBytes > 4))
+        else
         {
-            throw logic_error("Invalid UTF-32 code point value");
+            // wchar_t is UCS-4/UTF-32
+            wideString = convertStringUtf32_to_StringWide4(utf32String, strictConversion);
         }
 
-        return sequenceBytes;
-    }
-
-public:
-    /**
-     * Default class 'CodePage2Unicode' constructor.
-     * Creates a mew object instance.
-     *
-     * @author	Jos&eacute; Caetano Silva
-     * @version	%I%, %G%
-     * @since	1.0
-     */
-    explicit CodePage2Unicode()
-    {
-	
-	}
-
-    /**
-     * Default class 'CodePage2Unicode' destructor.
-     * Destroys this object instance.
-     *
-     * @author	Jos&eacute; Caetano Silva
-     * @version	%I%, %G%
-     * @since	1.0
-     */
-    ~CodePage2Unicode()
-    {
-	
-	}
-
-    /**
-     * Gets the narrow character size in bytes.
-     *
-     * @author	Jos&eacute; Caetano Silva
-     * @version	%I%, %G%
-     * @return	the size in bytes of a 'char'
-     * @since	1.0
-     */
-    inline static size_t getNarrowCharByteSize(void)
-    {
-        return sizeof(char);
+        return wideString;
     }
 
     /**
-     * Gets the wide character size in bytes.
+     * Converts an UTF-8 code units buffer to an UTF-16 code units buffer, without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @return	the size in bytes of a 'wchar_t'
+     * @param	utf8String			the UTF-8 code units to be converted
+     * @param	utf8Length			the number of UTF-8 code units
+     * @param	utf16String			receives the UTF-16 code units
+     * @param	utf16Room			the room for UTF-16 code units
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+     *                              sequence, if 'false' replaces invalid character width the replacement character
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static size_t getWideCharByteSize(void)
-    {
-        return sizeof(wchar_t);
-    }
+    static ConversionResult convertUtf8_to_Utf16(const char* utf8String, const size_t utf8Length,
+                                                 char16_t* utf16String, const size_t utf16Room, const bool strictConversion = false);
 
     /**
-     * Gets the narrow/wide character size in bytes, according the compile time definition.
+     * Converts an UTF-16 code units buffer to an UTF-8 code units buffer, without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @return	the size in bytes of a '_TCHAR'
+     * @param	utf16String			the UTF-16 code units to be converted
+     * @param	utf16Length			the number of UTF-16 code units
+     * @param	utf8String			receives the UTF-8 code units
+     * @param	utf8Room			the room for UTF-8 code units
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+     *                              sequence, if 'false' replaces invalid character width the replacement character
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static size_t getTCharByteSize(void)
-    {
-        return sizeof(_TCHAR);
-    }
-
-	static CodePage getDefaultNarrowCodePage(void);
+    static ConversionResult convertUtf16_to_Utf8(const char16_t* utf16String, const size_t utf16Length,
+                                                 char* utf8String, const size_t utf8Room, const bool strictConversion = false);
 
     /**
-     * Checks if the narrow character set code page is UTF-8, according the compile time definition.
+     * Converts an UTF-8 code units buffer to an UTF-32 code points buffer, without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @return	'true' if the default narrow character set code page is UTF-8, 'false' otherwise
+     * @param	utf8String			the UTF-8 code units to be converted
+     * @param	utf8Length			the number of UTF-8 code units
+     * @param	utf32String			receives the UTF-32 code points
+     * @param	utf32Room			the room for UTF-32 code points
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+     *                              sequence, if 'false' replaces invalid character width the replacement character
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    // inline static bool isNarrowCharUtf8(void)
-    // {
-    // return (__CHAR_NARROW_TYPE == __CHAR_NARROW_TYPE_UTF8);
-    // };
+    static ConversionResult convertUtf8_to_Utf32(const char* utf8String, const size_t utf8Length,
+                                                 char32_t* utf32String, const size_t utf32Room, const bool strictConversion = false);
 
     /**
-     * Checks if the narrow character set code page is UCS-2/UTF-16,
-     * according the compile time definition.
+     * Converts an UTF-32 code points buffer to an UTF-8 code units buffer, without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
      *
-     * @author	Jos&eacute; Caetano Silva
-     * @version	%I%, %G%
-     * @return	'true' if the default narrow character set code page is UTF-16, 'false' otherwise
-     * @since	1.0
-     */
-    inline static bool isWideCharUtf16(void)
-    {
-        // return (__CHAR_WIDE_TYPE == __CHAR_WIDE_TYPE_UTF16);
-        return sizeof(wchar_t) == 2;
-    }
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf32String			the UTF-32 code points to be converted
+     * @param	utf32Length			the number of UTF-32 code points
+     * @param	utf8String			receives the UTF-8 code units
+     * @param	utf8Room			the room for UTF-8 code units
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+     *                              code point, if 'false' replaces invalid character width the replacement character
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    static ConversionResult convertUtf32_to_Utf8(const char32_t* utf32String, const size_t utf32Length,
+                                                 char* utf8String, const size_t utf8Room, const bool strictConversion = false);
 
     /**
-     * Checks if the narrow character set code page is UCS-4/UTF-32, according the compile time definition.
+     * Converts an UTF-16 code units buffer to an UTF-32 code points buffer, without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @return	'true' if the default narrow character set code page is UTF-32, 'false' otherwise
+     * @param	utf16String			the UTF-16 code units to be converted
+     * @param	utf16Length			the number of UTF-16 code units
+     * @param	utf32String			receives the UTF-32 code points
+     * @param	utf32Room			the room for UTF-32 code points
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+     *                              code unit, if 'false' replaces invalid character width the replacement character
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static bool isWideCharUtf32(void)
-    {
-        // return (__CHAR_WIDE_TYPE == __CHAR_WIDE_TYPE_UTF32);
-        return sizeof(wchar_t) == 4;
-    }
+    static ConversionResult convertUtf16_to_Utf32(const char16_t* utf16String, const size_t utf16Length,
+                                                  char32_t* utf32String, const size_t utf32Room, const bool strictConversion = false);
 
     /**
-     * Checks if the application preferable wide character set is Unicode UCS-2/UCS-4/UTF-16/UTF-32,
-     * according the compile time definition.
+     * Converts an UTF-32 code points buffer to an UTF-16 code units buffer, without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @return	'true' if the preferable character set is Unicode UTF-16/UTF-32,
-     *          'false' if is ASCII, UTF-8, MBCS or otherwise
+     * @param	utf32String			the UTF-32 code points to be converted
+     * @param	utf32Length			the number of UTF-32 code points
+     * @param	utf16String			receives the UTF-16 code units
+     * @param	utf16Room			the room for UTF-16 code units
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+     *                              code point, if 'false' replaces invalid character width the replacement character
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static bool isApplicationApiWideUnicode(void)
-    {
-        // return (__CHAR_API_TYPE == __CHAR_API_TYPE_WIDE);
-#if defined(_UNICODE)
-        return true;
-#else
-        return false;
-#endif
-    }
+    static ConversionResult convertUtf32_to_Utf16(const char32_t* utf32String, const size_t utf32Length,
+                                                  char16_t* utf16String, const size_t utf16Room, const bool strictConversion = false);
 
     /**
-     * Checks if the application preferable character set API is MBCS,
-     * according the compile time definition.
+     * Converts a 8-bit extended ASCII characters buffer from a given code page to an UTF-32 code points buffer,
+     * without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @return	'true' if the preferable character set is MBCS,
-     *          'false' if is Unicode, ASCII or otherwise
+     * @param	narrowString		the ASCII characters to be converted
+     * @param	narrowLength		the number of ASCII characters
+     * @param	utf32String			receives the UTF-32 code points
+     * @param	utf32Room			the room for UTF-32 code points
+     * @param	codePage			the code page from CodePage enumeration that the ASCII characters belong to
+     * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+     *                              also converts ASCII control codes [0; 31, 127] to Unicode
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static bool isApplicationApiMbcs(void)
-    {
-        // return (__CHAR_API_TYPE == __CHAR_API_TYPE_WIDE);
-#if defined(_MBCS) && !defined(_UNICODE)
-            return true;
-#else
-            return false;
-#endif
-    }
+    static ConversionResult convertAscii_to_Utf32(const char* narrowString, const size_t narrowLength,
+                                                  char32_t* utf32String, const size_t utf32Room,
+                                                  const CodePage codePage, const bool convertAsciiControl = false);
 
     /**
-     * Checks if the application preferable narrow character set API is ASCII,
-     * according the compile time definition.
+     * Converts a 8-bit extended ASCII characters buffer from a given code page to an UTF-8 code units buffer,
+     * without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @return	'true' if the preferable character set is ASCII,
-     *          'false' if is Unicode, MBCS or otherwise
+     * @param	narrowString		the ASCII characters to be converted
+     * @param	narrowLength		the number of ASCII characters
+     * @param	utf8String			receives the UTF-8 code units
+     * @param	utf8Room			the room for UTF-8 code units
+     * @param	codePage			the code page from CodePage enumeration that the ASCII characters belong to
+     * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+     *                              also converts ASCII control codes [0; 31, 127] to Unicode
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static bool isApplicationApiNarrowAscii(void)
-    {
-        // return (__CHAR_API_TYPE == __CHAR_API_TYPE_WIDE);
-#if !defined(_MBCS) && !defined(_UNICODE)
-#   if defined(_WIN32)
-        // Windows narrow character is ASCII, and the console doesn't support UTF-8 for compatibility with DOS
-        return true;
-#   else
-        // Mac OS X, Linux and other UNIX and POSIX based OS are UTF-8 nowadays
-        return false;
-#   endif
-#else
-        return false;
-#endif
-    }
+    static ConversionResult convertAscii_to_Utf8(const char* narrowString, const size_t narrowLength,
+                                                 char* utf8String, const size_t utf8Room,
+                                                 const CodePage codePage, const bool convertAsciiControl = false);
 
     /**
-     * Checks if the application preferable narrow character set API is UTF-8,
-     * according the compile time definition.
+     * Converts a 8-bit extended ASCII characters buffer from a given code page to an UTF-16 code units buffer,
+     * without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @return	'true' if the preferable character set is UTF-8,
-     *          'false' if is UTF-16, UTF-32, ASCII, MBCS or otherwise
+     * @param	narrowString		the ASCII characters to be converted
+     * @param	narrowLength		the number of ASCII characters
+     * @param	utf16String			receives the UTF-16 code units
+     * @param	utf16Room			the room for UTF-16 code units
+     * @param	codePage			the code page from CodePage enumeration that the ASCII characters belong to
+     * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+     *                              also converts ASCII control codes [0; 31, 127] to Unicode
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static bool isApplicationApiNarrowUtf8(void)
-    {
-        // return (__CHAR_API_TYPE == __CHAR_API_TYPE_WIDE);
-#if !defined(_MBCS) && !defined(_UNICODE)
-#   if !defined(_WIN32)
-        // Mac OS X, Linux and other UNIX and POSIX based OS are UTF-8 nowadays
-        return true;
-#   else
-        // Windows narrow character is ASCII, and the console doesn't support UTF-8 for compatibility with DOS
-        return false;
-#   endif
-#else
-        return false;
-#endif
-    }
+    static ConversionResult convertAscii_to_Utf16(const char* narrowString, const size_t narrowLength,
+                                                  char16_t* utf16String, const size_t utf16Room,
+                                                  const CodePage codePage, const bool convertAsciiControl = false);
 
     /**
-     * Checks if the supplied UTF-32 character is a scalar,
-     * according to the Unicode 6.3 .
+     * Converts an UTF-32 code points buffer to a 8-bit extended ASCII characters buffer of a given code page,
+     * without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf32	the UTF-32 character to be tested
-     * @return	'true' if the character is a scalar,
-     *          'false' if isn't
+     * @param	utf32String			the UTF-32 code points to be converted
+     * @param	utf32Length			the number of UTF-32 code points
+     * @param	narrowString		receives the ASCII characters
+     * @param	narrowRoom			the room for ASCII characters
+     * @param	codePage			the code page from CodePage enumeration of the ASCII characters
+     * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+     *                              with the characters that can't be represented in the code page
+     * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+     *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static bool isUnicodeScalar(const char32_t charUtf32)
-    {
-        bool bRet = (((charUtf32 >= UNICODE_MINIMUM) && (charUtf32 < UNICODE_HIGH_SURROGATE_START)) ||
-                     ((charUtf32 > UNICODE_LOW_SURROGATE_END) && (charUtf32 <= UNICODE_MAXIMUM)));
-
-        return bRet;
-    }
+    static ConversionResult convertUtf32_to_Ascii(const char32_t* utf32String, const size_t utf32Length,
+                                                  char* narrowString, const size_t narrowRoom, const CodePage codePage,
+                                                  const UnmappableAction unmappableAction = UnmappableAction::REPLACE,
+                                                  const char replacementChar = ASCII_REPLACEMENT_CHARACTER);
 
     /**
-     * Checks if the supplied UTF-32 character is a sentinel (a end of string, list, etc.),
-     * according to the Unicode 6.3 .
+     * Converts an UTF-8 code units buffer directly to a 8-bit extended ASCII characters buffer of a given code page,
+     * without allocations.<br />
+     * ISO-8859-1 (Latin-1) and the code pages based on it (ISO-8859-15 and Windows-1252) are narrowed with
+     * SIMD instructions when available, with their own characters handled separately. The invalid UTF-8 sequences
+     * are unmappable characters, that stop the conversion with their own status when 'unmappableAction' is
+     * 'UnmappableAction::STRICT'. The conversion stops when the output buffer is full, and can be resumed from the
+     * consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf32	the UTF-32 character to be tested
-     * @return	'true' if the character is a sentinel,
-     *          'false' if isn't
+     * @param	utf8String			the UTF-8 code units to be converted
+     * @param	utf8Length			the number of UTF-8 code units
+     * @param	narrowString		receives the ASCII characters
+     * @param	narrowRoom			the room for ASCII characters
+     * @param	codePage			the code page from CodePage enumeration of the ASCII characters
+     * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+     *                              with the characters that can't be represented in the code page
+     * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+     *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static bool isUnicodeSentinel(const char32_t charUtf32)
-    {
-        bool bRet = ((charUtf32 == UNICODE_MINIMUM) || (charUtf32 == 0xFFFFUL) ||
-                     (charUtf32 == UNICODE_MAXIMUM));
-
-        return bRet;
-    }
+    static ConversionResult convertUtf8_to_Ascii(const char* utf8String, const size_t utf8Length,
+                                                 char* narrowString, const size_t narrowRoom, const CodePage codePage,
+                                                 const UnmappableAction unmappableAction = UnmappableAction::REPLACE,
+                                                 const char replacementChar = ASCII_REPLACEMENT_CHARACTER);
 
     /**
-     * Checks if the supplied UTF-32 character is a non-character (used internal for the application),
-     * according to the Unicode 6.3 .
+     * Converts an UTF-16 code units buffer directly to a 8-bit extended ASCII characters buffer of a given code page,
+     * without allocations.<br />
+     * ISO-8859-1 (Latin-1) and the code pages based on it (ISO-8859-15 and Windows-1252) are narrowed with
+     * SIMD instructions when available, with their own characters handled separately, and the other 8-bit code
+     * pages through their encoding tables. The unpaired surrogates are unmappable characters, that stop the
+     * conversion with their own status when 'unmappableAction' is 'UnmappableAction::STRICT'. The conversion
+     * stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf32	the UTF-32 character to be tested
-     * @return	'true' if the character is a non-character,
-     *          'false' if isn't
+     * @param	utf16String			the UTF-16 code units to be converted
+     * @param	utf16Length			the number of UTF-16 code units
+     * @param	narrowString		receives the ASCII characters
+     * @param	narrowRoom			the room for ASCII characters
+     * @param	codePage			the code page from CodePage enumeration of the ASCII characters
+     * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+     *                              with the characters that can't be represented in the code page
+     * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+     *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static bool isUnicodeNonCharacter(const char32_t charUtf32)
-    {
-        // BMP U+FDD0 to U+FDEF, 0xFFFE and 0xFFFF are non-characters,
-        // the last two code points of each of the 16 supplementary planes: U+1FFFE, U+1FFFF, U+2FFFE, U+2FFFF, ... U+10FFFE, U+10FFFF
-        bool bRet = (((charUtf32 >= 0xFDD0UL) && (charUtf32 <= 0xFDEFUL)) ||
-                     ((charUtf32 & 0xFFFEUL) == 0xFFFEUL) ||
-                     ((charUtf32 & 0xFFFFUL) == 0xFFFFUL));
-
-        return bRet;
-    }
+    static ConversionResult convertUtf16_to_Ascii(const char16_t* utf16String, const size_t utf16Length,
+                                                  char* narrowString, const size_t narrowRoom, const CodePage codePage,
+                                                  const UnmappableAction unmappableAction = UnmappableAction::REPLACE,
+                                                  const char replacementChar = ASCII_REPLACEMENT_CHARACTER);
 
     /**
-     * Checks if the supplied UTF-32 character from the Private Use Area (PUA), normally used by IME input systems,
-     * according to the Unicode 6.3 .
+     * Translates an 8-bit extended ASCII characters buffer of a given code page to the equivalent characters
+     * buffer of another code page, byte to byte, without allocations and without going through UTF-32.<br />
+     * The translation table of the two code pages is composed once, and applied with SIMD byte shuffles when
+     * available, also when the unmappable characters are replaced. The output buffer can be the input buffer
+     * itself. The 8-bit code pages without a map only represent the 7-bit ASCII characters, and the Unicode
+     * encodings aren't translated. A code page is translated to itself as an identity copy. The conversion
+     * stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf32	the UTF-32 character to be tested
-     * @return	'true' if the character is a PUA,
-     *          'false' if isn't
+     * @param	sourceString		the ASCII characters to be translated
+     * @param	sourceLength		the number of ASCII characters
+     * @param	destinationString	receives the translated ASCII characters, can be the source buffer itself
+     * @param	destinationRoom		the room for translated ASCII characters
+     * @param	fromCodePage		the code page from CodePage enumeration of the characters to be translated
+     * @param	toCodePage			the code page from CodePage enumeration of the translated characters
+     * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+     *                              with the characters that can't be represented in the target code page
+     * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+     *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static bool isUnicodePrivateUseCharacter(const char32_t charUtf32)
-    {
-        // BMP U+E000 to U+F8FF, U+F0000 to U+FFFFD and U+100000 to U+10FFFD are Private Use Area (PUA)
-        bool bRet = (((charUtf32 >= 0xE000UL) && (charUtf32 <= 0xF8FFUL)) ||
-                     ((charUtf32 >= 0xF0000UL) && (charUtf32 <= 0xFFFFDUL)) ||
-                     ((charUtf32 >= 0x100000UL) && (charUtf32 <= 0x10FFFDUL)));
-
-        return bRet;
-    }
+    static ConversionResult translateCodePage(const char* sourceString, const size_t sourceLength,
+                                             char* destinationString, const size_t destinationRoom,
+                                             const CodePage fromCodePage, const CodePage toCodePage,
+                                             const UnmappableAction unmappableAction = UnmappableAction::REPLACE,
+                                             const char replacementChar = ASCII_REPLACEMENT_CHARACTER);
 
     /**
-     * Checks if the supplied UTF-32 character is C0 control code,
-     * according to the Unicode 6.3 .
+     * Translates an EBCDIC characters buffer to an ISO-8859-1 (Latin-1) characters buffer, byte to byte,
+     * without allocations.<br />
+     * It's the translation of 'translateCodePage' to 'CodePage::ISO_8859_1', with SIMD byte shuffles when available.
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf32	the UTF-32 character to be tested
-     * @return	'true' if the character is a C0 control code,
-     *          'false' if isn't
+     * @param	ebcdicString		the EBCDIC characters to be translated
+     * @param	ebcdicLength		the number of EBCDIC characters
+     * @param	latin1String		receives the Latin-1 characters
+     * @param	latin1Room			the room for Latin-1 characters
+     * @param	codePage			the EBCDIC code page from CodePage enumeration of the EBCDIC characters
+     * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+     *                              with the characters that can't be represented in Latin-1
+     * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+     *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static bool isUnicodeC0ControlCharacter(const char32_t charUtf32)
-    {
-        bool bRet = (((charUtf32 >= UNICODE_MINIMUM) && (charUtf32 <= 0x001FUL)) ||
-                     (charUtf32 >= 0x007FUL));
-
-        return bRet;
-    }
+    static ConversionResult convertEbcdic_to_Latin1(const char* ebcdicString, const size_t ebcdicLength,
+                                                    char* latin1String, const size_t latin1Room, const CodePage codePage,
+                                                    const UnmappableAction unmappableAction = UnmappableAction::REPLACE,
+                                                    const char replacementChar = ASCII_REPLACEMENT_CHARACTER);
 
     /**
-     * Checks if the supplied UTF-32 character is C1 control code,
-     * according to the Unicode 6.3 .
+     * Converts an 8-bit extended ASCII character from a code page loaded by the 'CodePageRegistry' to the
+     * equivalent UTF-32 code point.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf32	the UTF-32 character to be tested
-     * @return	'true' if the character is a C1 control code,
-     *          'false' if isn't
+     * @param	narrowChar	the ASCII character [0; 255] to be converted
+     * @param	codePage	the handle of the code page that the narrow character belongs to
+     * @return	the equivalent UTF-32 code point, or the replacement character if the handle is 'nullptr'
      * @since	1.0
      */
-    inline static bool isUnicodeC1ControlCharacter(const char32_t charUtf32)
-    {
-        bool bRet = ((charUtf32 >= 0x0080UL) && (charUtf32 <= 0x009FUL));
-
-        return bRet;
-    }
+    static char32_t convertCharAscii_to_CharUtf32(const char narrowChar, const CodePageHandle codePage);
 
     /**
-     * Checks if the supplied UTF-32 character is a C0 or C1 control code,
-     * according to the Unicode 6.3 .
+     * Converts an UTF-32 code point to the equivalent 8-bit extended ASCII character of a code page loaded by
+     * the 'CodePageRegistry'.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf32	the UTF-32 character to be tested
-     * @return	'true' if the character is a control code,
-     *          'false' if isn't
+     * @param	charUtf32	the UTF-32 code point to be converted
+     * @param	codePage	the handle of the code page of the ASCII character
+     * @param	narrowChar	receives the equivalent ASCII character, if the code point is mappable
+     * @return	'true' if the code point can be represented in the code page, 'false' otherwise
      * @since	1.0
      */
-    inline static bool isUnicodeControlCharacter(const char32_t charUtf32)
-    {
-        bool bRet = (isUnicodeC0ControlCharacter(charUtf32) || isUnicodeC1ControlCharacter(charUtf32));
-
-        return bRet;
-    }
+    static bool convertCharUtf32_to_CharAscii(const char32_t charUtf32, const CodePageHandle codePage, char& narrowChar);
 
     /**
-     * Checks if the supplied UTF-32 character is a interchangeable code point,
-     * according to the Unicode 6.3 .
+     * Converts a 8-bit extended ASCII characters buffer from a code page loaded by the 'CodePageRegistry'
+     * to an UTF-32 code points buffer, without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.<br />
+     * A lead byte of a double-byte code page that ends the buffer stops the conversion with
+     * 'ConversionStatus::INCOMPLETE_SEQUENCE', so it can be resumed with the next buffer.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf32	the UTF-32 character to be tested
-     * @return	'true' if the character is a interchangeable code point,
-     *          'false' if isn't
+     * @param	narrowString	the ASCII characters to be converted
+     * @param	narrowLength	the number of ASCII characters
+     * @param	utf32String		receives the UTF-32 code points
+     * @param	utf32Room		the room for UTF-32 code points
+     * @param	codePage		the handle of the code page that the ASCII characters belong to
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static bool isUnicodeInterchangeCharacter(const char32_t charUtf32)
-    {
-        // FIXME: Is OK to consider Unicode surrogates interchangeable?
-        bool bRet = ((charUtf32 <= UNICODE_MAXIMUM) && !isUnicodeNonCharacter(charUtf32));
-
-        return bRet;
-    }
+    static ConversionResult convertAscii_to_Utf32(const char* narrowString, const size_t narrowLength,
+                                                  char32_t* utf32String, const size_t utf32Room,
+                                                  const CodePageHandle codePage);
 
     /**
-     * Checks if the supplied UTF-8 code unit is a first in sequence surrogate.
+     * Converts a 8-bit extended ASCII characters buffer from a code page loaded by the 'CodePageRegistry'
+     * to an UTF-8 code units buffer, without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.<br />
+     * A lead byte of a double-byte code page that ends the buffer stops the conversion with
+     * 'ConversionStatus::INCOMPLETE_SEQUENCE', so it can be resumed with the next buffer.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf8	the UTF-8 code unit to be tested
-     * @return	'true' if the UTF-8 code unit is a first in sequence surrogate,
-     *          'false' if isn't
+     * @param	narrowString	the ASCII characters to be converted
+     * @param	narrowLength	the number of ASCII characters
+     * @param	utf8String		receives the UTF-8 code units
+     * @param	utf8Room		the room for UTF-8 code units
+     * @param	codePage		the handle of the code page that the ASCII characters belong to
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static bool isUtf8FirstSurrogate(const char charUtf8)
-    {
-        unsigned char _charUtf8 = static_cast<unsigned char>(charUtf8);
-        bool bRet = false;
-
-        if((_charUtf8 >= (unsigned char)UTF8_LEAD_BYTES2) && (_charUtf8 < (unsigned char)UTF8_LEAD_BYTES3))
-        {
-            bRet = true;
-        }
-        else if((_charUtf8 >= (unsigned char)UTF8_LEAD_BYTES3) && (_charUtf8 < (unsigned char)UTF8_LEAD_BYTES4))
-        {
-            bRet = true;
-        }
-        else if((_charUtf8 >= (unsigned char)UTF8_LEAD_BYTES4) && (_charUtf8 < (unsigned char)UTF8_LEAD_BYTES5))
-        {
-            bRet = true;
-        }
-        else if((_charUtf8 >= (unsigned char)UTF8_LEAD_BYTES5) && (_charUtf8 < (unsigned char)UTF8_LEAD_BYTES6))
-        {
-            bRet = true;
-        }
-        else if(_charUtf8 == ((unsigned char)UTF8_LEAD_BYTES6))
-        {
-            bRet = true;
-        }
-
-        return bRet;
-    }
+    static ConversionResult convertAscii_to_Utf8(const char* narrowString, const size_t narrowLength,
+                                                 char* utf8String, const size_t utf8Room,
+                                                 const CodePageHandle codePage);
 
     /**
-     * Checks if the supplied UTF-8 code unit is a next in sequence surrogate.
+     * Converts a 8-bit extended ASCII characters buffer from a code page loaded by the 'CodePageRegistry'
+     * to an UTF-16 code units buffer, without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.<br />
+     * A lead byte of a double-byte code page that ends the buffer stops the conversion with
+     * 'ConversionStatus::INCOMPLETE_SEQUENCE', so it can be resumed with the next buffer.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf8	the UTF-8 code unit to be tested
-     * @return	'true' if the UTF-8 code unit is a next in sequence surrogate,
-     *          'false' if isn't
+     * @param	narrowString	the ASCII characters to be converted
+     * @param	narrowLength	the number of ASCII characters
+     * @param	utf16String		receives the UTF-16 code units
+     * @param	utf16Room		the room for UTF-16 code units
+     * @param	codePage		the handle of the code page that the ASCII characters belong to
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static bool isUtf8NextSurrogate(const char charUtf8)
-    {
-        bool bRet = ((charUtf8 >= (char)UTF8_NEXT) && (charUtf8 <= (char)0xBFU));
-
-        return bRet;
-    }
+    static ConversionResult convertAscii_to_Utf16(const char* narrowString, const size_t narrowLength,
+                                                  char16_t* utf16String, const size_t utf16Room,
+                                                  const CodePageHandle codePage);
 
     /**
-     * Checks if the supplied UTF-8 code unit is a surrogate.
+     * Converts an UTF-32 code points buffer to a 8-bit extended ASCII characters buffer of a code page loaded
+     * by the 'CodePageRegistry', without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.<br />
+     * The double-byte characters are written as the lead byte followed by the trail byte.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf8	the UTF-8 code unit to be tested
-     * @return	'true' if the UTF-8 code unit is a surrogate,
-     *          'false' if isn't
+     * @param	utf32String			the UTF-32 code points to be converted
+     * @param	utf32Length			the number of UTF-32 code points
+     * @param	narrowString		receives the ASCII characters
+     * @param	narrowRoom			the room for ASCII characters
+     * @param	codePage			the handle of the code page of the ASCII characters
+     * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+     *                              with the characters that can't be represented in the code page
+     * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+     *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static bool isUtf8Surrogate(const char charUtf8)
-    {
-        unsigned char _charUtf8 = static_cast<unsigned char>(charUtf8);
-        bool bRet = ((_charUtf8 & 0x80U) != 0);
-
-        return bRet;
-    }
+    static ConversionResult convertUtf32_to_Ascii(const char32_t* utf32String, const size_t utf32Length,
+                                                  char* narrowString, const size_t narrowRoom, const CodePageHandle codePage,
+                                                  const UnmappableAction unmappableAction = UnmappableAction::REPLACE,
+                                                  const char replacementChar = ASCII_REPLACEMENT_CHARACTER);
 
     /**
-     * Checks if the supplied UTF-16 code unit is a high surrogate.
+     * Gets the number of UTF-16 code units needed to convert an UTF-8 code units buffer, counting the
+     * invalid sequences as the replacement character.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf16	the UTF-16 code unit to be tested
-     * @return	'true' if the UTF-16 code unit is a high surrogate,
-     *          'false' if isn't
+     * @param	utf8String	the UTF-8 code units
+     * @param	utf8Length	the number of UTF-8 code units
+     * @return	the number of UTF-16 code units
      * @since	1.0
      */
-    inline static bool isUtf16HighSurrogate(const char16_t charUtf16)
-    {
-        bool bRet = ((charUtf16 >= UNICODE_HIGH_SURROGATE_START) && (charUtf16 <= UNICODE_HIGH_SURROGATE_END));
-
-        return bRet;
-    }
+    static size_t getRequiredLengthUtf8_to_Utf16(const char* utf8String, const size_t utf8Length);
 
     /**
-     * Checks if the supplied UTF-16 code unit is a low surrogate.
+     * Gets the number of UTF-8 code units needed to convert an UTF-16 code units buffer, counting the
+     * invalid code units as the replacement character.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf16	the UTF-16 code unit to be tested
-     * @return	'true' if the UTF-16 code unit is a low surrogate,
-     *          'false' if isn't
+     * @param	utf16String	the UTF-16 code units
+     * @param	utf16Length	the number of UTF-16 code units
+     * @return	the number of UTF-8 code units
      * @since	1.0
      */
-    inline static bool isUtf16LowSurrogate(const char16_t charUtf16)
-    {
-        bool bRet = ((charUtf16 >= UNICODE_LOW_SURROGATE_START) && (charUtf16 <= UNICODE_LOW_SURROGATE_END));
+    static size_t getRequiredLengthUtf16_to_Utf8(const char16_t* utf16String, const size_t utf16Length);
 
-        return bRet;
-    }
+    /**
+     * Gets the number of UTF-32 code points needed to convert an UTF-8 code units buffer, counting the
+     * invalid sequences as the replacement character.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf8String	the UTF-8 code units
+     * @param	utf8Length	the number of UTF-8 code units
+     * @return	the number of UTF-32 code points
+     * @since	1.0
+     */
+    static size_t getRequiredLengthUtf8_to_Utf32(const char* utf8String, const size_t utf8Length);
 
     /**
-     * Checks if the supplied UTF-16 code unit is a surrogate.
+     * Gets the number of UTF-8 code units needed to convert an UTF-32 code points buffer, counting the
+     * invalid code points as the replacement character.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf16	the UTF-16 code unit to be tested
-     * @return	'true' if the UTF-16 code unit is a surrogate,
-     *          'false' if isn't
+     * @param	utf32String	the UTF-32 code points
+     * @param	utf32Length	the number of UTF-32 code points
+     * @return	the number of UTF-8 code units
      * @since	1.0
      */
-    inline static bool isUtf16Surrogate(const char16_t charUtf16)
+    inline static size_t getRequiredLengthUtf32_to_Utf8(const char32_t* utf32String, const size_t utf32Length)
     {
-        bool bRet = (isUtf16HighSurrogate(charUtf16) || isUtf16LowSurrogate(charUtf16));
-
-        return bRet;
+        return getUtf8Length(utf32String, utf32Length);
     }
 
     /**
-     * Checks if the supplied UTF-32 code unit is a surrogate.<br />
-     * As Unicode 6.3, there aren't UTF-32 surrogates because the higher code point in use is 21-bit.
+     * Gets the number of UTF-32 code points needed to convert an UTF-16 code units buffer, counting the
+     * invalid code units as the replacement character.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	charUtf32	the UTF-32 code unit to be tested
-     * @return	'true' if the UTF-32 code unit is a surrogate,
-     *          'false' if isn't
+     * @param	utf16String	the UTF-16 code units
+     * @param	utf16Length	the number of UTF-16 code units
+     * @return	the number of UTF-32 code points
      * @since	1.0
      */
-    inline static bool isUtf32Surrogate(const char32_t charUtf32)
-    {
-        bool bRet = false;
-        // As Unicode 7.0, no UTF-32 surrogates exist
-        return bRet;
-    }
+    static size_t getRequiredLengthUtf16_to_Utf32(const char16_t* utf16String, const size_t utf16Length);
 
     /**
-     * Check if the given string is a valid UTF-8 sequence.
-     *
-     * Valid UTF-8 code point units sequences look like this (RFC 3629):
-     *      0xxxxxxx<br />
-     *      110xxxxx 10xxxxxx<br />
-     *      1110xxxx 10xxxxxx 10xxxxxx<br />
-     *      11110xxx 10xxxxxx 10xxxxxx 10xxxxxx<br />
-     * The patterns below are not part of UTF-8, but were part of the first specification:<br />
-     *      111110xx 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx<br />
-     *      1111110x 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx<br />
+     * Gets the number of UTF-16 code units needed to convert an UTF-32 code points buffer, counting the
+     * invalid code points as the replacement character.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	utf8String      the UTF-8 encoded character string to be tested
-     * @param	utf8Lenght      the length in bytes of the UTF-8 encoded character string
-     * @param	unicodeFound	optional out parameter (defaults to NULL) that if not NULL,
-     *                          the value 'true' means that at least one UTF-8 surrogate has found,
-     *                          and 'false' that the string only contains ANSI ASCII values
-     * @return	'true' if it's a valid UTF-8 string, 'false' otherwise
+     * @param	utf32String	the UTF-32 code points
+     * @param	utf32Length	the number of UTF-32 code points
+     * @return	the number of UTF-16 code units
      * @since	1.0
      */
-    static bool isUtf8(const char* utf8String, const size_t utf8Lenght, bool* unicodeFound = nullptr);
-
-    inline static bool isUtf8(const string& utf8String, bool* unicodeFound = nullptr)
-    {
-        return isUtf8((char*)utf8String.c_str(), utf8String.length(), unicodeFound);
-    }
-
-    static bool hasUtf7Bom(const string& str);
-
-    static bool hasUtf8Bom(const string& str);
-
-    static bool hasUtf16BeBom(const u16string& str);
-
-    static bool hasUtf16LeBom(const u16string& str);
-
-    inline static bool hasUtf16Bom(const u16string& str)
-    {
-        return hasUtf16LeBom(str) || hasUtf16BeBom(str);
-    }
-
-    static bool hasUtf32BeBom(const u32string& str);
-
-    static bool hasUtf32LeBom(const u32string& str);
-
-    inline static bool hasUtf32Bom(const u32string& str)
-    {
-        return hasUtf32LeBom(str) || hasUtf32BeBom(str);
-    }
-
-    string removeUtf8Bom(const string& str);
+    static size_t getRequiredLengthUtf32_to_Utf16(const char32_t* utf32String, const size_t utf32Length);
 
     /**
-     * Converts an 8-bit extended ASCII character from a given code page to the equivalent UTF-32 code point,
-     * based on it's' code page and if control codes less or equal to 127 are to be converted.
+     * Gets the number of UTF-32 code points needed to convert a 8-bit extended ASCII characters buffer,
+     * one for each character.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowChar			the ASCII character [0; 255] to be converted
-     * @param	codePage			the code page from CodePage enumeration that the narrow character belongs to
-     * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
-     *                              also converts ASCII control codes [0; 31, 127] to Unicode
-     * @return	the equivalent UTF-32 code point
+     * @param	narrowString	the ASCII characters
+     * @param	narrowLength	the number of ASCII characters
+     * @return	the number of UTF-32 code points
      * @since	1.0
      */
-    static char32_t convertCharAscii_to_CharUtf32(const char narrowChar, const CodePage codePage, const bool convertAsciiControl = false);
+    inline static size_t getRequiredLengthAscii_to_Utf32(const char* narrowString, const size_t narrowLength)
+    {
+        // One code point for each character, whatever its value, so the characters aren't read
+        (void)narrowString;
+
+        return narrowLength;
+    }
 
     /**
-     * Converts an 8-bit extended ASCII encoded string from a given code page to the equivalent UTF-32 encoded string,
-     * based on it's code page and if control codes less or equal to 127 are to be converted.
+     * Gets the number of UTF-8 code units needed to convert a 8-bit extended ASCII characters buffer
+     * from a given code page.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowString		the ASCII encoded string to be converted
-     * @param	codePage			the code page from CodePage enumeration that the ASCII string belongs to
+     * @param	narrowString		the ASCII characters
+     * @param	narrowLength		the number of ASCII characters
+     * @param	codePage			the code page from CodePage enumeration that the ASCII characters belong to
      * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
      *                              also converts ASCII control codes [0; 31, 127] to Unicode
-     * @return	the equivalent UTF-32 encoded string
+     * @return	the number of UTF-8 code units
      * @since	1.0
      */
-    static u32string convertStringAscii_to_StringUtf32(const string& narrowString, const CodePage codePage, const bool convertAsciiControl = false);
+    static size_t getRequiredLengthAscii_to_Utf8(const char* narrowString, const size_t narrowLength,
+                                                 const CodePage codePage, const bool convertAsciiControl = false);
 
     /**
-     * Converts a system narrow character encoded string to the equivalent system wide character encoded string.
+     * Gets the number of UTF-16 code units needed to convert a 8-bit extended ASCII characters buffer,
+     * one for each character, as every character of an 8-bit code page is in the BMP.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	narrowString		the system narrow character encoded string to be converted
-     * @return	the equivalent system wide character string
+     * @param	narrowString	the ASCII characters
+     * @param	narrowLength	the number of ASCII characters
+     * @return	the number of UTF-16 code units
      * @since	1.0
      */
-    static wstring convertStringNarrow_to_StringWide(const string& narrowString);
+    inline static size_t getRequiredLengthAscii_to_Utf16(const char* narrowString, const size_t narrowLength)
+    {
+        // One code unit for each character, whatever its value, so the characters aren't read
+        (void)narrowString;
+
+        return narrowLength;
+    }
 
     /**
-     * Converts a system wide character encoded string to the equivalent system narrow character encoded string.
+     * Gets the number of 8-bit extended ASCII characters needed to convert an UTF-32 code points buffer to
+     * a given code page.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	wideString		the system wide character encoded string to be converted
-     * @return	the equivalent system narrow character string
+     * @param	utf32String			the UTF-32 code points
+     * @param	utf32Length			the number of UTF-32 code points
+     * @param	codePage			the code page from CodePage enumeration of the ASCII characters
+     * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+     *                              with the characters that can't be represented in the code page
+     * @return	the number of ASCII characters, 0 if the code page isn't supported
      * @since	1.0
      */
-    static string convertStringWide_to_StringNarrow(const wstring& wideString);
+    static size_t getRequiredLengthUtf32_to_Ascii(const char32_t* utf32String, const size_t utf32Length, const CodePage codePage,
+                                                  const UnmappableAction unmappableAction = UnmappableAction::REPLACE);
 
     /**
-     * Converts an UTF-16 encoded string to the equivalent UTF-32 encoded string.
+     * Converts an UTF-16LE byte buffer to host order UTF-16 code units, without allocations.<br />
+     * The code units are only reordered, the UTF-16 conversions validate them. A trailing partial code unit
+     * isn't consumed and is reported as an incomplete sequence, to be completed by the next buffer.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	utf16String			the UTF-16 encoded string to be converted
-     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
-     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent UTF-32 encoded string
+     * @param	utf16Bytes		the UTF-16LE bytes to be converted
+     * @param	byteLength		the number of bytes
+     * @param	utf16String		receives the UTF-16 code units
+     * @param	utf16Room		the room for UTF-16 code units
+     * @return	the conversion status, the number of bytes consumed and of code units written
      * @since	1.0
      */
-    static u32string convertStringUtf16_to_StringUtf32(const u16string& utf16String, const bool strictConversion);
+    inline static ConversionResult convertUtf16Le_to_Utf16(const char* utf16Bytes, const size_t byteLength,
+                                                           char16_t* utf16String, const size_t utf16Room)
+    {
+        ConversionResult objResult = convertByteOrder(utf16Bytes, byteLength, reinterpret_cast<char*>(utf16String),
+                                                      utf16Room * sizeof(char16_t), sizeof(char16_t), !HOST_LITTLE_ENDIAN);
+        objResult.written /= sizeof(char16_t);
+
+        return objResult;
+    }
 
     /**
-     * Converts an UTF-32 encoded string to the equivalent UTF-16 encoded string.
+     * Converts host order UTF-16 code units to an UTF-16LE byte buffer, without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	utf32String			the UTF-32 encoded string to be converted
-     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
-     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent UTF-16 encoded string
+     * @param	utf16String		the UTF-16 code units to be converted
+     * @param	utf16Length		the number of UTF-16 code units
+     * @param	utf16Bytes		receives the UTF-16LE bytes
+     * @param	byteRoom		the room for bytes
+     * @return	the conversion status, the number of code units consumed and of bytes written
      * @since	1.0
      */
-    static u16string convertStringUtf32_to_StringUtf16(const u32string& utf32String, const bool strictConversion = false);
+    inline static ConversionResult convertUtf16_to_Utf16Le(const char16_t* utf16String, const size_t utf16Length,
+                                                           char* utf16Bytes, const size_t byteRoom)
+    {
+        ConversionResult objResult = convertByteOrder(reinterpret_cast<const char*>(utf16String), utf16Length * sizeof(char16_t),
+                                                      utf16Bytes, byteRoom, sizeof(char16_t), !HOST_LITTLE_ENDIAN);
+        objResult.consumed /= sizeof(char16_t);
+
+        return objResult;
+    }
 
     /**
-     * Converts an UTF-16 encoded string to the equivalent system wide character encoded string.
+     * Converts an UTF-16BE byte buffer to host order UTF-16 code units, without allocations.<br />
+     * The code units are only reordered, the UTF-16 conversions validate them. A trailing partial code unit
+     * isn't consumed and is reported as an incomplete sequence, to be completed by the next buffer.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	utf16String			the UTF-16 encoded string to be converted
-     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
-     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent wide character encoded string
+     * @param	utf16Bytes		the UTF-16BE bytes to be converted
+     * @param	byteLength		the number of bytes
+     * @param	utf16String		receives the UTF-16 code units
+     * @param	utf16Room		the room for UTF-16 code units
+     * @return	the conversion status, the number of bytes consumed and of code units written
      * @since	1.0
      */
-    inline static wstring convertStringUtf16_to_StringWide(const u16string& utf16String, const bool strictConversion = false)
+    inline static ConversionResult convertUtf16Be_to_Utf16(const char* utf16Bytes, const size_t byteLength,
+                                                           char16_t* utf16String, const size_t utf16Room)
     {
-        wstring strRet;
-
-        if(isWideCharUtf16())
-        {
-            // wchar_t is UCS-2/UTF-16
-            strRet = convertStringUtf16_to_StringWide2(utf16String, strictConversion);
-        }
-        else
-        {
-            // wchar_t is UCS-4/UTF-32
-            strRet = convertStringUtf16_to_StringWide4(utf16String, strictConversion);
-        }
+        ConversionResult objResult = convertByteOrder(utf16Bytes, byteLength, reinterpret_cast<char*>(utf16String),
+                                                      utf16Room * sizeof(char16_t), sizeof(char16_t), HOST_LITTLE_ENDIAN);
+        objResult.written /= sizeof(char16_t);
 
-        return strRet;
+        return objResult;
     }
 
     /**
-     * Converts a system wide character encoded string to the equivalent UTF-16 encoded string.
+     * Converts host order UTF-16 code units to an UTF-16BE byte buffer, without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	wideString			the system wide character encoded string to be converted
-     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
-     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent UTF-16 encoded string
+     * @param	utf16String		the UTF-16 code units to be converted
+     * @param	utf16Length		the number of UTF-16 code units
+     * @param	utf16Bytes		receives the UTF-16BE bytes
+     * @param	byteRoom		the room for bytes
+     * @return	the conversion status, the number of code units consumed and of bytes written
      * @since	1.0
      */
-    inline static u16string convertStringWide_to_StringUtf16(const wstring& wideString, const bool strictConversion = false)
+    inline static ConversionResult convertUtf16_to_Utf16Be(const char16_t* utf16String, const size_t utf16Length,
+                                                           char* utf16Bytes, const size_t byteRoom)
     {
-        u16string strRet;
-
-        if(isWideCharUtf16())
-        {
-            // wchar_t is UCS-2/UTF-16
-            strRet = convertStringWide2_to_StringUtf16(wideString, strictConversion);
-        }
-        else
-        {
-            // wchar_t is UCS-4/UTF-32
-            strRet = convertStringWide4_to_StringUtf16(wideString, strictConversion);
-        }
+        ConversionResult objResult = convertByteOrder(reinterpret_cast<const char*>(utf16String), utf16Length * sizeof(char16_t),
+                                                      utf16Bytes, byteRoom, sizeof(char16_t), HOST_LITTLE_ENDIAN);
+        objResult.consumed /= sizeof(char16_t);
 
-        return strRet;
+        return objResult;
     }
 
     /**
-     * Converts an UTF-32 encoded string to the equivalent system wide character encoded string.
+     * Converts an UTF-32LE byte buffer to host order UTF-32 code units, without allocations.<br />
+     * The code units are only reordered, the UTF-32 conversions validate them. A trailing partial code unit
+     * isn't consumed and is reported as an incomplete sequence, to be completed by the next buffer.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	utf32String			the UTF-32 encoded string to be converted
-     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
-     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent wide character encoded string
+     * @param	utf32Bytes		the UTF-32LE bytes to be converted
+     * @param	byteLength		the number of bytes
+     * @param	utf32String		receives the UTF-32 code units
+     * @param	utf32Room		the room for UTF-32 code units
+     * @return	the conversion status, the number of bytes consumed and of code units written
      * @since	1.0
      */
-    inline static wstring convertStringUtf32_to_StringWide(const u32string& utf32String, const bool strictConversion = false)
+    inline static ConversionResult convertUtf32Le_to_Utf32(const char* utf32Bytes, const size_t byteLength,
+                                                           char32_t* utf32String, const size_t utf32Room)
     {
-        wstring strRet;
-
-        if(isWideCharUtf16())
-        {
-            // wchar_t is UCS-2/UTF-16
-            strRet = convertStringUtf32_to_StringWide2(utf32String, strictConversion);
-        }
-        else
-        {
-            // wchar_t is UCS-4/UTF-32
-            strRet = convertStringUtf32_to_StringWide4(utf32String, strictConversion);
-        }
+        ConversionResult objResult = convertByteOrder(utf32Bytes, byteLength, reinterpret_cast<char*>(utf32String),
+                                                      utf32Room * sizeof(char32_t), sizeof(char32_t), !HOST_LITTLE_ENDIAN);
+        objResult.written /= sizeof(char32_t);
 
-        return strRet;
+        return objResult;
     }
 
     /**
-     * Converts a system wide character encoded string to the equivalent UTF-32 encoded string.
+     * Converts host order UTF-32 code units to an UTF-32LE byte buffer, without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	wideString			the system wide character encoded string to be converted
-     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
-     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent UTF-32 encoded string
+     * @param	utf32String		the UTF-32 code units to be converted
+     * @param	utf32Length		the number of UTF-32 code units
+     * @param	utf32Bytes		receives the UTF-32LE bytes
+     * @param	byteRoom		the room for bytes
+     * @return	the conversion status, the number of code units consumed and of bytes written
      * @since	1.0
      */
-    inline static u32string convertStringWide_to_StringUtf32(const wstring& wideString, const bool strictConversion = false)
+    inline static ConversionResult convertUtf32_to_Utf32Le(const char32_t* utf32String, const size_t utf32Length,
+                                                           char* utf32Bytes, const size_t byteRoom)
     {
-        u32string strRet;
-
-        if(isWideCharUtf16())
-        {
-            // wchar_t is UCS-2/UTF-16
-            strRet = convertStringWide2_to_StringUtf32(wideString, strictConversion);
-        }
-        else
-        {
-            // wchar_t is UCS-4/UTF-32
-            strRet = convertStringWide4_to_StringUtf32(wideString, strictConversion);
-        }
+        ConversionResult objResult = convertByteOrder(reinterpret_cast<const char*>(utf32String), utf32Length * sizeof(char32_t),
+                                                      utf32Bytes, byteRoom, sizeof(char32_t), !HOST_LITTLE_ENDIAN);
+        objResult.consumed /= sizeof(char32_t);
 
-        return strRet;
+        return objResult;
     }
 
     /**
-     * Converts an UTF-16 encoded string to the equivalent UTF-8 encoded string.
+     * Converts an UTF-32BE byte buffer to host order UTF-32 code units, without allocations.<br />
+     * The code units are only reordered, the UTF-32 conversions validate them. A trailing partial code unit
+     * isn't consumed and is reported as an incomplete sequence, to be completed by the next buffer.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	utf16String			the UTF-16 encoded string to be converted
-     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
-     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent UTF-8 encoded string
+     * @param	utf32Bytes		the UTF-32BE bytes to be converted
+     * @param	byteLength		the number of bytes
+     * @param	utf32String		receives the UTF-32 code units
+     * @param	utf32Room		the room for UTF-32 code units
+     * @return	the conversion status, the number of bytes consumed and of code units written
      * @since	1.0
      */
-    static string convertStringUtf16_to_StringUtf8(const u16string& utf16String, const bool strictConversion = false);
+    inline static ConversionResult convertUtf32Be_to_Utf32(const char* utf32Bytes, const size_t byteLength,
+                                                           char32_t* utf32String, const size_t utf32Room)
+    {
+        ConversionResult objResult = convertByteOrder(utf32Bytes, byteLength, reinterpret_cast<char*>(utf32String),
+                                                      utf32Room * sizeof(char32_t), sizeof(char32_t), HOST_LITTLE_ENDIAN);
+        objResult.written /= sizeof(char32_t);
+
+        return objResult;
+    }
 
     /**
-     * Converts an UTF-8 encoded string to the equivalent UTF-16 encoded string.
+     * Converts host order UTF-32 code units to an UTF-32BE byte buffer, without allocations.<br />
+     * The conversion stops when the output buffer is full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	utf8String			the UTF-8 encoded string to be converted
-     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
-     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent UTF-16 encoded string
+     * @param	utf32String		the UTF-32 code units to be converted
+     * @param	utf32Length		the number of UTF-32 code units
+     * @param	utf32Bytes		receives the UTF-32BE bytes
+     * @param	byteRoom		the room for bytes
+     * @return	the conversion status, the number of code units consumed and of bytes written
      * @since	1.0
      */
-    static u16string convertStringUtf8_to_StringUtf16(const string& utf8String, const bool strictConversion = false);
+    inline static ConversionResult convertUtf32_to_Utf32Be(const char32_t* utf32String, const size_t utf32Length,
+                                                           char* utf32Bytes, const size_t byteRoom)
+    {
+        ConversionResult objResult = convertByteOrder(reinterpret_cast<const char*>(utf32String), utf32Length * sizeof(char32_t),
+                                                      utf32Bytes, byteRoom, sizeof(char32_t), HOST_LITTLE_ENDIAN);
+        objResult.consumed /= sizeof(char32_t);
+
+        return objResult;
+    }
 
     /**
-     * Converts an UTF-32 encoded string to the equivalent UTF-8 encoded string.
+     * Converts an 8-bit extended ASCII character from a code page known at compile time to the equivalent
+     * UTF-32 code point, from the code page traits, without the runtime code page dispatch.<br />
+     * The ASCII control codes [0; 31, 127] aren't converted.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	utf32String			the UTF-32 encoded string to be converted
-     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
-     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent UTF-8 encoded string
+     * @param	narrowChar	the ASCII character [0; 255] to be converted
+     * @return	the equivalent UTF-32 code point
      * @since	1.0
      */
-    static string convertStringUtf32_to_StringUtf8(const u32string& utf32String, const bool strictConversion = false);
+    template<CodePage CP>
+    inline static char32_t convertCharAscii_to_CharUtf32(const char narrowChar)
+    {
+        typedef CodePageTraits<CP> Traits;
+
+        // All the conditions but the character are resolved at compile time
+        unsigned int code = static_cast<unsigned char>(narrowChar);
+        char32_t charUtf32 = (char32_t)UNICODE_REPLACEMENT_CHARACTER;
+        if((Traits::ASCII_COMPATIBLE && (code < 128U)) || ((code >= Traits::IDENTITY_FIRST) && (code <= Traits::IDENTITY_LAST)))
+        {
+            charUtf32 = static_cast<char32_t>(code);
+        }
+        else if((Traits::getBaseTable() != nullptr) && (code >= Traits::TABLE_OFFSET))
+        {
+            charUtf32 = Traits::getBaseTable()[code - Traits::TABLE_OFFSET];
+        }
+
+        return Traits::patch(code, charUtf32);
+    }
 
     /**
-     * Converts an UTF-8 encoded string to the equivalent UTF-32 encoded string.
+     * Converts a 8-bit extended ASCII characters buffer from a code page known at compile time to an UTF-32
+     * code points buffer, without allocations, in a loop specialized for the code page traits.<br />
+     * The ASCII control codes [0; 31, 127] aren't converted. The conversion stops when the output buffer is
+     * full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	utf8String			the UTF-8 encoded string to be converted
-     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
-     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent UTF-32 encoded string
+     * @param	narrowString	the ASCII characters to be converted
+     * @param	narrowLength	the number of ASCII characters
+     * @param	utf32String		receives the UTF-32 code points
+     * @param	utf32Room		the room for UTF-32 code points
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    static u32string convertStringUtf8_to_StringUtf32(const string& utf8String, const bool strictConversion = false);
-
-    inline static string convertStringWide_to_StringUtf8(const wstring& wideString, const bool strictConversion = false)
+    template<CodePage CP>
+    inline static ConversionResult convertAscii_to_Utf32(const char* narrowString, const size_t narrowLength,
+                                                         char32_t* utf32String, const size_t utf32Room)
     {
-        string utf8String;
-        u32string utf32String;
-
-        if(isWideCharUtf16())
+        // Every character of an 8-bit code page is a single UTF-32 code point
+        ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+        size_t length = narrowLength;
+        if(utf32Room < narrowLength)
         {
-            // wchar_t is UCS-2/UTF-16
-            utf32String = convertStringWide2_to_StringUtf32(wideString, strictConversion);
+            length = utf32Room;
+            objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
         }
-        else
+
+        for(size_t i = 0; i < length; ++i)
         {
-            // wchar_t is UCS-4/UTF-32
-            utf32String = convertStringWide4_to_StringUtf32(wideString, strictConversion);
+            utf32String[i] = convertCharAscii_to_CharUtf32<CP>(narrowString[i]);
         }
-        utf8String = convertStringUtf32_to_StringUtf8(utf32String, strictConversion);
 
-        return utf8String;
+        objResult.consumed = length;
+        objResult.written = length;
+
+        return objResult;
     }
 
     /**
-     * Converts an UTF-8 encoded string to the equivalent system wide character encoded string.
+     * Converts a 8-bit extended ASCII characters buffer from a code page known at compile time to an UTF-16
+     * code units buffer, without allocations, in a loop specialized for the code page traits.<br />
+     * The ASCII control codes [0; 31, 127] aren't converted. The conversion stops when the output buffer is
+     * full, and can be resumed from the consumed input.
      *
      * @author	Jos&eacute; Caetano Silva
      * @version	%I%, %G%
-     * @param	utf8String			the UTF-8 encoded string to be converted
-     * @param	strictConversion	optional parameter (default is 'false'), if 'true' throws exceptions in case of
-     *                              invalid conversion, if 'false' replaces invalid character width the replacement character
-     * @return	the equivalent wide character encoded string
+     * @param	narrowString	the ASCII characters to be converted
+     * @param	narrowLength	the number of ASCII characters
+     * @param	utf16String		receives the UTF-16 code units
+     * @param	utf16Room		the room for UTF-16 code units
+     * @return	the conversion status and the number of code units consumed and written
      * @since	1.0
      */
-    inline static wstring convertStringUtf8_to_StringWide(const string& utf8String, const bool strictConversion = false)
+    template<CodePage CP>
+    inline static ConversionResult convertAscii_to_Utf16(const char* narrowString, const size_t narrowLength,
+                                                         char16_t* utf16String, const size_t utf16Room)
     {
-        wstring wideString;
-        u32string utf32String = convertStringUtf8_to_StringUtf32(utf8String, strictConversion);
-
-        if(isWideCharUtf16())
+        // All the 8-bit code pages map to the BMP, so each character is a single UTF-16 code unit
+        ConversionResult objResult = { ConversionStatus::OK, 0, 0, NO_ERROR_OFFSET };
+        size_t length = narrowLength;
+        if(utf16Room < narrowLength)
         {
-            // wchar_t is UCS-2/UTF-16
-            wideString = convertStringUtf32_to_StringWide2(utf32String, strictConversion);
+            length = utf16Room;
+            objResult.status = ConversionStatus::OUTPUT_TOO_SMALL;
         }
-        else
+
+        for(size_t i = 0; i < length; ++i)
         {
-            // wchar_t is UCS-4/UTF-32
-            wideString = convertStringUtf32_to_StringWide4(utf32String, strictConversion);
+            utf16String[i] = static_cast<char16_t>(convertCharAscii_to_CharUtf32<CP>(narrowString[i]));
         }
 
-        return wideString;
+        objResult.consumed = length;
+        objResult.written = length;
+
+        return objResult;
     }
 };
 
 #endif /* _CODEPAGE2UNICODE_H_ */
+
+// The code page traits specializations, after the code page maps they point to
+#include "CodePageTraits.h"
@@ -0,0 +1,970 @@
+/**
+ * CodePageDecoder.h
+ *
+ * ABSTRACT
+ *  Definition of the incremental decoders that convert streamed chunks from ASCII to Unicode and vice versa,
+ *  carrying the sequences split across the chunk boundaries.
+ *
+ * CONTACTS
+ *  E-mail regarding any portion of the "CodePage2Unicode" project:
+ *      José Caetano Silva, jcaetano@users.sourceforge.net
+ *
+ * COPYRIGHT
+ *  This file is distributed under the terms of the GNU General Public
+ *  License (GPL) v3. Copies of the GPL can be obtained from:
+ *      ftp://prep.ai.mit.edu/pub/gnu/GPL
+ *  Each contributing author retains all rights to their own work.
+ *
+ *  (C) 20011 - 20015   José Caetano Silva
+ *
+ * HISTORY
+ *  2026-10-17: Created.
+ */
+
+#ifndef _CODEPAGEDECODER_H_
+#define _CODEPAGEDECODER_H_
+
+#pragma once
+
+#include "StdAfx.h"
+
+#include "CodePage2Unicode.h"
+
+using namespace std;
+
+
+/**
+ * Incremental UTF-8 decoder, converts an UTF-8 stream fed in chunks of any size to UTF-16 or UTF-32.<br />
+ * A sequence split across two chunks is kept until the next chunk completes it, so the output is the same
+ * as converting the whole stream at once. Each 'feed' converts all the input, unless the output buffer is
+ * full or a strict conversion finds an invalid sequence; then it can be resumed from the consumed input.
+ * The error offsets are relative to the chunk fed, a sequence started in a previous chunk is reported at 0.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+class Utf8Decoder
+{
+private:
+    /**
+     * The leading code units of a sequence split at the end of the last chunk.
+     */
+    char m_arrPending[4];
+
+    /**
+     * The number of pending code units.
+     */
+    size_t m_pendingLength;
+
+    /**
+     * If 'true' stops at the first invalid sequence, if 'false' replaces it with the replacement character.
+     */
+    bool m_strictConversion;
+
+    /**
+     * Gets the number of code units at the end of an UTF-8 buffer that start a sequence, but don't complete it.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf8String	the UTF-8 code units
+     * @param	utf8Length	the number of UTF-8 code units
+     * @return	the number of code units of the incomplete sequence [0; 3]
+     * @since	1.0
+     */
+    static size_t getIncompleteTailLength(const char* utf8String, const size_t utf8Length);
+
+    /**
+     * Feeds an UTF-8 chunk to one of the buffer conversions.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf8String			the UTF-8 code units to be converted
+     * @param	utf8Length			the number of UTF-8 code units
+     * @param	outString			receives the converted code units
+     * @param	outRoom				the room for converted code units
+     * @param	convertFunction		the buffer conversion from UTF-8
+     * @param	replacementLength	the number of code units of the replacement character in the output
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    template<typename CharType>
+    ConversionResult feedTo(const char* utf8String, const size_t utf8Length, CharType* outString, const size_t outRoom,
+                            ConversionResult (*convertFunction)(const char*, const size_t, CharType*, const size_t, const bool),
+                            const size_t replacementLength);
+
+    /**
+     * Flushes the pending sequence to one of the buffer conversions.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	outString			receives the converted code units
+     * @param	outRoom				the room for converted code units
+     * @param	convertFunction		the buffer conversion from UTF-8
+     * @return	the conversion status and the number of code units written
+     * @since	1.0
+     */
+    template<typename CharType>
+    ConversionResult finishTo(CharType* outString, const size_t outRoom,
+                              ConversionResult (*convertFunction)(const char*, const size_t, CharType*, const size_t, const bool));
+
+public:
+    /**
+     * Class 'Utf8Decoder' constructor.
+     * Creates a mew object instance.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+     *                              sequence, if 'false' replaces invalid character width the replacement character
+     * @since	1.0
+     */
+    explicit Utf8Decoder(const bool strictConversion = false)
+        : m_pendingLength(0), m_strictConversion(strictConversion)
+    {
+
+    }
+
+    /**
+     * Converts the next UTF-8 chunk to UTF-16.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf8String	the UTF-8 code units to be converted
+     * @param	utf8Length	the number of UTF-8 code units
+     * @param	utf16String	receives the UTF-16 code units
+     * @param	utf16Room	the room for UTF-16 code units
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    ConversionResult feed(const char* utf8String, const size_t utf8Length, char16_t* utf16String, const size_t utf16Room);
+
+    /**
+     * Converts the next UTF-8 chunk to UTF-32.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf8String	the UTF-8 code units to be converted
+     * @param	utf8Length	the number of UTF-8 code units
+     * @param	utf32String	receives the UTF-32 code points
+     * @param	utf32Room	the room for UTF-32 code points
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    ConversionResult feed(const char* utf8String, const size_t utf8Length, char32_t* utf32String, const size_t utf32Room);
+
+    /**
+     * Ends the UTF-8 stream converted to UTF-16, a pending sequence is incomplete.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf16String	receives the UTF-16 code units
+     * @param	utf16Room	the room for UTF-16 code units
+     * @return	the conversion status and the number of code units written
+     * @since	1.0
+     */
+    ConversionResult finish(char16_t* utf16String, const size_t utf16Room);
+
+    /**
+     * Ends the UTF-8 stream converted to UTF-32, a pending sequence is incomplete.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf32String	receives the UTF-32 code points
+     * @param	utf32Room	the room for UTF-32 code points
+     * @return	the conversion status and the number of code units written
+     * @since	1.0
+     */
+    ConversionResult finish(char32_t* utf32String, const size_t utf32Room);
+
+    /**
+     * Drops the pending sequence, to start a new stream.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @since	1.0
+     */
+    inline void reset(void)
+    {
+        m_pendingLength = 0;
+    }
+
+    /**
+     * Checks if a sequence split at the end of the last chunk is waiting for the next chunk.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	'true' if there's a pending sequence, 'false' if isn't
+     * @since	1.0
+     */
+    inline bool hasPendingInput(void) const
+    {
+        return (m_pendingLength > 0);
+    }
+};
+
+/**
+ * Incremental UTF-16 decoder, converts an UTF-16 stream fed in chunks of any size to UTF-8 or UTF-32.<br />
+ * A surrogate pair split across two chunks is kept until the next chunk completes it, so the output is the
+ * same as converting the whole stream at once. Each 'feed' converts all the input, unless the output buffer
+ * is full or a strict conversion finds an invalid code unit; then it can be resumed from the consumed input.
+ * The error offsets are relative to the chunk fed, a pair started in a previous chunk is reported at 0.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+class Utf16Decoder
+{
+private:
+    /**
+     * The high surrogate at the end of the last chunk.
+     */
+    char16_t m_pendingHighSurrogate;
+
+    /**
+     * 'true' if the last chunk ended with a high surrogate.
+     */
+    bool m_hasPending;
+
+    /**
+     * If 'true' stops at the first invalid code unit, if 'false' replaces it with the replacement character.
+     */
+    bool m_strictConversion;
+
+    /**
+     * Feeds an UTF-16 chunk to one of the buffer conversions.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf16String			the UTF-16 code units to be converted
+     * @param	utf16Length			the number of UTF-16 code units
+     * @param	outString			receives the converted code units
+     * @param	outRoom				the room for converted code units
+     * @param	convertFunction		the buffer conversion from UTF-16
+     * @param	replacementLength	the number of code units of the replacement character in the output
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    template<typename CharType>
+    ConversionResult feedTo(const char16_t* utf16String, const size_t utf16Length, CharType* outString, const size_t outRoom,
+                            ConversionResult (*convertFunction)(const char16_t*, const size_t, CharType*, const size_t, const bool),
+                            const size_t replacementLength);
+
+    /**
+     * Flushes the pending high surrogate to one of the buffer conversions.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	outString			receives the converted code units
+     * @param	outRoom				the room for converted code units
+     * @param	convertFunction		the buffer conversion from UTF-16
+     * @return	the conversion status and the number of code units written
+     * @since	1.0
+     */
+    template<typename CharType>
+    ConversionResult finishTo(CharType* outString, const size_t outRoom,
+                              ConversionResult (*convertFunction)(const char16_t*, const size_t, CharType*, const size_t, const bool));
+
+public:
+    /**
+     * Class 'Utf16Decoder' constructor.
+     * Creates a mew object instance.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+     *                              code unit, if 'false' replaces invalid character width the replacement character
+     * @since	1.0
+     */
+    explicit Utf16Decoder(const bool strictConversion = false)
+        : m_pendingHighSurrogate(0), m_hasPending(false), m_strictConversion(strictConversion)
+    {
+
+    }
+
+    /**
+     * Converts the next UTF-16 chunk to UTF-8.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf16String	the UTF-16 code units to be converted
+     * @param	utf16Length	the number of UTF-16 code units
+     * @param	utf8String	receives the UTF-8 code units
+     * @param	utf8Room	the room for UTF-8 code units
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    ConversionResult feed(const char16_t* utf16String, const size_t utf16Length, char* utf8String, const size_t utf8Room);
+
+    /**
+     * Converts the next UTF-16 chunk to UTF-32.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf16String	the UTF-16 code units to be converted
+     * @param	utf16Length	the number of UTF-16 code units
+     * @param	utf32String	receives the UTF-32 code points
+     * @param	utf32Room	the room for UTF-32 code points
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    ConversionResult feed(const char16_t* utf16String, const size_t utf16Length, char32_t* utf32String, const size_t utf32Room);
+
+    /**
+     * Ends the UTF-16 stream converted to UTF-8, a pending high surrogate is incomplete.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf8String	receives the UTF-8 code units
+     * @param	utf8Room	the room for UTF-8 code units
+     * @return	the conversion status and the number of code units written
+     * @since	1.0
+     */
+    ConversionResult finish(char* utf8String, const size_t utf8Room);
+
+    /**
+     * Ends the UTF-16 stream converted to UTF-32, a pending high surrogate is incomplete.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf32String	receives the UTF-32 code points
+     * @param	utf32Room	the room for UTF-32 code points
+     * @return	the conversion status and the number of code units written
+     * @since	1.0
+     */
+    ConversionResult finish(char32_t* utf32String, const size_t utf32Room);
+
+    /**
+     * Drops the pending high surrogate, to start a new stream.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @since	1.0
+     */
+    inline void reset(void)
+    {
+        m_hasPending = false;
+    }
+
+    /**
+     * Checks if a high surrogate at the end of the last chunk is waiting for the next chunk.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	'true' if there's a pending high surrogate, 'false' if isn't
+     * @since	1.0
+     */
+    inline bool hasPendingInput(void) const
+    {
+        return m_hasPending;
+    }
+};
+
+/**
+ * Incremental UTF-32 decoder, converts an UTF-32 stream fed in chunks of any size to UTF-8 or UTF-16.<br />
+ * Every UTF-32 code point is whole, so nothing is carried between chunks; it gives UTF-32 streams the same
+ * interface of the other decoders.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+class Utf32Decoder
+{
+private:
+    /**
+     * If 'true' stops at the first invalid code point, if 'false' replaces it with the replacement character.
+     */
+    bool m_strictConversion;
+
+public:
+    /**
+     * Class 'Utf32Decoder' constructor.
+     * Creates a mew object instance.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+     *                              code point, if 'false' replaces invalid character width the replacement character
+     * @since	1.0
+     */
+    explicit Utf32Decoder(const bool strictConversion = false)
+        : m_strictConversion(strictConversion)
+    {
+
+    }
+
+    /**
+     * Converts the next UTF-32 chunk to UTF-8.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf32String	the UTF-32 code points to be converted
+     * @param	utf32Length	the number of UTF-32 code points
+     * @param	utf8String	receives the UTF-8 code units
+     * @param	utf8Room	the room for UTF-8 code units
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    inline ConversionResult feed(const char32_t* utf32String, const size_t utf32Length, char* utf8String, const size_t utf8Room)
+    {
+        return CodePage2Unicode::convertUtf32_to_Utf8(utf32String, utf32Length, utf8String, utf8Room, m_strictConversion);
+    }
+
+    /**
+     * Converts the next UTF-32 chunk to UTF-16.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf32String	the UTF-32 code points to be converted
+     * @param	utf32Length	the number of UTF-32 code points
+     * @param	utf16String	receives the UTF-16 code units
+     * @param	utf16Room	the room for UTF-16 code units
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    inline ConversionResult feed(const char32_t* utf32String, const size_t utf32Length, char16_t* utf16String, const size_t utf16Room)
+    {
+        return CodePage2Unicode::convertUtf32_to_Utf16(utf32String, utf32Length, utf16String, utf16Room, m_strictConversion);
+    }
+
+    /**
+     * Ends the UTF-32 stream, there's never anything pending.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	the conversion status, always 'ConversionStatus::OK'
+     * @since	1.0
+     */
+    inline ConversionResult finish(void)
+    {
+        ConversionResult objResult = { ConversionStatus::OK, 0, 0, CodePage2Unicode::NO_ERROR_OFFSET };
+
+        return objResult;
+    }
+};
+
+/**
+ * Incremental 8-bit extended ASCII decoder, converts a stream of a given single byte code page fed in chunks
+ * of any size to UTF-8, UTF-16 or UTF-32.<br />
+ * Every character is a single byte, so nothing is carried between chunks; it gives the code page streams the
+ * same interface of the other decoders.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+class SbcsDecoder
+{
+private:
+    /**
+     * The code page of the stream.
+     */
+    CodePage m_codePage;
+
+    /**
+     * If 'true' also converts ASCII control codes [0; 31, 127] to Unicode.
+     */
+    bool m_convertAsciiControl;
+
+public:
+    /**
+     * Class 'SbcsDecoder' constructor.
+     * Creates a mew object instance.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	codePage			the code page from CodePage enumeration of the stream
+     * @param	convertAsciiControl	optional parameter (defaults to 'false') that if 'true',
+     *                              also converts ASCII control codes [0; 31, 127] to Unicode
+     * @since	1.0
+     */
+    explicit SbcsDecoder(const CodePage codePage, const bool convertAsciiControl = false)
+        : m_codePage(codePage), m_convertAsciiControl(convertAsciiControl)
+    {
+
+    }
+
+    /**
+     * Converts the next chunk to UTF-8.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowString	the ASCII characters to be converted
+     * @param	narrowLength	the number of ASCII characters
+     * @param	utf8String		receives the UTF-8 code units
+     * @param	utf8Room		the room for UTF-8 code units
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    inline ConversionResult feed(const char* narrowString, const size_t narrowLength, char* utf8String, const size_t utf8Room)
+    {
+        return CodePage2Unicode::convertAscii_to_Utf8(narrowString, narrowLength, utf8String, utf8Room,
+                                                      m_codePage, m_convertAsciiControl);
+    }
+
+    /**
+     * Converts the next chunk to UTF-16.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowString	the ASCII characters to be converted
+     * @param	narrowLength	the number of ASCII characters
+     * @param	utf16String		receives the UTF-16 code units
+     * @param	utf16Room		the room for UTF-16 code units
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    inline ConversionResult feed(const char* narrowString, const size_t narrowLength, char16_t* utf16String, const size_t utf16Room)
+    {
+        return CodePage2Unicode::convertAscii_to_Utf16(narrowString, narrowLength, utf16String, utf16Room,
+                                                       m_codePage, m_convertAsciiControl);
+    }
+
+    /**
+     * Converts the next chunk to UTF-32.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowString	the ASCII characters to be converted
+     * @param	narrowLength	the number of ASCII characters
+     * @param	utf32String		receives the UTF-32 code points
+     * @param	utf32Room		the room for UTF-32 code points
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    inline ConversionResult feed(const char* narrowString, const size_t narrowLength, char32_t* utf32String, const size_t utf32Room)
+    {
+        return CodePage2Unicode::convertAscii_to_Utf32(narrowString, narrowLength, utf32String, utf32Room,
+                                                       m_codePage, m_convertAsciiControl);
+    }
+
+    /**
+     * Ends the stream, there's never anything pending.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	the conversion status, always 'ConversionStatus::OK'
+     * @since	1.0
+     */
+    inline ConversionResult finish(void)
+    {
+        ConversionResult objResult = { ConversionStatus::OK, 0, 0, CodePage2Unicode::NO_ERROR_OFFSET };
+
+        return objResult;
+    }
+};
+
+/**
+ * Incremental 8-bit extended ASCII encoder, converts an UTF-32 stream fed in chunks of any size to a given
+ * single byte code page.<br />
+ * Every UTF-32 code point is whole, so nothing is carried between chunks.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+class SbcsEncoder
+{
+private:
+    /**
+     * The code page of the stream.
+     */
+    CodePage m_codePage;
+
+    /**
+     * What to do with the characters that can't be represented in the code page.
+     */
+    UnmappableAction m_unmappableAction;
+
+    /**
+     * The character that replaces the unmappable characters.
+     */
+    char m_replacementChar;
+
+public:
+    /**
+     * Class 'SbcsEncoder' constructor.
+     * Creates a mew object instance.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	codePage			the code page from CodePage enumeration of the stream
+     * @param	unmappableAction	optional parameter (defaults to 'UnmappableAction::REPLACE'), defines what to do
+     *                              with the characters that can't be represented in the code page
+     * @param	replacementChar		optional parameter (defaults to '?'), the character that replaces the unmappable
+     *                              characters, when 'unmappableAction' is 'UnmappableAction::REPLACE'
+     * @since	1.0
+     */
+    explicit SbcsEncoder(const CodePage codePage, const UnmappableAction unmappableAction = UnmappableAction::REPLACE,
+                         const char replacementChar = CodePage2Unicode::ASCII_REPLACEMENT_CHARACTER)
+        : m_codePage(codePage), m_unmappableAction(unmappableAction), m_replacementChar(replacementChar)
+    {
+
+    }
+
+    /**
+     * Converts the next UTF-32 chunk to the code page.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf32String		the UTF-32 code points to be converted
+     * @param	utf32Length		the number of UTF-32 code points
+     * @param	narrowString	receives the ASCII characters
+     * @param	narrowRoom		the room for ASCII characters
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    inline ConversionResult feed(const char32_t* utf32String, const size_t utf32Length, char* narrowString, const size_t narrowRoom)
+    {
+        return CodePage2Unicode::convertUtf32_to_Ascii(utf32String, utf32Length, narrowString, narrowRoom,
+                                                       m_codePage, m_unmappableAction, m_replacementChar);
+    }
+
+    /**
+     * Ends the UTF-32 stream, there's never anything pending.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	the conversion status, always 'ConversionStatus::OK'
+     * @since	1.0
+     */
+    inline ConversionResult finish(void)
+    {
+        ConversionResult objResult = { ConversionStatus::OK, 0, 0, CodePage2Unicode::NO_ERROR_OFFSET };
+
+        return objResult;
+    }
+};
+
+/**
+ * Incremental UTF-7 decoder (RFC 2152), converts an UTF-7 or modified UTF-7 (RFC 3501, the IMAP mailbox names)
+ * stream fed in chunks of any size to UTF-32.<br />
+ * The base64 shifted state is kept between chunks, so the output is the same as converting the whole stream
+ * at once. Each 'feed' converts all the input, unless the output buffer is full or a strict conversion finds
+ * an invalid sequence; then it can be resumed from the consumed input.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+class Utf7Decoder
+{
+private:
+    /**
+     * The shift state of an UTF-7 stream.
+     */
+    struct Utf7State
+    {
+        /**
+         * The base64 bits not yet decoded to an UTF-16 code unit.
+         */
+        unsigned int bits;
+
+        /**
+         * The number of base64 bits not yet decoded [0; 15].
+         */
+        unsigned int bitCount;
+
+        /**
+         * The high surrogate waiting for its low surrogate, or 0 if none.
+         */
+        char16_t highSurrogate;
+
+        /**
+         * 'true' while decoding base64.
+         */
+        bool inBase64;
+
+        /**
+         * 'true' right after the shift character, before any base64 character.
+         */
+        bool shiftOnly;
+    };
+
+    /**
+     * The base64 values of the UTF-7 7-bit characters, 0xFF if not a base64 character.
+     */
+    static const unsigned char BASE64_VALUES[128];
+
+    /**
+     * The base64 values of the modified UTF-7 7-bit characters, 0xFF if not a base64 character.
+     */
+    static const unsigned char BASE64_VALUES_MODIFIED[128];
+
+    /**
+     * The shift state.
+     */
+    Utf7State m_objState;
+
+    /**
+     * The base64 values of the UTF-7 flavour.
+     */
+    const unsigned char* m_pBase64Values;
+
+    /**
+     * The character that starts the base64 encoded characters: '+', or '&' in modified UTF-7.
+     */
+    char m_shiftChar;
+
+    /**
+     * 'true' for modified UTF-7.
+     */
+    bool m_modifiedUtf7;
+
+    /**
+     * If 'true' stops at the first invalid sequence, if 'false' replaces it with the replacement character.
+     */
+    bool m_strictConversion;
+
+    /**
+     * Decodes an UTF-16 code unit of the base64 encoded characters, pairing the surrogates.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	codeUnit	the UTF-16 code unit
+     * @param	utf32String	receives the UTF-32 code points, must have room for 2 code points
+     * @param	status		receives the error, if any
+     * @return	the number of UTF-32 code points decoded [0; 2]
+     * @since	1.0
+     */
+    size_t decodeCodeUnit(const char16_t codeUnit, char32_t* utf32String, ConversionStatus& status);
+
+    /**
+     * Decodes a single UTF-7 character, in or out of the base64 encoded characters.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf7Char	the UTF-7 character
+     * @param	utf32String	receives the UTF-32 code points, must have room for 3 code points
+     * @param	consumed	receives 'false' if the character ends the base64 encoded characters and must
+     *                      be decoded again as a direct character
+     * @param	status		receives the error, if any
+     * @return	the number of UTF-32 code points decoded [0; 3]
+     * @since	1.0
+     */
+    size_t decodeChar(const char utf7Char, char32_t* utf32String, bool& consumed, ConversionStatus& status);
+
+public:
+    /**
+     * Class 'Utf7Decoder' constructor.
+     * Creates a mew object instance.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+     *                              sequence, if 'false' replaces invalid character width the replacement character
+     * @param	modifiedUtf7		optional parameter (default is 'false'), if 'true' decodes modified UTF-7
+     * @since	1.0
+     */
+    explicit Utf7Decoder(const bool strictConversion = false, const bool modifiedUtf7 = false);
+
+    /**
+     * Converts the next UTF-7 chunk to UTF-32.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf7String	the UTF-7 characters to be converted
+     * @param	utf7Length	the number of UTF-7 characters
+     * @param	utf32String	receives the UTF-32 code points
+     * @param	utf32Room	the room for UTF-32 code points
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    ConversionResult feed(const char* utf7String, const size_t utf7Length, char32_t* utf32String, const size_t utf32Room);
+
+    /**
+     * Ends the UTF-7 stream, closing the base64 encoded characters.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf32String	receives the UTF-32 code points
+     * @param	utf32Room	the room for UTF-32 code points
+     * @return	the conversion status and the number of code units written
+     * @since	1.0
+     */
+    ConversionResult finish(char32_t* utf32String, const size_t utf32Room);
+
+    /**
+     * Drops the shift state, to start a new stream.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @since	1.0
+     */
+    inline void reset(void)
+    {
+        Utf7State objState = { 0, 0, 0, false, false };
+        m_objState = objState;
+    }
+
+    /**
+     * Checks if the stream is in the middle of base64 encoded characters.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	'true' if decoding base64, 'false' if isn't
+     * @since	1.0
+     */
+    inline bool hasPendingInput(void) const
+    {
+        return m_objState.inBase64;
+    }
+};
+
+/**
+ * Incremental UTF-7 encoder (RFC 2152), converts an UTF-32 stream fed in chunks of any size to UTF-7 or
+ * modified UTF-7 (RFC 3501, the IMAP mailbox names).<br />
+ * UTF-7 directly encodes the RFC 2152 set D and the white spaces, modified UTF-7 all the printable 7-bit ASCII
+ * characters; everything else is base64 encoded UTF-16. The base64 state is kept between chunks.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+class Utf7Encoder
+{
+private:
+    /**
+     * The UTF-7 base64 alphabet.
+     */
+    static const char BASE64_ALPHABET[64];
+
+    /**
+     * The modified UTF-7 base64 alphabet, with ',' instead of '/'.
+     */
+    static const char BASE64_ALPHABET_MODIFIED[64];
+
+    /**
+     * The 7-bit ASCII characters that UTF-7 encodes directly: 1 for set D and the white spaces,
+     * 2 for the base64 characters and '-' that need an explicit end of the base64 encoded characters.
+     */
+    static const unsigned char DIRECT_CHARS[128];
+
+    /**
+     * The 7-bit ASCII characters that modified UTF-7 encodes directly, the printable ones but '&'.
+     */
+    static const unsigned char DIRECT_CHARS_MODIFIED[128];
+
+    /**
+     * The base64 bits not yet encoded.
+     */
+    unsigned int m_bits;
+
+    /**
+     * The number of base64 bits not yet encoded [0; 5].
+     */
+    unsigned int m_bitCount;
+
+    /**
+     * 'true' while encoding base64.
+     */
+    bool m_inBase64;
+
+    /**
+     * The base64 alphabet of the UTF-7 flavour.
+     */
+    const char* m_pBase64Alphabet;
+
+    /**
+     * The directly encoded characters of the UTF-7 flavour.
+     */
+    const unsigned char* m_pDirectChars;
+
+    /**
+     * The character that starts the base64 encoded characters: '+', or '&' in modified UTF-7.
+     */
+    char m_shiftChar;
+
+    /**
+     * 'true' for modified UTF-7, that always ends the base64 encoded characters with '-'.
+     */
+    bool m_modifiedUtf7;
+
+    /**
+     * If 'true' stops at the first invalid code point, if 'false' replaces it with the replacement character.
+     */
+    bool m_strictConversion;
+
+    /**
+     * Encodes a single code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	codePoint	the UTF-32 code point, a valid one
+     * @param	utf7String	receives the UTF-7 characters, must have room for 8 characters
+     * @return	the number of UTF-7 characters encoded [1; 7]
+     * @since	1.0
+     */
+    size_t encodeChar(const char32_t codePoint, char* utf7String);
+
+public:
+    /**
+     * Class 'Utf7Encoder' constructor.
+     * Creates a mew object instance.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	strictConversion	optional parameter (default is 'false'), if 'true' stops at the first invalid
+     *                              code point, if 'false' replaces invalid character width the replacement character
+     * @param	modifiedUtf7		optional parameter (default is 'false'), if 'true' encodes modified UTF-7
+     * @since	1.0
+     */
+    explicit Utf7Encoder(const bool strictConversion = false, const bool modifiedUtf7 = false);
+
+    /**
+     * Converts the next UTF-32 chunk to UTF-7.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf32String	the UTF-32 code points to be converted
+     * @param	utf32Length	the number of UTF-32 code points
+     * @param	utf7String	receives the UTF-7 characters
+     * @param	utf7Room	the room for UTF-7 characters
+     * @return	the conversion status and the number of code units consumed and written
+     * @since	1.0
+     */
+    ConversionResult feed(const char32_t* utf32String, const size_t utf32Length, char* utf7String, const size_t utf7Room);
+
+    /**
+     * Ends the UTF-7 stream, closing the base64 encoded characters.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	utf7String	receives the UTF-7 characters
+     * @param	utf7Room	the room for UTF-7 characters
+     * @return	the conversion status and the number of code units written
+     * @since	1.0
+     */
+    ConversionResult finish(char* utf7String, const size_t utf7Room);
+
+    /**
+     * Drops the base64 state, to start a new stream.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @since	1.0
+     */
+    inline void reset(void)
+    {
+        m_bits = 0;
+        m_bitCount = 0;
+        m_inBase64 = false;
+    }
+
+    /**
+     * Checks if the stream is in the middle of base64 encoded characters, that 'finish' ends.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	'true' if encoding base64, 'false' if isn't
+     * @since	1.0
+     */
+    inline bool hasPendingOutput(void) const
+    {
+        return m_inBase64;
+    }
+};
+
+#endif /* _CODEPAGEDECODER_H_ */
@@ -0,0 +1,471 @@
+/**
+ * CodePageRegistry.h
+ *
+ * ABSTRACT
+ *  Definition of the registry of the single-byte and double-byte code pages loaded at run time, from binary table files
+ *  mapped read-only in memory and shared by all the processes that load them.
+ *
+ * CONTACTS
+ *  E-mail regarding any portion of the "CodePage2Unicode" project:
+ *      José Caetano Silva, jcaetano@users.sourceforge.net
+ *
+ * COPYRIGHT
+ *  This file is distributed under the terms of the GNU General Public
+ *  License (GPL) v3. Copies of the GPL can be obtained from:
+ *      ftp://prep.ai.mit.edu/pub/gnu/GPL
+ *  Each contributing author retains all rights to their own work.
+ *
+ *  (C) 20011 - 20015   José Caetano Silva
+ *
+ * HISTORY
+ *  2026-10-17: Created.
+ */
+
+#ifndef _CODEPAGEREGISTRY_H_
+#define _CODEPAGEREGISTRY_H_
+
+#pragma once
+
+#include "StdAfx.h"
+
+#include "CodePage2Unicode.h"
+
+using namespace std;
+
+
+/**
+ * A single-byte or double-byte code page loaded by the registry, that a 'CodePageHandle' points to.<br />
+ * All the tables are inside the read-only memory mapping of the table file, only this descriptor is
+ * allocated by each process. It's never released, so the handles stay valid until the process ends.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+struct CodePageMapping
+{
+    /**
+     * The code page number, not necessarily one of the CodePage enumeration.
+     */
+    CodePage codePage;
+
+    /**
+     * The code page name, like "CP869".
+     */
+    const char* name;
+
+    /**
+     * If the characters [0; 127] are the 7-bit ASCII characters, so 7-bit ASCII blocks can be
+     * zero-extended without table loads.
+     */
+    bool asciiIdentity;
+
+    /**
+     * If the code page has double-byte characters, a lead byte followed by a trail byte.
+     */
+    bool doubleByte;
+
+    /**
+     * The UTF-32 decoding table of the single-byte characters, of 256 code points (the lead bytes are
+     * decoded as the replacement character).
+     */
+    const char32_t* utf32Table;
+
+    /**
+     * The UTF-16 decoding table of the single-byte characters, of 256 code units (all the characters are
+     * mapped to the BMP).
+     */
+    const char16_t* utf16Table;
+
+    /**
+     * The UTF-8 decoding table of the single-byte characters, holding the 1 to 3 bytes UTF-8 sequence of
+     * each character, with it's length in the last byte.
+     */
+    const unsigned char (*utf8Table)[4];
+
+    /**
+     * The lead bytes bitmap of the double-byte code pages, of 256 bits.
+     */
+    const uint32_t* leadBytes;
+
+    /**
+     * The index of the trail block of each lead byte of the double-byte code pages (the block 0 has
+     * no characters).
+     */
+    const uint16_t* trailIndexes;
+
+    /**
+     * The trail blocks of the double-byte code pages, of 256 UTF-16 code units by trail byte, each
+     * one aligned to a cache line.
+     */
+    const char16_t* trailBlocks;
+
+    /**
+     * The first level of the encoding table, by the high byte of the BMP code point, holding the index
+     * of the leaf.
+     */
+    const unsigned char* encodingRoots;
+
+    /**
+     * The second level of the encoding table of the single-byte code pages, the leaves of 256 entries,
+     * by the low byte of the BMP code point, holding the ASCII character (the leaf 0 is the empty one).
+     */
+    const unsigned char* encodingLeaves;
+
+    /**
+     * The second level of the encoding table of the double-byte code pages, the leaves of 256 entries,
+     * by the low byte of the BMP code point, holding the single-byte character or the double-byte
+     * character with the lead byte in the high byte (the leaf 0 is the empty one).
+     */
+    const uint16_t* encodingDoubleLeaves;
+
+    /**
+     * Checks if a byte starts a double-byte character.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	code	the byte [0; 255]
+     * @return	'true' if it's a lead byte, 'false' otherwise
+     * @since	1.0
+     */
+    inline bool isLeadByte(const unsigned char code) const
+    {
+        return doubleByte && (((leadBytes[code >> 5] >> (code & 31)) & 1) != 0);
+    }
+
+    /**
+     * Decodes a double-byte character.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	lead	the lead byte
+     * @param	trail	the trail byte
+     * @return	the UTF-16 code unit, or the replacement character if the character is invalid or undefined
+     * @since	1.0
+     */
+    inline char16_t decodeDoubleByte(const unsigned char lead, const unsigned char trail) const
+    {
+        return trailBlocks[((size_t)trailIndexes[lead] << 8) | trail];
+    }
+
+    /**
+     * Decodes the single-byte or double-byte character at the start of a narrow string.<br />
+     * An invalid double-byte character with a 7-bit ASCII trail byte only takes the lead byte, so the
+     * ASCII character is decoded next.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	narrowString	the narrow characters
+     * @param	length			the number of narrow characters, at least 1
+     * @param	codeLength		receives the number of bytes of the character, 0 if a lead byte ends the string
+     * @return	the UTF-16 code unit, or the replacement character if the character is invalid or undefined
+     * @since	1.0
+     */
+    inline char16_t decode(const char* narrowString, const size_t length, size_t& codeLength) const
+    {
+        unsigned char code = static_cast<unsigned char>(narrowString[0]);
+        if(!isLeadByte(code))
+        {
+            codeLength = 1;
+
+            return utf16Table[code];
+        }
+        if(length < 2)
+        {
+            codeLength = 0;
+
+            return (char16_t)0xFFFD;
+        }
+
+        unsigned char trail = static_cast<unsigned char>(narrowString[1]);
+        char16_t charUtf16 = decodeDoubleByte(code, trail);
+        codeLength = ((charUtf16 == (char16_t)0xFFFD) && (trail < 0x80)) ? 1 : 2;
+
+        return charUtf16;
+    }
+
+    /**
+     * Looks up the character of an UTF-32 code point.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	charUtf32	the UTF-32 code point
+     * @param	code		receives the single-byte character, or the double-byte character with the lead byte
+     *                      in the high byte, if the code point is mapped
+     * @return	'true' if the code point is mapped, 'false' otherwise
+     * @since	1.0
+     */
+    inline bool lookup(const char32_t charUtf32, unsigned int& code) const
+    {
+        if(charUtf32 > (char32_t)0xFFFF)
+        {
+            return false;
+        }
+
+        size_t index = ((size_t)encodingRoots[charUtf32 >> 8] << 8) | (charUtf32 & 0xFF);
+        code = doubleByte ? encodingDoubleLeaves[index] : encodingLeaves[index];
+
+        return (code != 0) || (charUtf32 == (char32_t)0);
+    }
+};
+
+/**
+ * Registry of the single-byte and double-byte code pages loaded at run time, in addition to the ones built
+ * in 'CodePage2Unicode', like CP869 or the Windows double-byte code pages (Shift_JIS, GBK, UHC and Big5)
+ * that don't depend on the host locales.<br />
+ * The code pages are compiled from Unicode.org mapping files (".TXT", like "Documentation/Mappings/CP869.TXT"
+ * or "VENDORS/MICSFT/WINDOWS/CP932.TXT")
+ * to a binary table file, that every process maps read-only, so the operating system shares a single copy
+ * of the tables between them. The table file holds all the decoding and encoding tables ready to use,
+ * in the byte order of the machine that compiled it.<br />
+ * The handles returned by the registry are accepted in place of a 'CodePage' by the buffer conversions of
+ * 'CodePage2Unicode'. Loading and looking up are thread safe.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+class CodePageRegistry
+{
+public:
+    /* Table File Format */
+
+    /**
+     * The table file signature: "CP2U".
+     */
+    static const uint32_t TABLE_FILE_MAGIC = 0x55325043UL;
+
+    /**
+     * The table file format version.
+     */
+    static const uint16_t TABLE_FILE_VERSION = 2;
+
+    /**
+     * The table file byte order mark, read as 0xFFFE if the file has the other byte order.
+     */
+    static const uint16_t TABLE_FILE_BYTE_ORDER = 0xFEFF;
+
+    /**
+     * The maximum length of a code page name, including the terminating null.
+     */
+    static const size_t TABLE_FILE_NAME_SIZE = 16;
+
+    /**
+     * The table file entry flag set if the characters [0; 127] are the 7-bit ASCII characters.
+     */
+    static const uint32_t TABLE_FILE_ASCII_IDENTITY = 0x00000001UL;
+
+    /**
+     * The table file entry flag set if the code page has double-byte characters.
+     */
+    static const uint32_t TABLE_FILE_DOUBLE_BYTE = 0x00000002UL;
+
+    /**
+     * The alignment of the tables in the table file, a cache line.
+     */
+    static const size_t TABLE_FILE_ALIGNMENT = 64;
+
+    /**
+     * The table file header, at the start of the file. All the values are in the byte order of the machine that
+     * compiled the file and all the tables are aligned to a cache line, so they are used in place.
+     */
+    struct TableFileHeader
+    {
+        /**
+         * The signature, 'TABLE_FILE_MAGIC'.
+         */
+        uint32_t magic;
+
+        /**
+         * The format version, 'TABLE_FILE_VERSION'.
+         */
+        uint16_t version;
+
+        /**
+         * The byte order mark, 'TABLE_FILE_BYTE_ORDER'.
+         */
+        uint16_t byteOrder;
+
+        /**
+         * The number of code pages, whose directory entries follow the header.
+         */
+        uint32_t entryCount;
+
+        /**
+         * The file size in bytes.
+         */
+        uint32_t fileSize;
+    };
+
+    /**
+     * The table file directory entry of a code page, with the offsets of its tables from the start of the file,
+     * each one aligned to a cache line:
+     * the UTF-32 (256 x 4 bytes), UTF-16 (256 x 2 bytes) and UTF-8 (256 x 4 bytes) decoding tables of the
+     * single-byte characters, the roots (256 bytes) and leaves ('leafCount' x 256 bytes, or 256 x 2 bytes for
+     * the double-byte code pages) of the encoding table, and for the double-byte code pages the lead bytes
+     * bitmap (32 bytes), the trail block indexes (256 x 2 bytes) and the trail blocks ('trailBlockCount' x
+     * 256 x 2 bytes).
+     */
+    struct TableFileEntry
+    {
+        uint32_t codePage;
+        char name[TABLE_FILE_NAME_SIZE];
+        uint32_t flags;
+        uint32_t utf32Offset;
+        uint32_t utf16Offset;
+        uint32_t utf8Offset;
+        uint32_t rootsOffset;
+        uint32_t leavesOffset;
+        uint32_t leafCount;
+        uint32_t leadBytesOffset;
+        uint32_t trailIndexesOffset;
+        uint32_t trailBlocksOffset;
+        uint32_t trailBlockCount;
+    };
+
+private:
+    /**
+     * A table file mapped in memory.
+     */
+    struct MappedFile;
+
+    /**
+     * The loaded table files and code pages.
+     */
+    struct RegistryState;
+
+    /**
+     * Gets the registry state, created on first use.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	the registry state
+     * @since	1.0
+     */
+    static RegistryState& getRegistryState(void);
+
+    /**
+     * Parses an Unicode.org mapping file into an UTF-32 decoding table.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	mappingFile		the path of the mapping file
+     * @param	vecTable		receives the 65536 code points, by single-byte character or by double-byte character
+     *                          with the lead byte in the high byte, the unmapped ones as the replacement character
+     * @param	vecLeadBytes	receives the 256 flags of the lead bytes
+     * @return	'true' if the code page has double-byte characters, 'false' otherwise
+     * @since	1.0
+     */
+    static bool parseMappingFile(const string& mappingFile, vector<char32_t>& vecTable, vector<bool>& vecLeadBytes);
+
+    /**
+     * Checks if a character takes the place of another one with the same code point in the encoding table.<br />
+     * The lowest character is kept, like in the Windows tables, except in Windows-950, where the Big5
+     * characters take the place of their lower compatibility duplicates, and in Windows-932, where the NEC
+     * selected IBM extensions (the 0xED and 0xEE lead bytes) give way to any other duplicate. The
+     * single-byte characters are always kept.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	codePage	the code page number
+     * @param	code		the higher character, by single-byte character or by double-byte character
+     * @param	mappedCode	the lower character already in the encoding table
+     * @return	'true' if the higher character takes the place of the lower one, 'false' otherwise
+     * @since	1.0
+     */
+    static bool isDuplicatePreferred(const CodePage codePage, const size_t code, const size_t mappedCode);
+
+    /**
+     * Appends a table to the table file data, aligned to a cache line.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	vecData	the table file data
+     * @param	pTable	the table
+     * @param	size	the table size in bytes
+     * @return	the offset of the table from the start of the file
+     * @since	1.0
+     */
+    static uint32_t appendTable(vector<unsigned char>& vecData, const void* pTable, const size_t size);
+
+    /**
+     * Checks if a table lies entirely inside a table file.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	offset		the offset of the table from the start of the file
+     * @param	tableSize	the table size in bytes
+     * @param	size		the table file size in bytes
+     * @return	'true' if the table is inside the file, 'false' otherwise
+     * @since	1.0
+     */
+    static bool isTableInFile(const size_t offset, const size_t tableSize, const size_t size);
+
+    /**
+     * Validates the header, the directory and the table offsets of a table file mapped in memory.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	pData	the table file data
+     * @param	size	the table file size in bytes
+     * @return	'true' if the table file is valid, 'false' otherwise
+     * @since	1.0
+     */
+    static bool isTableFileValid(const unsigned char* pData, const size_t size);
+
+public:
+    /**
+     * Compiles Unicode.org mapping files to a binary table file, that can be loaded by 'loadTableFile'.<br />
+     * Each mapping file has a line by character, with the character and its Unicode code point in hex
+     * ("0x80	0x00C7	#LATIN CAPITAL LETTER C WITH CEDILLA", or "0x8140	0x3000	#IDEOGRAPHIC SPACE" for a
+     * double-byte character), the characters not listed or without code point are undefined. The lead bytes
+     * are the ones of the double-byte characters, or the ones commented as "DBCS LEAD BYTE". The code page
+     * name is the mapping file name without the extension.<br />
+     * Throws a 'runtime_error' if a file can't be read or written, or a mapping file is invalid.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	vecMappingFiles	the code page numbers and the paths of their mapping files
+     * @param	tableFile		the path of the table file to be written
+     * @since	1.0
+     */
+    static void compileTableFile(const vector<pair<CodePage, string> >& vecMappingFiles, const string& tableFile);
+
+    /**
+     * Loads a binary table file, mapping it read-only in memory, and registers all its code pages.<br />
+     * A code page already registered is replaced for the next lookups, but its handles stay valid.<br />
+     * Throws a 'runtime_error' if the file can't be mapped or isn't a valid table file.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	tableFile	the path of the table file
+     * @return	the number of code pages registered
+     * @since	1.0
+     */
+    static size_t loadTableFile(const string& tableFile);
+
+    /**
+     * Gets the handle of a registered code page.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	codePage	the code page number
+     * @return	the code page handle, or 'nullptr' if the code page isn't registered
+     * @since	1.0
+     */
+    static CodePageHandle getCodePage(const CodePage codePage);
+
+    /**
+     * Gets the handle of a registered code page by its name, or by any charset name of its number
+     * known to 'CodePage2Unicode::getCodePageFromCharsetName'.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	name	the code page name, like "CP869" or "ibm869" (case insensitive)
+     * @return	the code page handle, or 'nullptr' if the code page isn't registered
+     * @since	1.0
+     */
+    static CodePageHandle getCodePage(const char* name);
+};
+
+#endif /* _CODEPAGEREGISTRY_H_ */
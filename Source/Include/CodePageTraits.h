@@ -0,0 +1,410 @@
+/**
+ * CodePageTraits.h
+ *
+ * ABSTRACT
+ *  Definition of the compile time properties of the 8-bit code pages, used by the converters specialized
+ *  for a code page known at compile time.
+ *
+ * CONTACTS
+ *  E-mail regarding any portion of the "CodePage2Unicode" project:
+ *      José Caetano Silva, jcaetano@users.sourceforge.net
+ *
+ * COPYRIGHT
+ *  This file is distributed under the terms of the GNU General Public
+ *  License (GPL) v3. Copies of the GPL can be obtained from:
+ *      ftp://prep.ai.mit.edu/pub/gnu/GPL
+ *  Each contributing author retains all rights to their own work.
+ *
+ *  (C) 20011 - 20015   José Caetano Silva
+ *
+ * HISTORY
+ *  2026-10-17: Created.
+ */
+
+#ifndef _CODEPAGETRAITS_H_
+#define _CODEPAGETRAITS_H_
+
+#pragma once
+
+#include "StdAfx.h"
+
+#include "CodePage2Unicode.h"
+
+using namespace std;
+
+
+/**
+ * Default compile time properties of an ASCII compatible 8-bit code page, that every 'CodePageTraits'
+ * specialization overrides as needed: the 7-bit ASCII characters are the same, no extended ASCII range
+ * is mapped to the same code points, and there are no patches over the base table.
+ *
+ * @author	Jos&eacute; Caetano Silva
+ * @version	%I%, %G%
+ * @since	1.0
+ */
+struct CodePageTraitsDefaults
+{
+    /**
+     * If the characters [0; 127] are the 7-bit ASCII characters.
+     */
+    static const bool ASCII_COMPATIBLE = true;
+
+    /**
+     * The first character decoded by the base table (128 for the ASCII compatible code pages).
+     */
+    static const unsigned int TABLE_OFFSET = 128;
+
+    /**
+     * The first extended character of the range mapped to the same code points (256 if none).
+     */
+    static const unsigned int IDENTITY_FIRST = 256;
+
+    /**
+     * The last extended character of the range mapped to the same code points.
+     */
+    static const unsigned int IDENTITY_LAST = 255;
+
+    /**
+     * The number of characters that differ from the base table.
+     */
+    static const size_t PATCH_COUNT = 0;
+
+    /**
+     * Gets the table of the base code page, from the table offset to 255, or NULL if all the
+     * characters out of the identity range are unmapped.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @return	the base table
+     * @since	1.0
+     */
+    inline static const char32_t* getBaseTable(void)
+    {
+        return nullptr;
+    }
+
+    /**
+     * Applies the patches of the code page over the base table.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	code		the character [0; 255]
+     * @param	charUtf32	the character decoded by the base table or identity range
+     * @return	the code point of the character in the code page
+     * @since	1.0
+     */
+    inline static CPP11_CONSTEXPR char32_t patch(const unsigned int /* code */, const char32_t charUtf32)
+    {
+        return charUtf32;
+    }
+
+    /**
+     * Replaces the code point of a patched character, without branches, so the conversion loops of the
+     * code pages with patches are still vectorized.
+     *
+     * @author	Jos&eacute; Caetano Silva
+     * @version	%I%, %G%
+     * @param	code		the character [0; 255]
+     * @param	patchCode	the patched character
+     * @param	codePoint	the code point of the patched character
+     * @param	charUtf32	the code point of the character before the patch
+     * @return	'codePoint' if the character is the patched one, 'charUtf32' otherwise
+     * @since	1.0
+     */
+    inline static CPP11_CONSTEXPR char32_t replace(const unsigned int code, const unsigned int patchCode,
+                                                   const char32_t codePoint, const char32_t charUtf32)
+    {
+        return charUtf32 ^ ((codePoint ^ charUtf32) & static_cast<char32_t>(0U - static_cast<unsigned int>(code == patchCode)));
+    }
+};
+
+/**
+ * US-ASCII: 7-bit only, the extended characters are unmapped.
+ */
+template<>
+struct CodePageTraits<CodePage::US_ASCII> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::US_ASCII;
+    static const CodePage BASE_CODE_PAGE = CodePage::US_ASCII;
+};
+
+/**
+ * CP437: IBM/OEM/MS-DOS USA English.
+ */
+template<>
+struct CodePageTraits<CodePage::DOS_CP437> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::DOS_CP437;
+    static const CodePage BASE_CODE_PAGE = CodePage::DOS_CP437;
+
+    inline static const char32_t* getBaseTable(void)
+    {
+        return CodePage2Unicode::m_arrDOS_CP437;
+    }
+};
+
+/**
+ * CP737: IBM/OEM/MS-DOS Greek.
+ */
+template<>
+struct CodePageTraits<CodePage::DOS_CP737> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::DOS_CP737;
+    static const CodePage BASE_CODE_PAGE = CodePage::DOS_CP737;
+
+    inline static const char32_t* getBaseTable(void)
+    {
+        return CodePage2Unicode::m_arrDOS_CP737;
+    }
+};
+
+/**
+ * CP850: IBM/OEM/MS-DOS Multilingual/Latin 1/Western European.
+ */
+template<>
+struct CodePageTraits<CodePage::DOS_CP850> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::DOS_CP850;
+    static const CodePage BASE_CODE_PAGE = CodePage::DOS_CP850;
+
+    inline static const char32_t* getBaseTable(void)
+    {
+        return CodePage2Unicode::m_arrDOS_CP850;
+    }
+};
+
+/**
+ * CP858: CP850 with the "ı" changed to "€".
+ */
+template<>
+struct CodePageTraits<CodePage::DOS_CP858> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::DOS_CP858;
+    static const CodePage BASE_CODE_PAGE = CodePage::DOS_CP850;
+    static const size_t PATCH_COUNT = 1;
+
+    inline static const char32_t* getBaseTable(void)
+    {
+        return CodePage2Unicode::m_arrDOS_CP850;
+    }
+
+    inline static CPP11_CONSTEXPR char32_t patch(const unsigned int code, const char32_t charUtf32)
+    {
+        return replace(code, 213U, 0x20AC, charUtf32);  // "ı" changed to "€"
+    }
+};
+
+/**
+ * CP859: IBM/OEM/MS-DOS Latin 9/Western European + Finnish + French + €.
+ */
+template<>
+struct CodePageTraits<CodePage::DOS_CP859> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::DOS_CP859;
+    static const CodePage BASE_CODE_PAGE = CodePage::DOS_CP859;
+
+    inline static const char32_t* getBaseTable(void)
+    {
+        return CodePage2Unicode::m_arrDOS_CP859;
+    }
+};
+
+/**
+ * CP860: IBM/OEM/MS-DOS Portuguese.
+ */
+template<>
+struct CodePageTraits<CodePage::DOS_CP860> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::DOS_CP860;
+    static const CodePage BASE_CODE_PAGE = CodePage::DOS_CP860;
+
+    inline static const char32_t* getBaseTable(void)
+    {
+        return CodePage2Unicode::m_arrDOS_CP860;
+    }
+};
+
+/**
+ * MacRoman: Macintosh Latin 1/Western European + €.
+ */
+template<>
+struct CodePageTraits<CodePage::MAC_ROMAN> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::MAC_ROMAN;
+    static const CodePage BASE_CODE_PAGE = CodePage::MAC_ROMAN;
+
+    inline static const char32_t* getBaseTable(void)
+    {
+        return CodePage2Unicode::m_arrMac_Roman;
+    }
+};
+
+/**
+ * MacGreek: Macintosh Greek + €.
+ */
+template<>
+struct CodePageTraits<CodePage::MAC_GREEK> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::MAC_GREEK;
+    static const CodePage BASE_CODE_PAGE = CodePage::MAC_GREEK;
+
+    inline static const char32_t* getBaseTable(void)
+    {
+        return CodePage2Unicode::m_arrMac_Greek;
+    }
+};
+
+/**
+ * Windows-1252: Windows ANSI Latin 1/Western European + €, the same as ISO-8859-1 from 160 to 255.
+ */
+template<>
+struct CodePageTraits<CodePage::WINDOWS_1252> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::WINDOWS_1252;
+    static const CodePage BASE_CODE_PAGE = CodePage::WINDOWS_1252;
+    static const unsigned int IDENTITY_FIRST = 160;
+    static const unsigned int IDENTITY_LAST = 255;
+
+    inline static const char32_t* getBaseTable(void)
+    {
+        return CodePage2Unicode::m_arrWindows_1252;
+    }
+};
+
+/**
+ * Windows-1253: Windows ANSI Greek + €.
+ */
+template<>
+struct CodePageTraits<CodePage::WINDOWS_1253> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::WINDOWS_1253;
+    static const CodePage BASE_CODE_PAGE = CodePage::WINDOWS_1253;
+
+    inline static const char32_t* getBaseTable(void)
+    {
+        return CodePage2Unicode::m_arrWindows_1253;
+    }
+};
+
+/**
+ * ISO-8859-1: ISO/IEC Latin 1/Western European, all the characters are the same code points.
+ */
+template<>
+struct CodePageTraits<CodePage::ISO_8859_1> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::ISO_8859_1;
+    static const CodePage BASE_CODE_PAGE = CodePage::ISO_8859_1;
+    static const unsigned int IDENTITY_FIRST = 128;
+    static const unsigned int IDENTITY_LAST = 255;
+};
+
+/**
+ * ISO-8859-7: ISO/IEC Greek + €.
+ */
+template<>
+struct CodePageTraits<CodePage::ISO_8859_7> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::ISO_8859_7;
+    static const CodePage BASE_CODE_PAGE = CodePage::ISO_8859_7;
+
+    inline static const char32_t* getBaseTable(void)
+    {
+        return CodePage2Unicode::m_arrISO_8859_7;
+    }
+};
+
+/**
+ * ISO-8859-15: ISO-8859-1 with 8 characters changed, like the "¤" to "€".
+ */
+template<>
+struct CodePageTraits<CodePage::ISO_8859_15> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::ISO_8859_15;
+    static const CodePage BASE_CODE_PAGE = CodePage::ISO_8859_1;
+    static const unsigned int IDENTITY_FIRST = 128;
+    static const unsigned int IDENTITY_LAST = 255;
+    static const size_t PATCH_COUNT = 8;
+
+    inline static CPP11_CONSTEXPR char32_t patch(const unsigned int code, const char32_t charUtf32)
+    {
+        return replace(code, 164U, 0x20AC,      // "¤" changed to "€"
+               replace(code, 166U, 0x0160,      // "¦" changed to "Š"
+               replace(code, 168U, 0x0161,      // "¨" changed to "š"
+               replace(code, 180U, 0x017D,      // "´" changed to "Ž"
+               replace(code, 184U, 0x017E,      // "¸" changed to "ž"
+               replace(code, 188U, 0x0152,      // "¼" changed to "Œ"
+               replace(code, 189U, 0x0153,      // "½" changed to "œ"
+               replace(code, 190U, 0x0178,      // "¾" changed to "Ÿ"
+                       charUtf32))))))));
+    }
+};
+
+/**
+ * CP037: IBM EBCDIC US/Canada, not ASCII compatible, all the characters are in the base table.
+ */
+template<>
+struct CodePageTraits<CodePage::EBCDIC_CP037> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::EBCDIC_CP037;
+    static const CodePage BASE_CODE_PAGE = CodePage::EBCDIC_CP037;
+    static const bool ASCII_COMPATIBLE = false;
+    static const unsigned int TABLE_OFFSET = 0;
+
+    inline static const char32_t* getBaseTable(void)
+    {
+        return CodePage2Unicode::m_arrEBCDIC_CP037;
+    }
+};
+
+/**
+ * CP500: IBM EBCDIC International, not ASCII compatible, all the characters are in the base table.
+ */
+template<>
+struct CodePageTraits<CodePage::EBCDIC_CP500> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::EBCDIC_CP500;
+    static const CodePage BASE_CODE_PAGE = CodePage::EBCDIC_CP500;
+    static const bool ASCII_COMPATIBLE = false;
+    static const unsigned int TABLE_OFFSET = 0;
+
+    inline static const char32_t* getBaseTable(void)
+    {
+        return CodePage2Unicode::m_arrEBCDIC_CP500;
+    }
+};
+
+/**
+ * CP875: IBM EBCDIC Greek, not ASCII compatible, all the characters are in the base table.
+ */
+template<>
+struct CodePageTraits<CodePage::EBCDIC_CP875> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::EBCDIC_CP875;
+    static const CodePage BASE_CODE_PAGE = CodePage::EBCDIC_CP875;
+    static const bool ASCII_COMPATIBLE = false;
+    static const unsigned int TABLE_OFFSET = 0;
+
+    inline static const char32_t* getBaseTable(void)
+    {
+        return CodePage2Unicode::m_arrEBCDIC_CP875;
+    }
+};
+
+/**
+ * CP1047: IBM EBCDIC Open Systems Latin 1, not ASCII compatible, all the characters are in the base table.
+ */
+template<>
+struct CodePageTraits<CodePage::EBCDIC_CP1047> : public CodePageTraitsDefaults
+{
+    static const CodePage CODE_PAGE = CodePage::EBCDIC_CP1047;
+    static const CodePage BASE_CODE_PAGE = CodePage::EBCDIC_CP1047;
+    static const bool ASCII_COMPATIBLE = false;
+    static const unsigned int TABLE_OFFSET = 0;
+
+    inline static const char32_t* getBaseTable(void)
+    {
+        return CodePage2Unicode::m_arrEBCDIC_CP1047;
+    }
+};
+
+#endif /* _CODEPAGETRAITS_H_ */
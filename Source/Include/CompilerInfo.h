@@ -354,6 +354,35 @@
 )
 
 
+/**
+ *  These macros are for detect the machine CPU SIMD (Single Instruction Multiple Data) instruction
+ *  set enabled at compile time.
+ *
+ * __COMPILER_CPU_SIMD is set as follows:
+ *
+ * __COMPILER_CPU_SIMD_NONE		-> None (scalar code only)
+ * __COMPILER_CPU_SIMD_SSE2		-> Intel/AMD SSE2 (128-bit integer vectors)
+ * __COMPILER_CPU_SIMD_SSSE3	-> Intel/AMD SSSE3 (SSE2 + byte shuffles)
+ * __COMPILER_CPU_SIMD_SSE4_1	-> Intel/AMD SSE4.1 (SSSE3 + zero/sign extensions and unsigned packs)
+ * __COMPILER_CPU_SIMD_AVX2		-> Intel/AMD AVX2 (SSE4.1 + 256-bit integer vectors and gathers)
+ *
+ *  Note: Each instruction set includes the previous ones, so test with '>='.
+ *        Define __COMPILER_CPU_SIMD as __COMPILER_CPU_SIMD_NONE to force the scalar code.
+ */
+#define __COMPILER_CPU_SIMD_NONE    0
+#define __COMPILER_CPU_SIMD_SSE2    200
+#define __COMPILER_CPU_SIMD_SSSE3   301
+#define __COMPILER_CPU_SIMD_SSE4_1  401
+#define __COMPILER_CPU_SIMD_AVX2    602
+#define __COMPILER_CPU_SIMD_STRING	(											\
+	(__COMPILER_CPU_SIMD == __COMPILER_CPU_SIMD_SSE2) ? _T("SSE2") : (			\
+	(__COMPILER_CPU_SIMD == __COMPILER_CPU_SIMD_SSSE3) ? _T("SSSE3") : ( 		\
+	(__COMPILER_CPU_SIMD == __COMPILER_CPU_SIMD_SSE4_1) ? _T("SSE4.1") : ( 		\
+	(__COMPILER_CPU_SIMD == __COMPILER_CPU_SIMD_AVX2) ? _T("AVX2") : (			\
+	_T("None")))))																\
+)
+
+
 /**
  * Detect the compiler language standard.
  */
@@ -812,5 +841,24 @@
 #   error "Can't determine endianness"
 #endif
 
+/* Detect the CPU SIMD instruction set */
+#if !defined(__COMPILER_CPU_SIMD)
+#   if defined(__AVX2__)
+        // AVX2 (GCC/CLang -mavx2, MSVC /arch:AVX2)
+#       define __COMPILER_CPU_SIMD __COMPILER_CPU_SIMD_AVX2
+#   elif defined(__SSE4_1__) || (defined(_MSC_VER) && defined(__AVX__))
+        // SSE4.1 (GCC/CLang -msse4.1, MSVC /arch:AVX)
+#       define __COMPILER_CPU_SIMD __COMPILER_CPU_SIMD_SSE4_1
+#   elif defined(__SSSE3__)
+        // SSSE3 (GCC/CLang -mssse3)
+#       define __COMPILER_CPU_SIMD __COMPILER_CPU_SIMD_SSSE3
+#   elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        // SSE2 (always available on x64)
+#       define __COMPILER_CPU_SIMD __COMPILER_CPU_SIMD_SSE2
+#   else
+#       define __COMPILER_CPU_SIMD __COMPILER_CPU_SIMD_NONE
+#   endif
+#endif
+
 
 #endif // _COMPILERINFO_H_
@@ -72,6 +72,17 @@
 #	include <algorithm>
 #	include <cassert>
 #	ifdef __has_include
+#		if __has_include(<atomic>)
+#			include <atomic>
+#			define __HAS_INCLUDE_ATOMIC     1
+#		endif
+#	else
+#		if (defined(_MSC_VER) && (_MSC_VER >= 1700)) || (defined(__clang__) && (__clang_major__ >= 3))
+#			include <atomic>
+#			define __HAS_INCLUDE_ATOMIC     1
+#		endif
+#	endif
+#	ifdef __has_include
 #		if __has_include(<codecvt>)
 #			include <codecvt>
 #			define __HAS_INCLUDE_CODECVT    1
@@ -85,6 +96,7 @@
 #	include <cctype>
 #	include <cerrno>
 #	include <climits>
+#	include <clocale>
 #	include <cmath>
 #	include <cstdint>
 #	include <cstdio>
@@ -121,6 +133,17 @@
 #	include <iostream>
 #	include <locale>
 #	include <map>
+#	ifdef __has_include
+#		if __has_include(<mutex>)
+#			include <mutex>
+#			define __HAS_INCLUDE_MUTEX      1
+#		endif
+#	else
+#		if (defined(_MSC_VER) && (_MSC_VER >= 1700)) || (defined(__clang__) && (__clang_major__ >= 3))
+#			include <mutex>
+#			define __HAS_INCLUDE_MUTEX      1
+#		endif
+#	endif
 #	include <new>
 #	include <sstream>
 #	include <stdexcept>
@@ -176,12 +199,20 @@
 #   define __HAS_INCLUDE_WINDOWS
 #elif defined(__MACOSX__) || (defined(__APPLE__) && defined(__MACH__))
 // Mac OS X
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <fcntl.h>
+#   include <langinfo.h>
+#   include <unistd.h>
+#   define __HAS_INCLUDE_LANGINFO_H
+#   define __HAS_INCLUDE_SYS_MMAN_H
 #   define __HAS_INCLUDE_MACOS_X
 #elif defined(__MACOS__) || defined(macintosh) || defined(Macintosh)
 // Mac OS 9 or earlier
 #   define __HAS_INCLUDE_MACOS_CLASSIC
 #elif defined(__posix__) || defined(_POSIX_VERSION) || defined(_POSIX2_VERSION) || defined(_POSIX2_C_VERSION)
 // POSIX Specific
+#   include <sys/mman.h>
 #   include <sys/stat.h>
 #   include <sys/types.h>
 #   include <sys/utsname.h>
@@ -190,14 +221,23 @@
 #   include <fcntl.h>
 #   include <fenv.h>
 #   include <iconv.h>
+#   include <langinfo.h>
 #   include <pthread.h>
 #   include <unistd.h>
 #   include <utime.h>
+#   define __HAS_INCLUDE_LANGINFO_H
+#   define __HAS_INCLUDE_SYS_MMAN_H
 #   define __HAS_INCLUDE_POSIX
 #elif defined(__unix__) || defined(__unix) || defined(unix)
 // UNIX
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <fcntl.h>
+#   include <langinfo.h>
 #   include <unistd.h>
 #   include <utime.h>
+#   define __HAS_INCLUDE_LANGINFO_H
+#   define __HAS_INCLUDE_SYS_MMAN_H
 #   define __HAS_INCLUDE_UNIX
 #endif
 
@@ -152,7 +152,7 @@ namespace CaetanoSoft
 		
 		static StringConvertionCodePage getDefaultCodePage(void);
 
-		static bool isUtf8(const uint8_t * str, size_t len, bool * unicodeFound = nullptr);
+		static bool isUtf8(const uint8_t * str, size_t len, bool * unicodeFound = nullptr, size_t * errorOffset = nullptr);
 
 		static bool hasUtf8Bom(const string& str);
 
@@ -2,6 +2,7 @@
 #include "StdAfx.h"
 
 #include "StringConvertion.h"
+#include "CodePage2Unicode.h"
 
 using namespace std;
 using namespace CaetanoSoft;
@@ -392,74 +393,51 @@ string StringConvertion::convertToCodePage(const string &strNarrowNative, const
 
 StringConvertionCodePage StringConvertion::getDefaultCodePage(void)
 {
-	StringConvertionCodePage retCP = StringConvertionCodePage::SCP_UNKNOW;
-	string strLocale(locale().name());
-	if(strLocale.compare("") != 0)
+	// The default code page is resolved once from the locale character set, and cached
+	StringConvertionCodePage retCP = StringConvertionCodePage::SCP_UNKNOWNN;
+	switch(CodePage2Unicode::getDefaultNarrowCodePage())
 	{
-#if defined(_WIN32) || defined(_WIN64) || defined(_WIN32_WCE)
-		// Windows-1252
-		retCP = StringConvertionCodePage::SCP_CP1252;
-#else
-		// UTF-8
-		retCP = StringConvertionCodePage::SCP_UTF_8;
-#endif
-	}
-	else if(strLocale.compare("C") != 0)
-	{
-		// IBM437
-		retCP = StringConvertionCodePage::SCP_CP437;
-	}
-	else if(strLocale.compare("POSIX") != 0)
-	{
-		// IBM437
-		retCP = StringConvertionCodePage::SCP_CP437;
-	}
-	else if((strLocale.find(".CP1252") != string::npos) || (strLocale.find(".1252") != string::npos))
-	{
-		// Windows-1252: ANSI Latin 1 + €; Windows Western European (same as ISO-8859-1, but with more printing characters insted of control codes defined like the €)
-		retCP = StringConvertionCodePage::SCP_CP1252;
-	}
-	else if((strLocale.find(".ISO-8859-15") != string::npos) || (strLocale.find(".28605") != string::npos))
-	{
-		// ISO-8859-15: ISO Latin 9; ANSI Western European + Finnish + French + € (same as ISO-8859-1, but with 8 replaced characters like the € insted of ¤)
-		retCP = StringConvertionCodePage::SCP_ISO8859_15;
-	}
-	else if((strLocale.find(".ISO-8859-1") != string::npos) || (strLocale.find(".28591") != string::npos))
-	{
-		// ISO-8859-1: ISO Latin 1; ANSI Western European
-		retCP = StringConvertionCodePage::SCP_ISO8859_1;
-	}
-	else if((strLocale.find(".CP437") != string::npos) || (strLocale.find(".437") != string::npos))
-	{
-		// IBM437: OEM USA; DOS USA
+	case CodePage::US_ASCII:
+	case CodePage::DOS_CP437:
+		// IBM437: OEM USA; DOS USA (the 7-bit ASCII of the "C" and "POSIX" locales is a subset of it)
 		retCP = StringConvertionCodePage::SCP_CP437;
-	}
-	else if((strLocale.find(".CP850") != string::npos) || (strLocale.find(".850") != string::npos))
-	{
+		break;
+	case CodePage::DOS_CP850:
 		// IBM850: OEM Multilingual Latin 1; DOS Western European
 		retCP = StringConvertionCodePage::SCP_CP850;
-	}
-	else if((strLocale.find(".CP858") != string::npos) || (strLocale.find(".858") != string::npos))
-	{
+		break;
+	case CodePage::DOS_CP858:
 		// IBM858: OEM Multilingual Latin 1  + €; DOS Western European + € (same as IBM850, but with € insted of ı)
 		retCP = StringConvertionCodePage::SCP_CP858;
-	}
-	else if((strLocale.find(".CP860") != string::npos) || (strLocale.find(".860") != string::npos))
-	{
+		break;
+	case CodePage::DOS_CP860:
 		// IBM860: OEM Portuguese; DOS Portuguese
 		retCP = StringConvertionCodePage::SCP_CP860;
-	}
-	else if((strLocale.find(".UTF-8") != string::npos) || (strLocale.find(".utf8") != string::npos) || (strLocale.find(".65001") != string::npos))
-	{
-		// UTF-8
-		retCP = StringConvertionCodePage::SCP_UTF_8;
-	}
-	else if((strLocale.find(".MacRoman") != string::npos) || (strLocale.find(".Macintosh") != string::npos) || (strLocale.find(".10000") != string::npos))
-	{
+		break;
+	case CodePage::MAC_ROMAN:
 		// MacRoman: Macintosh Latin 1; Mac Western European
 		retCP = StringConvertionCodePage::SCP_MacRoman;
+		break;
+	case CodePage::WINDOWS_1252:
+		// Windows-1252: ANSI Latin 1 + €; Windows Western European (same as ISO-8859-1, but with more printing characters insted of control codes defined like the €)
+		retCP = StringConvertionCodePage::SCP_CP1252;
+		break;
+	case CodePage::ISO_8859_1:
+		// ISO-8859-1: ISO Latin 1; ANSI Western European
+		retCP = StringConvertionCodePage::SCP_ISO8859_1;
+		break;
+	case CodePage::ISO_8859_15:
+		// ISO-8859-15: ISO Latin 9; ANSI Western European + Finnish + French + € (same as ISO-8859-1, but with 8 replaced characters like the € insted of ¤)
+		retCP = StringConvertionCodePage::SCP_ISO8859_15;
+		break;
+	case CodePage::UTF_8:
+		// UTF-8
+		retCP = StringConvertionCodePage::SCP_UTF_8;
+		break;
+	default:
+		break;
 	}
-	
+
 	return retCP;
 }
 
@@ -475,65 +453,13 @@ StringConvertionCodePage StringConvertion::getDefaultCodePage(void)
 		110xxxxx 10xxxxxx
 		1110xxxx 10xxxxxx 10xxxxxx
 		11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
-		111110xx 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx
-		1111110x 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx
+
+	Overlong forms, UTF-16 surrogates and code points above U+10FFFF are rejected.
+	Delegates to the SIMD validator of CodePage2Unicode.
 */
-bool StringConvertion::isUtf8(const uint8_t * str, size_t len, bool * unicodeFound)
+bool StringConvertion::isUtf8(const uint8_t * str, size_t len, bool * unicodeFound, size_t * errorOffset)
 {
-	size_t i = 0;
-	size_t sequenceBytes = 0;
-
-	if(unicodeFound != nullptr)
-		*unicodeFound = false;
-
-	while(i < len)
-	{
-		if(str[i] <= 0x7F)
-			sequenceBytes = 0;	// 7 bit ASCII
-		else if((str[i] >= 0xC0) && (str[i] <= 0xDF))
-		{
-			sequenceBytes = 1;	// Sequence 11000000 to 11011111
-			if(unicodeFound != nullptr)
-				*unicodeFound = true;
-		}
-		else if((str[i] >= 0xE0) && (str[i] <= 0xEF))
-		{
-			sequenceBytes = 2;	// Sequence 11100000 to 11101111
-			if(unicodeFound != nullptr)
-				*unicodeFound = true;
-		}
-		else if((str[i] >= 0xF0) && (str[i] <= 0xF7))
-		{
-			sequenceBytes = 3;	// Sequence 11110000 to 11110111
-			if(unicodeFound != nullptr)
-				*unicodeFound = true;
-		}
-                else if((str[i] >= 0xF8) && (str[i] <= 0xFB))
-		{
-			sequenceBytes = 4;	// Sequence 11111000 to 11111011
-			if(unicodeFound != nullptr)
-				*unicodeFound = true;
-		}
-                else if((str[i] >= 0xFC) && (str[i] <= 0xFD))
-		{
-			sequenceBytes = 5;	// Sequence 11111100 to 11111101
-			if(unicodeFound != nullptr)
-				*unicodeFound = true;
-		}
-		else
-			return false;		// Invalid sequence
-
-		i += 1;
-		while((i < len) && (sequenceBytes > 0) && (str[i] >= 0x80) && (str[i] <= 0xBF))
-		{
-			i += 1;
-			sequenceBytes -= 1;
-		}
-		if(sequenceBytes != 0)
-			return false;
-	}
-
-	return true;
+	return CodePage2Unicode::isUtf8(reinterpret_cast<const char *>(str), len, unicodeFound, errorOffset);
 }
 
 bool StringConvertion::hasUtf8Bom(const string& str)
@@ -32,6 +32,8 @@
 #include "Include/StdAfx.h"
 
 #include "Include/CodePage2Unicode.h"
+#include "Include/CodePageDecoder.h"
+#include "Include/CodePageRegistry.h"
 
 using namespace std;
 
@@ -149,6 +151,974 @@ static const char32_t utf32StrEmojis[] = U"\U0001F44E\U0001F603\U0001F401\U00010
 static const char32_t utf32StrEmojis[] = { 0x0001F44EUL, 0x0001F603UL, 0x0001F401UL, 0x00010000UL, 0x0001001FUL, 0x0001000FUL, 0x000011FFUL, 0x0001F61CUL, 0x0001F44DUL, 0x00000000 };
 #endif
 
+/**
+ * The number of checks of the test program that failed.
+ */
+static unsigned int failedChecks = 0;
+
+/**
+ * Prints the result of a check of the test program, and counts it if it failed, so the test program
+ * exits with a failure status.
+ */
+static void check(const wchar_t* description, const bool passed)
+{
+    wcout << L"\t" << description << L": " << (passed ? L"passed" : L"FAILED") << endl;
+    if(!passed)
+    {
+        ++failedChecks;
+    }
+}
+
+/**
+ * Gets the next number of a pseudo-random sequence, the same on every run and platform, in [0; 32767].
+ */
+static uint32_t getNextRandom(uint32_t& seed)
+{
+    seed = seed * 1103515245UL + 12345UL;
+
+    return (seed >> 16) & 0x7FFFUL;
+}
+
+/**
+ * Builds a pseudo-random UTF-32 string of valid characters, in runs of 1 and 2 bytes UTF-8 characters
+ * (ASCII, Latin, Greek), 3 bytes UTF-8 characters and supplementary characters, so the conversions go
+ * through their SIMD blocks, the scalar code between the blocks and the scalar tails.
+ */
+static u32string getRandomUtf32String(const size_t length, uint32_t seed)
+{
+    static const char32_t arrRanges[][2] = { { 0x20, 0x7E }, { 0x20, 0x7E }, { 0xA0, 0x7FF }, { 0x800, 0xD7FF },
+                                             { 0xE000, 0xFDCF }, { 0x10000, 0x10FFFD } };
+    u32string utf32String;
+    while(utf32String.size() < length)
+    {
+        const char32_t* pRange = arrRanges[getNextRandom(seed) % 6];
+        size_t runLength = 1 + getNextRandom(seed) % 40;
+        for(size_t i = 0; (i < runLength) && (utf32String.size() < length); ++i)
+        {
+            uint32_t random = (getNextRandom(seed) << 15) | getNextRandom(seed);
+            char32_t codePoint = pRange[0] + (char32_t)(random % (pRange[1] - pRange[0] + 1));
+            if((codePoint & 0xFFFE) == 0xFFFE)
+            {
+                // Non-character of a supplementary plane
+                codePoint -= 2;
+            }
+            utf32String += codePoint;
+        }
+    }
+
+    return utf32String;
+}
+
+/**
+ * Encodes valid code points to UTF-8 one at a time, the plain scalar encoding that the conversions
+ * are compared with.
+ */
+static string encodeUtf8Scalar(const u32string& utf32String)
+{
+    string utf8String;
+    for(size_t i = 0; i < utf32String.size(); ++i)
+    {
+        char32_t codePoint = utf32String[i];
+        if(codePoint < 0x80)
+        {
+            utf8String += (char)codePoint;
+        }
+        else if(codePoint < 0x800)
+        {
+            utf8String += (char)(0xC0 | (codePoint >> 6));
+            utf8String += (char)(0x80 | (codePoint & 0x3F));
+        }
+        else if(codePoint < 0x10000)
+        {
+            utf8String += (char)(0xE0 | (codePoint >> 12));
+            utf8String += (char)(0x80 | ((codePoint >> 6) & 0x3F));
+            utf8String += (char)(0x80 | (codePoint & 0x3F));
+        }
+        else
+        {
+            utf8String += (char)(0xF0 | (codePoint >> 18));
+            utf8String += (char)(0x80 | ((codePoint >> 12) & 0x3F));
+            utf8String += (char)(0x80 | ((codePoint >> 6) & 0x3F));
+            utf8String += (char)(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    return utf8String;
+}
+
+/**
+ * Encodes valid code points to UTF-16 one at a time, the plain scalar encoding that the conversions
+ * are compared with.
+ */
+static u16string encodeUtf16Scalar(const u32string& utf32String)
+{
+    u16string utf16String;
+    for(size_t i = 0; i < utf32String.size(); ++i)
+    {
+        char32_t codePoint = utf32String[i];
+        if(codePoint < 0x10000)
+        {
+            utf16String += (char16_t)codePoint;
+        }
+        else
+        {
+            utf16String += (char16_t)(0xD800 | ((codePoint - 0x10000) >> 10));
+            utf16String += (char16_t)(0xDC00 | (codePoint & 0x3FF));
+        }
+    }
+
+    return utf16String;
+}
+
+/**
+ * Checks the direct UTF-8 and UTF-16 conversions of random strings of every length up to 256 code points
+ * against the scalar encodings.
+ */
+static bool isUtf8Utf16TranscodingScalar(void)
+{
+    bool bRet = true;
+    for(size_t length = 0; length <= 256; ++length)
+    {
+        u32string utf32String = getRandomUtf32String(length, (uint32_t)length);
+        string utf8String = encodeUtf8Scalar(utf32String);
+        u16string utf16String = encodeUtf16Scalar(utf32String);
+        bRet = bRet && (CodePage2Unicode::convertStringUtf8_to_StringUtf16(utf8String) == utf16String) &&
+                       (CodePage2Unicode::convertStringUtf16_to_StringUtf8(utf16String) == utf8String);
+    }
+
+    return bRet;
+}
+
+
+/**
+ * Checks that an unpaired UTF-16 surrogate is rejected by the strict conversion to UTF-8, and that the
+ * lenient one replaces it by one replacement character, also inside the SIMD blocks.
+ */
+static bool isUtf16SurrogateReplaced(const char16_t surrogate)
+{
+    const u16string padding(40, u'a');
+    u16string utf16String(1, u'a');
+    utf16String += surrogate;
+    utf16String += u'b';
+    bool rejected = false;
+    try
+    {
+        CodePage2Unicode::convertStringUtf16_to_StringUtf8(utf16String, true);
+    }
+    catch(const logic_error&)
+    {
+        rejected = true;
+    }
+
+    return rejected &&
+           (CodePage2Unicode::convertStringUtf16_to_StringUtf8(utf16String) == "a\xEF\xBF\xBD" "b") &&
+           (CodePage2Unicode::convertStringUtf16_to_StringUtf8(padding + utf16String + padding) ==
+            string(40, 'a') + "a\xEF\xBF\xBD" "b" + string(40, 'a'));
+}
+
+/**
+ * Checks the UTF-8 to UTF-32 conversion of random strings of every length up to 256 code points against
+ * the scalar encoding.
+ */
+static bool isUtf8Utf32DecodingScalar(void)
+{
+    bool bRet = true;
+    for(size_t length = 0; length <= 256; ++length)
+    {
+        u32string utf32String = getRandomUtf32String(length, (uint32_t)length + 1000);
+        bRet = bRet && (CodePage2Unicode::convertStringUtf8_to_StringUtf32(encodeUtf8Scalar(utf32String)) == utf32String);
+    }
+
+    return bRet;
+}
+
+/**
+ * Checks that an ill-formed UTF-8 string is rejected by the strict conversions, and that the lenient ones
+ * replace each maximal ill-formed subpart by one replacement character, also inside the SIMD blocks.
+ */
+static bool isUtf8Replaced(const string& utf8String, const u32string& utf32Replaced)
+{
+    const string padding(40, 'a');
+    const u32string utf32Padding(padding.begin(), padding.end());
+    bool rejected = false;
+    try
+    {
+        CodePage2Unicode::convertStringUtf8_to_StringUtf32(utf8String, true);
+    }
+    catch(const logic_error&)
+    {
+        rejected = true;
+    }
+
+    return rejected &&
+           (CodePage2Unicode::convertStringUtf8_to_StringUtf32(utf8String) == utf32Replaced) &&
+           (CodePage2Unicode::convertStringUtf8_to_StringUtf16(utf8String) == CodePage2Unicode::convertStringUtf32_to_StringUtf16(utf32Replaced)) &&
+           (CodePage2Unicode::convertStringUtf8_to_StringUtf32(padding + utf8String + padding) == utf32Padding + utf32Replaced + utf32Padding);
+}
+
+/**
+ * Checks the UTF-32 to UTF-8 conversion of random strings of every length up to 256 code points against
+ * the scalar encoding.
+ */
+static bool isUtf32Utf8EncodingScalar(void)
+{
+    bool bRet = true;
+    for(size_t length = 0; length <= 256; ++length)
+    {
+        u32string utf32String = getRandomUtf32String(length, (uint32_t)length + 2000);
+        bRet = bRet && (CodePage2Unicode::convertStringUtf32_to_StringUtf8(utf32String) == encodeUtf8Scalar(utf32String));
+    }
+
+    return bRet;
+}
+
+/**
+ * Checks that an invalid code point is rejected by the strict conversions to UTF-8, and that the lenient
+ * ones replace it by the replacement character and count its 3 bytes, also inside the SIMD blocks.
+ */
+static bool isUtf32InvalidReplaced(const char32_t codePoint)
+{
+    const u32string padding(40, U'a');
+    u32string utf32String(1, U'a');
+    utf32String += codePoint;
+    utf32String += U'b';
+    bool rejected = false;
+    try
+    {
+        CodePage2Unicode::convertStringUtf32_to_StringUtf8(utf32String, true);
+    }
+    catch(const logic_error&)
+    {
+        rejected = true;
+    }
+
+    // The strict buffer conversion stops before the invalid code point
+    const u32string utf32Padded = padding + utf32String + padding;
+    char arrUtf8[128];
+    ConversionResult objResult = CodePage2Unicode::convertUtf32_to_Utf8(utf32Padded.data(), utf32Padded.size(), arrUtf8, sizeof(arrUtf8), true);
+
+    return rejected &&
+           (objResult.status == ConversionStatus::INVALID_CODE_POINT) && (objResult.consumed == 41) && (objResult.written == 41) &&
+           (CodePage2Unicode::getRequiredLengthUtf32_to_Utf8(utf32Padded.data(), utf32Padded.size()) == 85) &&
+           (CodePage2Unicode::convertStringUtf32_to_StringUtf8(utf32String) == "a\xEF\xBF\xBD" "b") &&
+           (CodePage2Unicode::convertStringUtf32_to_StringUtf8(utf32Padded) ==
+            string(40, 'a') + "a\xEF\xBF\xBD" "b" + string(40, 'a'));
+}
+
+/**
+ * Checks the UTF-16 and UTF-32 conversions of random strings of every length up to 256 code points against
+ * the scalar encoding.
+ */
+static bool isUtf16Utf32ConversionScalar(void)
+{
+    bool bRet = true;
+    for(size_t length = 0; length <= 256; ++length)
+    {
+        u32string utf32String = getRandomUtf32String(length, (uint32_t)length + 3000);
+        u16string utf16String = encodeUtf16Scalar(utf32String);
+        bRet = bRet && (CodePage2Unicode::convertStringUtf32_to_StringUtf16(utf32String) == utf16String) &&
+                       (CodePage2Unicode::convertStringUtf16_to_StringUtf32(utf16String, false) == utf32String);
+    }
+
+    return bRet;
+}
+
+/**
+ * Checks the required lengths of the buffer conversions of random strings of every length up to 256 code
+ * points against the lengths of the scalar encodings, and that the buffer conversions write them.
+ */
+static bool isRequiredLengthExact(void)
+{
+    bool bRet = true;
+    for(size_t length = 0; length <= 256; ++length)
+    {
+        u32string utf32String = getRandomUtf32String(length, (uint32_t)length + 4000);
+        string utf8String = encodeUtf8Scalar(utf32String);
+        u16string utf16String = encodeUtf16Scalar(utf32String);
+        bRet = bRet && (CodePage2Unicode::getRequiredLengthUtf8_to_Utf16(utf8String.data(), utf8String.size()) == utf16String.size()) &&
+                       (CodePage2Unicode::getRequiredLengthUtf16_to_Utf8(utf16String.data(), utf16String.size()) == utf8String.size()) &&
+                       (CodePage2Unicode::getRequiredLengthUtf8_to_Utf32(utf8String.data(), utf8String.size()) == utf32String.size()) &&
+                       (CodePage2Unicode::getRequiredLengthUtf32_to_Utf8(utf32String.data(), utf32String.size()) == utf8String.size()) &&
+                       (CodePage2Unicode::getRequiredLengthUtf16_to_Utf32(utf16String.data(), utf16String.size()) == utf32String.size()) &&
+                       (CodePage2Unicode::getRequiredLengthUtf32_to_Utf16(utf32String.data(), utf32String.size()) == utf16String.size());
+
+        vector<char16_t> vecUtf16(utf16String.size() + 1);
+        ConversionResult objResult = CodePage2Unicode::convertUtf8_to_Utf16(utf8String.data(), utf8String.size(), &vecUtf16[0], vecUtf16.size());
+        bRet = bRet && (objResult.status == ConversionStatus::OK) && (objResult.consumed == utf8String.size()) &&
+                       (u16string(&vecUtf16[0], objResult.written) == utf16String);
+
+        vector<char> vecUtf8(utf8String.size() + 1);
+        objResult = CodePage2Unicode::convertUtf32_to_Utf8(utf32String.data(), utf32String.size(), &vecUtf8[0], vecUtf8.size());
+        bRet = bRet && (objResult.status == ConversionStatus::OK) && (objResult.consumed == utf32String.size()) &&
+                       (string(&vecUtf8[0], objResult.written) == utf8String);
+    }
+
+    return bRet;
+}
+
+/**
+ * Checks that an UTF-8 to UTF-16 buffer conversion stopped by a small output buffer is resumed from the
+ * consumed input up to the result of the whole conversion.
+ */
+static bool isBufferConversionResumed(void)
+{
+    const u32string utf32String = getRandomUtf32String(300, 4500);
+    const string utf8String = encodeUtf8Scalar(utf32String);
+    u16string utf16String;
+    size_t consumed = 0;
+    ConversionResult objResult;
+    do
+    {
+        char16_t arrUtf16[5];
+        objResult = CodePage2Unicode::convertUtf8_to_Utf16(utf8String.data() + consumed, utf8String.size() - consumed,
+                                                           arrUtf16, sizeof(arrUtf16) / sizeof(arrUtf16[0]));
+        utf16String.append(arrUtf16, objResult.written);
+        consumed += objResult.consumed;
+    }
+    while((objResult.status == ConversionStatus::OUTPUT_TOO_SMALL) && (objResult.consumed > 0));
+
+    return (objResult.status == ConversionStatus::OK) && (consumed == utf8String.size()) && (utf16String == encodeUtf16Scalar(utf32String));
+}
+
+/**
+ * Checks the status and the offsets of the strict and lenient buffer conversions of an UTF-8 string with
+ * an invalid lead code unit.
+ */
+static bool isBufferConversionErrorReported(void)
+{
+    const char arrUtf8[] = "a\xFF" "b";
+    char16_t arrUtf16[8];
+    ConversionResult objResult = CodePage2Unicode::convertUtf8_to_Utf16(arrUtf8, 3, arrUtf16, 8, true);
+    bool bRet = (objResult.status == ConversionStatus::INVALID_LEAD_UNIT) && (objResult.consumed == 1) &&
+                (objResult.written == 1) && (objResult.errorOffset == 1);
+
+    objResult = CodePage2Unicode::convertUtf8_to_Utf16(arrUtf8, 3, arrUtf16, 8);
+
+    return bRet && (objResult.status == ConversionStatus::OK) && (objResult.consumed == 3) && (objResult.written == 3) &&
+           (objResult.errorOffset == 1) && (arrUtf16[1] == 0xFFFD);
+}
+
+/**
+ * Checks that a surrogate code point, and its UTF-8 encoded form, are reported by the buffer conversions
+ * at their position without exceptions, stopping the strict ones and replaced by the lenient ones.
+ */
+static bool isSurrogateErrorReported(const char32_t surrogate)
+{
+    const char32_t arrUtf32[] = { U'a', surrogate, U'b' };
+    char arrUtf8[8];
+    ConversionResult objResult = CodePage2Unicode::convertUtf32_to_Utf8(arrUtf32, 3, arrUtf8, 8, true);
+    bool bRet = (objResult.status == ConversionStatus::INVALID_CODE_POINT) && (objResult.consumed == 1) &&
+                (objResult.written == 1) && (objResult.errorOffset == 1);
+
+    objResult = CodePage2Unicode::convertUtf32_to_Utf8(arrUtf32, 3, arrUtf8, 8);
+    bRet = bRet && (objResult.status == ConversionStatus::OK) && (objResult.written == 5) && (objResult.errorOffset == 1) &&
+           (memcmp(arrUtf8, "a\xEF\xBF\xBD" "b", 5) == 0);
+
+    // The UTF-8 form of the surrogate, a 0xED lead followed by [0xA0; 0xBF], is ill-formed from its second code unit
+    const char arrEncoded[] = { 'a', static_cast<char>(0xE0U | (surrogate >> 12)), static_cast<char>(0x80U | ((surrogate >> 6) & 0x3FU)),
+                                static_cast<char>(0x80U | (surrogate & 0x3FU)), 'b' };
+    char32_t arrDecoded[8];
+    objResult = CodePage2Unicode::convertUtf8_to_Utf32(arrEncoded, sizeof(arrEncoded), arrDecoded, 8, true);
+    bRet = bRet && (objResult.status == ConversionStatus::INVALID_SEQUENCE) && (objResult.consumed == 1) &&
+           (objResult.written == 1) && (objResult.errorOffset == 1);
+
+    objResult = CodePage2Unicode::convertUtf8_to_Utf32(arrEncoded, sizeof(arrEncoded), arrDecoded, 8);
+
+    return bRet && (objResult.status == ConversionStatus::OK) && (objResult.written == 5) && (objResult.errorOffset == 1) &&
+           (u32string(arrDecoded, 5) == U"a\uFFFD\uFFFD\uFFFD" "b");
+}
+
+/**
+ * Checks that the incremental UTF-8 decoder, fed with a random string split in two chunks at every position,
+ * decodes it like the whole string, also the sequences split between the chunks.
+ */
+static bool isUtf8DecodedInChunks(void)
+{
+    const u32string utf32String = getRandomUtf32String(48, 5000) + U"\u00E3\u20AC\U0001F603";
+    const string utf8String = encodeUtf8Scalar(utf32String);
+    const u16string utf16String = encodeUtf16Scalar(utf32String);
+    bool bRet = true;
+    for(size_t split = 0; split <= utf8String.size(); ++split)
+    {
+        Utf8Decoder objDecoder;
+        vector<char16_t> vecUtf16(utf16String.size() + 1);
+        ConversionResult objFirst = objDecoder.feed(utf8String.data(), split, &vecUtf16[0], vecUtf16.size());
+        ConversionResult objSecond = objDecoder.feed(utf8String.data() + split, utf8String.size() - split,
+                                                     &vecUtf16[objFirst.written], vecUtf16.size() - objFirst.written);
+        size_t written = objFirst.written + objSecond.written;
+        ConversionResult objLast = objDecoder.finish(&vecUtf16[written], vecUtf16.size() - written);
+        bRet = bRet && (objFirst.status == ConversionStatus::OK) && (objFirst.consumed == split) &&
+                       (objSecond.status == ConversionStatus::OK) && (objSecond.consumed == utf8String.size() - split) &&
+                       (objLast.status == ConversionStatus::OK) && (objLast.written == 0) &&
+                       (u16string(&vecUtf16[0], written) == utf16String);
+    }
+
+    return bRet;
+}
+
+/**
+ * Checks that the incremental UTF-8 decoder ends a stream with a truncated sequence as an incomplete one,
+ * replaced by one replacement character unless the conversion is strict.
+ */
+static bool isUtf8TruncatedAtFinish(const bool strictConversion)
+{
+    Utf8Decoder objDecoder(strictConversion);
+    char32_t arrUtf32[4];
+    ConversionResult objFeed = objDecoder.feed("a\xE2\x82", 3, arrUtf32, 4);
+    ConversionResult objLast = objDecoder.finish(&arrUtf32[objFeed.written], 4 - objFeed.written);
+    if(strictConversion)
+    {
+        return (objFeed.status == ConversionStatus::OK) && (objFeed.written == 1) &&
+               (objLast.status == ConversionStatus::INCOMPLETE_SEQUENCE) && (objLast.written == 0);
+    }
+
+    return (objFeed.status == ConversionStatus::OK) && (objFeed.written == 1) &&
+           (objLast.written == 1) && (arrUtf32[1] == 0xFFFD);
+}
+
+/**
+ * Checks the encoding, the BOM length and the byte order detected in a raw byte buffer.
+ */
+static bool isEncodingDetected(const char* buffer, const size_t length, const CodePage codePage, const size_t headerLength,
+                               const bool bigEndian)
+{
+    EncodingDetectionResult objResult = CodePage2Unicode::detectEncoding(buffer, length);
+
+    return (objResult.codePage == codePage) && (objResult.headerLength == headerLength) && (objResult.bigEndian == bigEndian);
+}
+
+// Latin 1 sentences with the usual ratio of accented letters, to be encoded in each Latin code page
+static const char32_t utf32StrPortuguese[] = U"A informação sobre a operação não está disponível. O código é válido "
+                                             U"até à próxima sessão, e a comissão já aprovou a alteração.";
+static const char32_t utf32StrFrench[] = U"Le garçon a réservé une chambre à l'hôtel, près de la forêt. Il était "
+                                         U"très content de son séjour et de la qualité du dîner.";
+
+/**
+ * Checks that the best candidate code page detected in a narrow string is one of the given code pages,
+ * since the code pages of the same family often decode a short text to the same characters.
+ */
+static bool isCodePageDetected(const string& narrowString, const CodePage codePage, const CodePage otherCodePage,
+                               const CodePage anotherCodePage)
+{
+    vector<CodePageCandidate> vecCandidates = CodePage2Unicode::detectCodePage(narrowString.data(), narrowString.size());
+
+    return !vecCandidates.empty() && ((vecCandidates[0].codePage == codePage) || (vecCandidates[0].codePage == otherCodePage) ||
+                                      (vecCandidates[0].codePage == anotherCodePage));
+}
+
+/**
+ * Checks that every character set name of a list is resolved to the given code page.
+ */
+static bool isCharsetNameResolved(const char* const arrNames[], const size_t count, const CodePage codePage)
+{
+    bool bRet = true;
+    for(size_t i = 0; i < count; ++i)
+    {
+        bRet = bRet && (CodePage2Unicode::getCodePageFromCharsetName(arrNames[i]) == codePage);
+    }
+
+    return bRet;
+}
+
+/**
+ * Checks that the converters specialized for a code page known at compile time convert every byte like
+ * the runtime converters of the code page.
+ */
+template<CodePage CP>
+static bool isCodePageTraitsLikeRuntime(void)
+{
+    char arrNarrow[256];
+    for(size_t i = 0; i < sizeof(arrNarrow); ++i)
+    {
+        arrNarrow[i] = static_cast<char>(i);
+    }
+
+    bool bRet = true;
+    for(size_t i = 0; i < sizeof(arrNarrow); ++i)
+    {
+        bRet = bRet && (CodePage2Unicode::convertCharAscii_to_CharUtf32<CP>(arrNarrow[i]) ==
+                        CodePage2Unicode::convertCharAscii_to_CharUtf32(arrNarrow[i], CP));
+    }
+
+    char32_t arrUtf32[256];
+    char32_t arrRuntimeUtf32[256];
+    ConversionResult objResult = CodePage2Unicode::convertAscii_to_Utf32<CP>(arrNarrow, 256, arrUtf32, 256);
+    ConversionResult objRuntime = CodePage2Unicode::convertAscii_to_Utf32(arrNarrow, 256, arrRuntimeUtf32, 256, CP);
+    bRet = bRet && (objResult.status == objRuntime.status) && (objResult.written == objRuntime.written) &&
+                   (memcmp(arrUtf32, arrRuntimeUtf32, objResult.written * sizeof(char32_t)) == 0);
+
+    char16_t arrUtf16[256];
+    char16_t arrRuntimeUtf16[256];
+    objResult = CodePage2Unicode::convertAscii_to_Utf16<CP>(arrNarrow, 256, arrUtf16, 256);
+    objRuntime = CodePage2Unicode::convertAscii_to_Utf16(arrNarrow, 256, arrRuntimeUtf16, 256, CP);
+
+    return bRet && (objResult.status == objRuntime.status) && (objResult.written == objRuntime.written) &&
+           (memcmp(arrUtf16, arrRuntimeUtf16, objResult.written * sizeof(char16_t)) == 0);
+}
+
+/**
+ * A temporary directory for the files written by the checks, removed with them when it goes out of scope.
+ */
+class TemporaryDirectory
+{
+public:
+    TemporaryDirectory()
+    {
+#if defined(__HAS_INCLUDE_WINDOWS)
+        char arrPath[MAX_PATH + 1];
+        DWORD length = ::GetTempPathA(MAX_PATH + 1, arrPath);
+        ostringstream objPath;
+        objPath << string(arrPath, length) << "CodePage2Unicode." << ::GetCurrentProcessId() << '.' << ::GetTickCount();
+        if(::CreateDirectoryA(objPath.str().c_str(), NULL))
+        {
+            m_path = objPath.str();
+        }
+#else
+        const char* pTemporaryPath = ::getenv("TMPDIR");
+        string pattern = string((pTemporaryPath != nullptr) ? pTemporaryPath : "/tmp") + "/CodePage2Unicode.XXXXXX";
+        vector<char> vecPath(pattern.begin(), pattern.end());
+        vecPath.push_back('\0');
+        if(::mkdtemp(&vecPath[0]) != nullptr)
+        {
+            m_path = &vecPath[0];
+        }
+#endif
+    }
+
+    ~TemporaryDirectory()
+    {
+        // The table files loaded by the registry stay mapped, so Windows keeps them until the process ends
+        for(size_t i = 0; i < m_vecFiles.size(); ++i)
+        {
+            remove(m_vecFiles[i].c_str());
+        }
+        if(!m_path.empty())
+        {
+#if defined(__HAS_INCLUDE_WINDOWS)
+            ::RemoveDirectoryA(m_path.c_str());
+#else
+            ::rmdir(m_path.c_str());
+#endif
+        }
+    }
+
+    /**
+     * Gets the path of a file in the temporary directory, removed with it.
+     */
+    string getFilePath(const string& fileName)
+    {
+#if defined(__HAS_INCLUDE_WINDOWS)
+        string filePath = m_path + '\\' + fileName;
+#else
+        string filePath = m_path + '/' + fileName;
+#endif
+        m_vecFiles.push_back(filePath);
+
+        return filePath;
+    }
+
+    /**
+     * Writes a file in the temporary directory, removed with it.
+     */
+    string writeFile(const string& fileName, const string& content)
+    {
+        string filePath = getFilePath(fileName);
+        ofstream objFile(filePath.c_str(), ios::binary);
+        objFile.write(content.data(), content.size());
+
+        return filePath;
+    }
+
+private:
+    TemporaryDirectory(const TemporaryDirectory&);
+    TemporaryDirectory& operator=(const TemporaryDirectory&);
+
+    string m_path;
+    vector<string> m_vecFiles;
+};
+
+/**
+ * Checks that an 8-bit code page compiled from a mapping file is loaded by the registry, found by its
+ * number and its name, and converted to and from UTF-32 through its handle.
+ */
+static bool isSbcsMappingFileCompiled(void)
+{
+    const CodePage codePage = static_cast<CodePage>(90020);
+    ostringstream objMapping;
+    objMapping << hex << uppercase << setfill('0');
+    for(unsigned int code = 0; code < 128; ++code)
+    {
+        objMapping << "0x" << setw(2) << code << "\t0x" << setw(4) << code << "\t#ASCII\n";
+    }
+    objMapping << "0x80\t0x0391\t#GREEK CAPITAL LETTER ALPHA\n"
+                  "0x81\t0x03A9\t#GREEK CAPITAL LETTER OMEGA\n"
+                  "0x82\t0x20AC\t#EURO SIGN\n"
+                  "0x83\t\t#UNDEFINED\n";
+
+    TemporaryDirectory objDirectory;
+    vector<pair<CodePage, string> > vecMappingFiles(1, make_pair(codePage, objDirectory.writeFile("TESTSBCS.TXT", objMapping.str())));
+    const string tableFile = objDirectory.getFilePath("TestSbcs.cptable");
+    try
+    {
+        CodePageRegistry::compileTableFile(vecMappingFiles, tableFile);
+        if(CodePageRegistry::loadTableFile(tableFile) != 1)
+        {
+            return false;
+        }
+    }
+    catch(const runtime_error&)
+    {
+        return false;
+    }
+
+    CodePageHandle hCodePage = CodePageRegistry::getCodePage(codePage);
+    if((hCodePage == nullptr) || (CodePageRegistry::getCodePage("TestSbcs") != hCodePage))
+    {
+        return false;
+    }
+
+    char32_t arrUtf32[8];
+    ConversionResult objResult = CodePage2Unicode::convertAscii_to_Utf32("A\x80\x81\x82", 4, arrUtf32, 8, hCodePage);
+    bool bRet = (objResult.status == ConversionStatus::OK) && (u32string(arrUtf32, objResult.written) == U"AΑΩ€");
+
+    char arrNarrow[8];
+    objResult = CodePage2Unicode::convertUtf32_to_Ascii(U"AΑΩ€é", 5, arrNarrow, 8, hCodePage);
+
+    return bRet && (objResult.status == ConversionStatus::OK) && (string(arrNarrow, objResult.written) == "A\x80\x81\x82?");
+}
+
+/**
+ * Checks if the compilation of a mapping file, with the ASCII characters and one extended character
+ * mapped to the given code point, is rejected.
+ */
+static bool isMappingFileRejected(const char32_t codePoint)
+{
+    ostringstream objMapping;
+    objMapping << hex << uppercase << setfill('0');
+    for(unsigned int code = 0; code < 128; ++code)
+    {
+        objMapping << "0x" << setw(2) << code << "\t0x" << setw(4) << code << "\n";
+    }
+    objMapping << "0x80\t0x" << setw(4) << static_cast<unsigned long>(codePoint) << "\n";
+
+    TemporaryDirectory objDirectory;
+    vector<pair<CodePage, string> > vecMappingFiles(1, make_pair(static_cast<CodePage>(90021),
+                                                                 objDirectory.writeFile("REJECTED.TXT", objMapping.str())));
+    try
+    {
+        CodePageRegistry::compileTableFile(vecMappingFiles, objDirectory.getFilePath("Rejected.cptable"));
+    }
+    catch(const runtime_error&)
+    {
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Compiles a mapping file to a table file in a temporary directory and loads it in the registry.
+ */
+static CodePageHandle loadMappingFile(TemporaryDirectory& objDirectory, const CodePage codePage, const string& name,
+                                      const string& mapping)
+{
+    vector<pair<CodePage, string> > vecMappingFiles(1, make_pair(codePage, objDirectory.writeFile(name + ".TXT", mapping)));
+    const string tableFile = objDirectory.getFilePath(name + ".cptable");
+    try
+    {
+        CodePageRegistry::compileTableFile(vecMappingFiles, tableFile);
+        CodePageRegistry::loadTableFile(tableFile);
+    }
+    catch(const runtime_error&)
+    {
+        return nullptr;
+    }
+
+    return CodePageRegistry::getCodePage(codePage);
+}
+
+/**
+ * Gets the mapping of the 7-bit ASCII characters to themselves, in the format of the Unicode.org mapping files.
+ */
+static string getAsciiMapping(void)
+{
+    ostringstream objMapping;
+    objMapping << hex << uppercase << setfill('0');
+    for(unsigned int code = 0; code < 128; ++code)
+    {
+        objMapping << "0x" << setw(2) << code << "\t0x" << setw(4) << code << "\t#ASCII\n";
+    }
+
+    return objMapping.str();
+}
+
+/**
+ * Checks that a double-byte code page compiled from a mapping file decodes and encodes its single-byte
+ * and double-byte characters, also after the SIMD 7-bit ASCII blocks, and reports a lead byte at the end
+ * as an incomplete sequence.
+ */
+static bool isDbcsMappingFileCompiled(void)
+{
+    TemporaryDirectory objDirectory;
+    CodePageHandle hCodePage = loadMappingFile(objDirectory, static_cast<CodePage>(90950), "TESTDBCS",
+                                               getAsciiMapping() + "0x80\t\t#DBCS LEAD BYTE\n"
+                                                                   "0xA140\t0x3000\t#IDEOGRAPHIC SPACE\n"
+                                                                   "0xA4A4\t0x4E2D\t#CJK UNIFIED IDEOGRAPH\n"
+                                                                   "0xA4E5\t0x6587\t#CJK UNIFIED IDEOGRAPH\n");
+    if((hCodePage == nullptr) || (CodePageRegistry::getCodePage("TestDbcs") != hCodePage))
+    {
+        return false;
+    }
+
+    const string padding(40, 'a');
+    const u16string utf16Padding(40, u'a');
+    const string narrowString = padding + "A\xA4\xA4\xA4\xE5\xA1\x40" "B" + padding;
+    const u16string utf16String = utf16Padding + u"A中文　B" + utf16Padding;
+    vector<char16_t> vecUtf16(narrowString.size());
+    ConversionResult objResult = CodePage2Unicode::convertAscii_to_Utf16(narrowString.data(), narrowString.size(), &vecUtf16[0],
+                                                                         vecUtf16.size(), hCodePage);
+    bool bRet = (objResult.status == ConversionStatus::OK) && (objResult.consumed == narrowString.size()) &&
+                (u16string(&vecUtf16[0], objResult.written) == utf16String);
+
+    const u32string utf32String = CodePage2Unicode::convertStringUtf16_to_StringUtf32(utf16String, false) + U"é";
+    vector<char> vecNarrow(utf32String.size() * 2);
+    objResult = CodePage2Unicode::convertUtf32_to_Ascii(utf32String.data(), utf32String.size(), &vecNarrow[0], vecNarrow.size(), hCodePage);
+    bRet = bRet && (objResult.status == ConversionStatus::OK) && (string(&vecNarrow[0], objResult.written) == narrowString + "?");
+
+    objResult = CodePage2Unicode::convertAscii_to_Utf16("A\xA4", 2, &vecUtf16[0], vecUtf16.size(), hCodePage);
+
+    return bRet && (objResult.status == ConversionStatus::INCOMPLETE_SEQUENCE) && (objResult.consumed == 1) && (objResult.written == 1);
+}
+
+/**
+ * Checks that the characters of a double-byte code page mapped from the same code points are encoded as
+ * the characters that Windows prefers.
+ */
+static bool isDuplicateEncodedAs(const CodePage codePage, const string& name, const string& mapping, const u32string& utf32String,
+                                 const string& narrowString)
+{
+    TemporaryDirectory objDirectory;
+    CodePageHandle hCodePage = loadMappingFile(objDirectory, codePage, name, getAsciiMapping() + mapping);
+    if(hCodePage == nullptr)
+    {
+        return false;
+    }
+
+    char arrNarrow[16];
+    ConversionResult objResult = CodePage2Unicode::convertUtf32_to_Ascii(utf32String.data(), utf32String.size(), arrNarrow, sizeof(arrNarrow),
+                                                                         hCodePage);
+
+    return (objResult.status == ConversionStatus::OK) && (string(arrNarrow, objResult.written) == narrowString);
+}
+
+/**
+ * No field of the table file is patched by 'isPatchedTableFileLoaded'.
+ */
+static const size_t NO_PATCHED_FIELD = (size_t)-1;
+
+/**
+ * Compiles a valid table file in a temporary directory, truncates it and patches one of the fields of its
+ * header or directory entry, and checks if the registry loads it.
+ */
+static bool isPatchedTableFileLoaded(const size_t fileSize, const size_t fieldOffset, const uint32_t value)
+{
+    TemporaryDirectory objDirectory;
+    vector<pair<CodePage, string> > vecMappingFiles(1, make_pair(static_cast<CodePage>(90001),
+                                                                 objDirectory.writeFile("PATCHED.TXT", getAsciiMapping())));
+    const string tableFile = objDirectory.getFilePath("Patched.cptable");
+    try
+    {
+        CodePageRegistry::compileTableFile(vecMappingFiles, tableFile);
+    }
+    catch(const runtime_error&)
+    {
+        return false;
+    }
+
+    ifstream objInput(tableFile.c_str(), ios::binary);
+    vector<char> vecData((istreambuf_iterator<char>(objInput)), istreambuf_iterator<char>());
+    objInput.close();
+    if(fileSize != 0)
+    {
+        vecData.resize(fileSize);
+    }
+    if(fieldOffset != NO_PATCHED_FIELD)
+    {
+        memcpy(&vecData[fieldOffset], &value, sizeof(value));
+    }
+    ofstream objOutput(tableFile.c_str(), ios::binary);
+    objOutput.write(&vecData[0], vecData.size());
+    objOutput.close();
+
+    try
+    {
+        CodePageRegistry::loadTableFile(tableFile);
+    }
+    catch(const runtime_error&)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Checks that the byte to byte translation of all the EBCDIC characters of a Latin-1 EBCDIC code page
+ * matches the decoding of each character, and that the characters are all distinct.
+ */
+static bool isEbcdicTranslatedToLatin1(const CodePage codePage)
+{
+    // Twice the 256 characters, so the SIMD blocks and the scalar tail are both used
+    char arrEbcdic[512 + 7];
+    for(size_t i = 0; i < sizeof(arrEbcdic); ++i)
+    {
+        arrEbcdic[i] = static_cast<char>(i);
+    }
+
+    char arrLatin1[sizeof(arrEbcdic)];
+    ConversionResult objResult = CodePage2Unicode::convertEbcdic_to_Latin1(arrEbcdic, sizeof(arrEbcdic), arrLatin1, sizeof(arrLatin1),
+                                                                           codePage, UnmappableAction::STRICT);
+    bool bRet = (objResult.status == ConversionStatus::OK) && (objResult.written == sizeof(arrEbcdic));
+    vector<bool> vecTranslated(256, false);
+    for(size_t i = 0; bRet && (i < sizeof(arrEbcdic)); ++i)
+    {
+        unsigned char latin1Char = static_cast<unsigned char>(arrLatin1[i]);
+        bRet = (CodePage2Unicode::convertCharAscii_to_CharUtf32(arrEbcdic[i], codePage) == (char32_t)latin1Char) &&
+               ((i >= 256) || !vecTranslated[latin1Char]);
+        vecTranslated[latin1Char] = true;
+    }
+
+    return bRet;
+}
+
+/**
+ * Checks that the direct translation of every byte between two code pages matches the decoding to UTF-32
+ * followed by the encoding to the destination code page, with the same replacement of the unmappable ones.
+ */
+static bool isCodePageTranslatedThroughUtf32(const CodePage fromCodePage, const CodePage toCodePage)
+{
+    // Twice the 256 characters, so the SIMD blocks and the scalar tail are both used
+    char arrSource[512 + 7];
+    for(size_t i = 0; i < sizeof(arrSource); ++i)
+    {
+        arrSource[i] = static_cast<char>(i);
+    }
+
+    char arrTranslated[sizeof(arrSource)];
+    ConversionResult objResult = CodePage2Unicode::translateCodePage(arrSource, sizeof(arrSource), arrTranslated, sizeof(arrTranslated),
+                                                                     fromCodePage, toCodePage);
+    char32_t arrUtf32[sizeof(arrSource)];
+    ConversionResult objDecoded = CodePage2Unicode::convertAscii_to_Utf32(arrSource, sizeof(arrSource), arrUtf32, sizeof(arrSource), fromCodePage);
+    char arrEncoded[sizeof(arrSource)];
+    ConversionResult objEncoded = CodePage2Unicode::convertUtf32_to_Ascii(arrUtf32, objDecoded.written, arrEncoded, sizeof(arrEncoded), toCodePage);
+
+    return (objResult.status == ConversionStatus::OK) && (objResult.written == sizeof(arrSource)) &&
+           (objDecoded.written == sizeof(arrSource)) && (objEncoded.written == sizeof(arrSource)) &&
+           (memcmp(arrTranslated, arrEncoded, sizeof(arrSource)) == 0);
+}
+
+/**
+ * Checks that a code page is translated to itself as a lossless identity copy of every byte, also the ones
+ * without a map, both to another buffer and in place.
+ */
+static bool isCodePageTranslatedToItself(const CodePage codePage)
+{
+    char arrSource[256];
+    for(size_t i = 0; i < sizeof(arrSource); ++i)
+    {
+        arrSource[i] = static_cast<char>(i);
+    }
+
+    char arrTranslated[256];
+    ConversionResult objResult = CodePage2Unicode::translateCodePage(arrSource, sizeof(arrSource), arrTranslated, sizeof(arrTranslated),
+                                                                     codePage, codePage, UnmappableAction::STRICT);
+    bool bRet = CodePage2Unicode::isCodePageTranslationLossless(codePage, codePage) &&
+                (objResult.status == ConversionStatus::OK) && (objResult.written == sizeof(arrSource)) &&
+                (memcmp(arrSource, arrTranslated, sizeof(arrSource)) == 0);
+
+    objResult = CodePage2Unicode::translateCodePage(arrTranslated, sizeof(arrTranslated), arrTranslated, sizeof(arrTranslated),
+                                                    codePage, codePage, UnmappableAction::STRICT);
+
+    return bRet && (objResult.status == ConversionStatus::OK) && (memcmp(arrSource, arrTranslated, sizeof(arrSource)) == 0);
+}
+
+/**
+ * Builds a pseudo-random string of the mapped characters of an 8-bit code page, in runs of 7-bit ASCII
+ * characters, of extended ASCII characters and of both, so the conversions go through their SIMD blocks,
+ * the per-character path between the blocks and the scalar tails.
+ */
+static string getRandomNarrowString(const size_t length, uint32_t seed, const CodePage codePage)
+{
+    static const unsigned int arrRanges[][2] = { { 0x20, 0x7E }, { 0x20, 0x7E }, { 0xA0, 0xFF }, { 0x01, 0xFF } };
+    string narrowString;
+    while(narrowString.size() < length)
+    {
+        const unsigned int* pRange = arrRanges[getNextRandom(seed) % 4];
+        size_t runLength = 1 + getNextRandom(seed) % 40;
+        for(size_t i = 0; (i < runLength) && (narrowString.size() < length); ++i)
+        {
+            char narrowChar = static_cast<char>(pRange[0] + getNextRandom(seed) % (pRange[1] - pRange[0] + 1));
+            if(CodePage2Unicode::convertCharAscii_to_CharUtf32(narrowChar, codePage) != (char32_t)0xFFFD)
+            {
+                narrowString += narrowChar;
+            }
+        }
+    }
+
+    return narrowString;
+}
+
+/**
+ * Decodes the characters of an 8-bit code page one at a time, the plain scalar decoding that the conversions
+ * are compared with.
+ */
+static u32string decodeAsciiScalar(const string& narrowString, const CodePage codePage)
+{
+    u32string utf32String;
+    for(size_t i = 0; i < narrowString.size(); ++i)
+    {
+        utf32String += CodePage2Unicode::convertCharAscii_to_CharUtf32(narrowString[i], codePage);
+    }
+
+    return utf32String;
+}
+
+/**
+ * Checks the conversions between an 8-bit code page and UTF-8 of random strings of every length up to
+ * 256 characters against the scalar decoding and encoding.
+ */
+static bool isAsciiUtf8ConversionScalar(const CodePage codePage)
+{
+    bool bRet = true;
+    for(size_t length = 0; length <= 256; ++length)
+    {
+        string narrowString = getRandomNarrowString(length, (uint32_t)length + 6000, codePage);
+        string utf8String = encodeUtf8Scalar(decodeAsciiScalar(narrowString, codePage));
+        bRet = bRet && (CodePage2Unicode::convertStringAscii_to_StringUtf8(narrowString, codePage) == utf8String) &&
+                       (CodePage2Unicode::convertStringUtf8_to_StringAscii(utf8String, codePage) == narrowString);
+    }
+
+    return bRet;
+}
+
+/**
+ * Checks the conversions between an 8-bit code page and UTF-16 of random strings of every length up to
+ * 256 characters against the scalar decoding and encoding.
+ */
+static bool isAsciiUtf16ConversionScalar(const CodePage codePage)
+{
+    bool bRet = true;
+    for(size_t length = 0; length <= 256; ++length)
+    {
+        string narrowString = getRandomNarrowString(length, (uint32_t)length + 7000, codePage);
+        u16string utf16String = encodeUtf16Scalar(decodeAsciiScalar(narrowString, codePage));
+        bRet = bRet && (CodePage2Unicode::convertStringAscii_to_StringUtf16(narrowString, codePage) == utf16String) &&
+                       (CodePage2Unicode::convertStringUtf16_to_StringAscii(utf16String, codePage) == narrowString);
+    }
+
+    return bRet;
+}
+
 int main(void)
 {
     // Set the locale of the console to the user default
@@ -367,6 +1337,195 @@ int main(void)
 	wcout << L"\tUTF-8 + BOM Marker: " << wideString << endl;
     wcout << noboolalpha;
 
+	wcout << endl;
+	wcout << L"UTF-8 and UTF-16 Direct Conversions: " << endl;
+	check(L"Random Strings Like The Scalar Encodings", isUtf8Utf16TranscodingScalar());
+	check(L"Unpaired High Surrogate Replaced", isUtf16SurrogateReplaced(0xD800));
+	check(L"Unpaired Low Surrogate Replaced", isUtf16SurrogateReplaced(0xDFFF));
+	check(L"U+0000 Kept", CodePage2Unicode::convertStringUtf8_to_StringUtf16(string("a\0b", 3)) == u16string(u"a\0b", 3));
+
+	wcout << endl;
+	wcout << L"UTF-8 to UTF-32 Conversions: " << endl;
+	check(L"Random Strings Like The Scalar Encoding", isUtf8Utf32DecodingScalar());
+
+	wcout << endl;
+	wcout << L"Ill-formed UTF-8 Replacement: " << endl;
+	check(L"Above U+10FFFF", isUtf8Replaced("\xF4\x9D\xA0\x80", U"\uFFFD\uFFFD\uFFFD\uFFFD"));
+	check(L"UTF-16 Surrogate", isUtf8Replaced("\xED\xA0\x80", U"\uFFFD\uFFFD\uFFFD"));
+	check(L"Overlong 2 Bytes", isUtf8Replaced("\xC0\xAF", U"\uFFFD\uFFFD"));
+	check(L"Overlong 3 Bytes", isUtf8Replaced("\xE0\x80\xAF", U"\uFFFD\uFFFD\uFFFD"));
+	check(L"Maximal Subparts", isUtf8Replaced("a\xF1\x80\x80\xE1\x80\xC2" "b\x80" "c\x80\xBF" "d",
+	                                          U"a\uFFFD\uFFFD\uFFFD" "b\uFFFD" "c\uFFFD\uFFFD" "d"));
+
+	wcout << endl;
+	wcout << L"UTF-32 to UTF-8 Conversions: " << endl;
+	check(L"Random Strings Like The Scalar Encoding", isUtf32Utf8EncodingScalar());
+	check(L"Above U+10FFFF Replaced", isUtf32InvalidReplaced(0x110000));
+	check(L"Non-character U+FFFE Replaced", isUtf32InvalidReplaced(0xFFFE));
+	check(L"Non-character U+FDD0 Replaced", isUtf32InvalidReplaced(0xFDD0));
+	check(L"High Surrogate U+D800 Replaced", isUtf32InvalidReplaced(0xD800));
+	check(L"Low Surrogate U+DFFF Replaced", isUtf32InvalidReplaced(0xDFFF));
+
+	wcout << endl;
+	wcout << L"UTF-16 and UTF-32 Conversions: " << endl;
+	check(L"Random Strings Like The Scalar Encoding", isUtf16Utf32ConversionScalar());
+
+	wcout << endl;
+	wcout << L"Buffer Conversions: " << endl;
+	check(L"Required Lengths Exact", isRequiredLengthExact());
+	check(L"Resumed After Output Too Small", isBufferConversionResumed());
+	check(L"Invalid Lead Unit Reported", isBufferConversionErrorReported());
+	check(L"High Surrogate U+D800 Reported", isSurrogateErrorReported(0xD800));
+	check(L"Low Surrogate U+DFFF Reported", isSurrogateErrorReported(0xDFFF));
+
+	wcout << endl;
+	wcout << L"Incremental Decoders: " << endl;
+	check(L"UTF-8 Split At Every Position", isUtf8DecodedInChunks());
+	check(L"Truncated UTF-8 Replaced At The End", isUtf8TruncatedAtFinish(false));
+	check(L"Truncated UTF-8 Rejected At The End", isUtf8TruncatedAtFinish(true));
+
+	wcout << endl;
+	wcout << L"Encoding Detection: " << endl;
+	check(L"UTF-8 BOM", isEncodingDetected("\xEF\xBB\xBF" "abc", 6, CodePage::UTF_8, 3, false));
+	check(L"UTF-16LE BOM", isEncodingDetected("\xFF\xFE" "a\0", 4, CodePage::UTF_16, 2, false));
+	check(L"UTF-16BE BOM", isEncodingDetected("\xFE\xFF\0a", 4, CodePage::UTF_16, 2, true));
+	check(L"UTF-32LE BOM", isEncodingDetected("\xFF\xFE\0\0" "a\0\0\0", 8, CodePage::UTF_32, 4, false));
+	check(L"UTF-32BE BOM", isEncodingDetected("\0\0\xFE\xFF\0\0\0a", 8, CodePage::UTF_32, 4, true));
+	check(L"UTF-7 BOM", isEncodingDetected("+/v8-abc", 8, CodePage::UTF_7, 5, false));
+	check(L"7-bit ASCII", isEncodingDetected("abc", 3, CodePage::US_ASCII, 0, false));
+	check(L"UTF-8 Without BOM", isEncodingDetected(utf8StrUTF_8, sizeof(utf8StrUTF_8) - 1, CodePage::UTF_8, 0, false));
+	check(L"UTF-8 Truncated At The End", isEncodingDetected("a\xC3\xA9\xE2\x82", 5, CodePage::UTF_8, 0, false));
+	check(L"Windows-1252 Isn't UTF-8", isEncodingDetected(aStrWin1252, sizeof(aStrWin1252) - 1, CodePage::UNKNOWN, 0, false));
+
+	wcout << endl;
+	wcout << L"Code Page Detection: " << endl;
+	check(L"Portuguese Windows-1252 As Latin 1", isCodePageDetected(objString->convertStringUtf32_to_StringAscii(utf32StrPortuguese, CodePage::WINDOWS_1252),
+	                                                                 CodePage::WINDOWS_1252, CodePage::ISO_8859_1, CodePage::ISO_8859_15));
+	check(L"French ISO 8859-15 As Latin 1", isCodePageDetected(objString->convertStringUtf32_to_StringAscii(utf32StrFrench, CodePage::ISO_8859_15),
+	                                                            CodePage::WINDOWS_1252, CodePage::ISO_8859_1, CodePage::ISO_8859_15));
+	check(L"French DOS CP437 As DOS Latin", isCodePageDetected(objString->convertStringUtf32_to_StringAscii(utf32StrFrench, CodePage::DOS_CP437),
+	                                                            CodePage::DOS_CP437, CodePage::DOS_CP850, CodePage::DOS_CP860));
+	check(L"Portuguese MacOS Roman", isCodePageDetected(objString->convertStringUtf32_to_StringAscii(utf32StrPortuguese, CodePage::MAC_ROMAN),
+	                                                     CodePage::MAC_ROMAN, CodePage::MAC_ROMAN, CodePage::MAC_ROMAN));
+	check(L"Greek DOS CP737", isCodePageDetected(strCP737, CodePage::DOS_CP737, CodePage::DOS_CP737, CodePage::DOS_CP737));
+	check(L"Greek MacOS Greek", isCodePageDetected(strMacGreek, CodePage::MAC_GREEK, CodePage::MAC_GREEK, CodePage::MAC_GREEK));
+	check(L"Greek Windows 1253 As Greek", isCodePageDetected(strWin1253, CodePage::WINDOWS_1253, CodePage::ISO_8859_7, CodePage::ISO_8859_7));
+	check(L"Greek ISO 8859-7 As Greek", isCodePageDetected(strISO_8859_7, CodePage::WINDOWS_1253, CodePage::ISO_8859_7, CodePage::ISO_8859_7));
+	vector<CodePageCandidate> vecCandidates = objString->detectCodePage(aStrCP367, sizeof(aStrCP367) - 1);
+	check(L"7-bit ASCII Only", (vecCandidates.size() == 1) && (vecCandidates[0].codePage == CodePage::US_ASCII) && (vecCandidates[0].confidence == 1.0));
+
+	wcout << endl;
+	wcout << L"Character Set Names: " << endl;
+	const char* const arrUtf8Names[] = { "UTF-8", "utf8", "UTF_8", "utf-8@euro", "65001" };
+	check(L"UTF-8", isCharsetNameResolved(arrUtf8Names, sizeof(arrUtf8Names) / sizeof(arrUtf8Names[0]), CodePage::UTF_8));
+	const char* const arrAsciiNames[] = { "ANSI_X3.4-1968", "US-ASCII", "ascii", "646", "IBM367" };
+	check(L"US-ASCII", isCharsetNameResolved(arrAsciiNames, sizeof(arrAsciiNames) / sizeof(arrAsciiNames[0]), CodePage::US_ASCII));
+	const char* const arrLatin9Names[] = { "ISO-8859-15", "iso885915@euro", "ISO_8859-15", "LATIN-9", "28605" };
+	check(L"ISO 8859-15", isCharsetNameResolved(arrLatin9Names, sizeof(arrLatin9Names) / sizeof(arrLatin9Names[0]), CodePage::ISO_8859_15));
+	const char* const arrWin1252Names[] = { "CP1252", "windows-1252", "1252" };
+	check(L"Windows 1252", isCharsetNameResolved(arrWin1252Names, sizeof(arrWin1252Names) / sizeof(arrWin1252Names[0]), CodePage::WINDOWS_1252));
+	const char* const arrWin1253Names[] = { "CP1253", "Windows-1253", "1253" };
+	check(L"Windows 1253", isCharsetNameResolved(arrWin1253Names, sizeof(arrWin1253Names) / sizeof(arrWin1253Names[0]), CodePage::WINDOWS_1253));
+	const char* const arrDosNames[] = { "IBM850", "cp850", "850" };
+	check(L"DOS CP850", isCharsetNameResolved(arrDosNames, sizeof(arrDosNames) / sizeof(arrDosNames[0]), CodePage::DOS_CP850));
+	const char* const arrMacNames[] = { "macintosh", "x-mac-roman", "MacRoman" };
+	check(L"MacOS Roman", isCharsetNameResolved(arrMacNames, sizeof(arrMacNames) / sizeof(arrMacNames[0]), CodePage::MAC_ROMAN));
+	const char* const arrUnknownNames[] = { "", "UTF-16", "ISO-8859-2", "utf88", "windows-12521252", "ISO-8859-15-ISO-8859-15-ISO-8859-15", nullptr };
+	check(L"Unknown Names", isCharsetNameResolved(arrUnknownNames, sizeof(arrUnknownNames) / sizeof(arrUnknownNames[0]), CodePage::UNKNOWN));
+
+	wcout << endl;
+	wcout << L"Code Page Traits Specialized Conversions: " << endl;
+	check(L"US-ASCII", isCodePageTraitsLikeRuntime<CodePage::US_ASCII>());
+	check(L"DOS CP437", isCodePageTraitsLikeRuntime<CodePage::DOS_CP437>());
+	check(L"DOS CP737", isCodePageTraitsLikeRuntime<CodePage::DOS_CP737>());
+	check(L"DOS CP850", isCodePageTraitsLikeRuntime<CodePage::DOS_CP850>());
+	check(L"DOS CP858", isCodePageTraitsLikeRuntime<CodePage::DOS_CP858>());
+	check(L"DOS CP859", isCodePageTraitsLikeRuntime<CodePage::DOS_CP859>());
+	check(L"DOS CP860", isCodePageTraitsLikeRuntime<CodePage::DOS_CP860>());
+	check(L"MacOS Roman", isCodePageTraitsLikeRuntime<CodePage::MAC_ROMAN>());
+	check(L"MacOS Greek", isCodePageTraitsLikeRuntime<CodePage::MAC_GREEK>());
+	check(L"Windows 1252", isCodePageTraitsLikeRuntime<CodePage::WINDOWS_1252>());
+	check(L"Windows 1253", isCodePageTraitsLikeRuntime<CodePage::WINDOWS_1253>());
+	check(L"ISO 8859-1", isCodePageTraitsLikeRuntime<CodePage::ISO_8859_1>());
+	check(L"ISO 8859-7", isCodePageTraitsLikeRuntime<CodePage::ISO_8859_7>());
+	check(L"ISO 8859-15", isCodePageTraitsLikeRuntime<CodePage::ISO_8859_15>());
+
+	wcout << endl;
+	wcout << L"Code Page Registry: " << endl;
+	check(L"8-bit Mapping File Compiled And Loaded", isSbcsMappingFileCompiled());
+	check(L"Mapping To U+D7FF Accepted", !isMappingFileRejected(0xD7FF));
+	check(L"Mapping To High Surrogate U+D800 Rejected", isMappingFileRejected(0xD800));
+	check(L"Mapping To Low Surrogate U+DFFF Rejected", isMappingFileRejected(0xDFFF));
+	check(L"Double-byte Mapping File Compiled And Loaded", isDbcsMappingFileCompiled());
+	check(L"Windows-950 Duplicates Encoded As Big5", isDuplicateEncodedAs(CodePage::WINDOWS_950, "CP950",
+	                                                                      "0xA2\t\t#DBCS LEAD BYTE\n"
+	                                                                      "0xA4\t\t#DBCS LEAD BYTE\n"
+	                                                                      "0xA2CC\t0x5341\t#CJK UNIFIED IDEOGRAPH\n"
+	                                                                      "0xA2CE\t0x5345\t#CJK UNIFIED IDEOGRAPH\n"
+	                                                                      "0xA451\t0x5341\t#CJK UNIFIED IDEOGRAPH\n"
+	                                                                      "0xA4CA\t0x5345\t#CJK UNIFIED IDEOGRAPH\n",
+	                                                                      U"\u5341\u5345", "\xA4\x51\xA4\xCA"));
+	check(L"Windows-932 Duplicates Encoded Out Of The NEC Selected Extensions", isDuplicateEncodedAs(CodePage::WINDOWS_932, "CP932",
+	                                                                      "0x81\t\t#DBCS LEAD BYTE\n"
+	                                                                      "0xED\t\t#DBCS LEAD BYTE\n"
+	                                                                      "0xEE\t\t#DBCS LEAD BYTE\n"
+	                                                                      "0xFA\t\t#DBCS LEAD BYTE\n"
+	                                                                      "0x81CA\t0xFFE2\t#FULLWIDTH NOT SIGN\n"
+	                                                                      "0xED40\t0x7E8A\t#CJK UNIFIED IDEOGRAPH\n"
+	                                                                      "0xEEF9\t0xFFE2\t#FULLWIDTH NOT SIGN\n"
+	                                                                      "0xFA54\t0xFFE2\t#FULLWIDTH NOT SIGN\n"
+	                                                                      "0xFA5C\t0x7E8A\t#CJK UNIFIED IDEOGRAPH\n",
+	                                                                      U"\uFFE2\u7E8A", "\x81\xCA\xFA\x5C"));
+	check(L"Valid Table File Loaded", isPatchedTableFileLoaded(0, NO_PATCHED_FIELD, 0));
+	check(L"Truncated Table File Rejected", !isPatchedTableFileLoaded(sizeof(CodePageRegistry::TableFileHeader) + sizeof(CodePageRegistry::TableFileEntry),
+	                                                                  NO_PATCHED_FIELD, 0));
+	check(L"Table File Smaller Than Its Tables Rejected", !isPatchedTableFileLoaded(sizeof(CodePageRegistry::TableFileHeader) + sizeof(CodePageRegistry::TableFileEntry),
+	                                                                                offsetof(CodePageRegistry::TableFileHeader, fileSize),
+	                                                                                sizeof(CodePageRegistry::TableFileHeader) + sizeof(CodePageRegistry::TableFileEntry)));
+	check(L"Table Offset Out Of The File Rejected", !isPatchedTableFileLoaded(0, sizeof(CodePageRegistry::TableFileHeader) +
+	                                                                                 offsetof(CodePageRegistry::TableFileEntry, utf8Offset), 0x10000000UL));
+	check(L"Wrong Signature Rejected", !isPatchedTableFileLoaded(0, offsetof(CodePageRegistry::TableFileHeader, magic),
+	                                                             ~CodePageRegistry::TABLE_FILE_MAGIC));
+
+	wcout << endl;
+	wcout << L"EBCDIC Conversions: " << endl;
+	check(L"CP037 To Latin-1", isEbcdicTranslatedToLatin1(CodePage::EBCDIC_CP037));
+	check(L"CP500 To Latin-1", isEbcdicTranslatedToLatin1(CodePage::EBCDIC_CP500));
+	check(L"CP1047 To Latin-1", isEbcdicTranslatedToLatin1(CodePage::EBCDIC_CP1047));
+	check(L"CP037 Text", objString->convertStringAscii_to_StringUtf32(string("\xC8\x85\x93\x93\x96\x6B\x40\xE6\x96\x99\x93\x84\x5A"), CodePage::EBCDIC_CP037) ==
+	                     U"Hello, World!");
+	check(L"CP875 Greek Round Trip", objString->convertStringAscii_to_StringUtf32(objString->convertStringUtf32_to_StringAscii(U"Ελλάδα", CodePage::EBCDIC_CP875),
+	                                                                              CodePage::EBCDIC_CP875) == U"Ελλάδα");
+
+	wcout << endl;
+	wcout << L"Code Page Translations: " << endl;
+	check(L"DOS CP850 To Windows 1252", isCodePageTranslatedThroughUtf32(CodePage::DOS_CP850, CodePage::WINDOWS_1252));
+	check(L"Windows 1252 To MacOS Roman", isCodePageTranslatedThroughUtf32(CodePage::WINDOWS_1252, CodePage::MAC_ROMAN));
+	check(L"ISO 8859-7 To DOS CP737", isCodePageTranslatedThroughUtf32(CodePage::ISO_8859_7, CodePage::DOS_CP737));
+	check(L"EBCDIC CP037 To ISO 8859-15", isCodePageTranslatedThroughUtf32(CodePage::EBCDIC_CP037, CodePage::ISO_8859_15));
+	check(L"EBCDIC CP037 To ISO 8859-1 Lossless", objString->isCodePageTranslationLossless(CodePage::EBCDIC_CP037, CodePage::ISO_8859_1));
+	check(L"DOS CP437 To ISO 8859-1 Lossy", !objString->isCodePageTranslationLossless(CodePage::DOS_CP437, CodePage::ISO_8859_1));
+	check(L"Windows 1252 To Itself", isCodePageTranslatedToItself(CodePage::WINDOWS_1252));
+	check(L"DOS CP437 To Itself", isCodePageTranslatedToItself(CodePage::DOS_CP437));
+	check(L"EBCDIC CP037 To Itself", isCodePageTranslatedToItself(CodePage::EBCDIC_CP037));
+
+	wcout << endl;
+	wcout << L"8-bit Code Pages and UTF-8 Conversions: " << endl;
+	check(L"ISO 8859-1 Like The Scalar Conversions", isAsciiUtf8ConversionScalar(CodePage::ISO_8859_1));
+	check(L"ISO 8859-15 Like The Scalar Conversions", isAsciiUtf8ConversionScalar(CodePage::ISO_8859_15));
+	check(L"Windows 1252 Like The Scalar Conversions", isAsciiUtf8ConversionScalar(CodePage::WINDOWS_1252));
+	check(L"DOS CP850 Like The Scalar Conversions", isAsciiUtf8ConversionScalar(CodePage::DOS_CP850));
+	check(L"Unmappable Replaced", objString->convertStringUtf8_to_StringAscii("a\xE2\x82\xAC" "b\xC3\xA9", CodePage::ISO_8859_1) == "a?b\xE9");
+
+	wcout << endl;
+	wcout << L"8-bit Code Pages and UTF-16 Conversions: " << endl;
+	check(L"ISO 8859-1 Like The Scalar Conversions", isAsciiUtf16ConversionScalar(CodePage::ISO_8859_1));
+	check(L"ISO 8859-15 Like The Scalar Conversions", isAsciiUtf16ConversionScalar(CodePage::ISO_8859_15));
+	check(L"Windows 1252 Like The Scalar Conversions", isAsciiUtf16ConversionScalar(CodePage::WINDOWS_1252));
+	check(L"DOS CP850 Like The Scalar Conversions", isAsciiUtf16ConversionScalar(CodePage::DOS_CP850));
+	const char16_t arrUnmappable[] = { u'a', 0xD800, u'b', 0x20AC, 0 };
+	check(L"Unmappable Replaced", objString->convertStringUtf16_to_StringAscii(arrUnmappable, CodePage::ISO_8859_1) == "a?b?");
+
 	/*
 	narrowString = string("Êùíóôáíôßíïò Ðïëõ÷ñüíçò");
 for(unsigned i = 0; i < narrowString.length(); i++)
@@ -392,5 +1551,8 @@ for(unsigned i = 0; i < narrowString.length(); i++)
 	    wcout << endl;
 	}*/
 
-	return 0;
+	wcout << endl;
+	wcout << L"Failed Checks: " << failedChecks << endl;
+
+	return (failedChecks == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
 }